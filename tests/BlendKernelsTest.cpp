@@ -0,0 +1,161 @@
+// Checks BlendChannels and BlendChannelsScalar give exactly the same bytes as the
+// per channel loops FSEQFile, ESEQFile and PixelData used before the vector kernels
+// for every apply method, length and alignment
+
+#include "BlendKernels.h"
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+static void OldBlend(wxByte* buffer, const wxByte* frameData, size_t bytesToUse, APPLYMETHOD applyMethod)
+{
+    switch (applyMethod)
+    {
+    case APPLYMETHOD::METHOD_OVERWRITE:
+        memcpy(buffer, frameData, bytesToUse);
+        break;
+    case APPLYMETHOD::METHOD_AVERAGE:
+        for (size_t i = 0; i < bytesToUse; i++)
+        {
+            *(buffer + i) = ((int)*(buffer + i) + (int)*(frameData + i)) / 2;
+        }
+        break;
+    case APPLYMETHOD::METHOD_MASK:
+        for (size_t i = 0; i < bytesToUse; i++)
+        {
+            if (*(frameData + i) > 0)
+            {
+                *(buffer + i) = 0x00;
+            }
+        }
+        break;
+    case APPLYMETHOD::METHOD_UNMASK:
+        for (size_t i = 0; i < bytesToUse; i++)
+        {
+            if (*(frameData + i) == 0)
+            {
+                *(buffer + i) = 0x00;
+            }
+        }
+        break;
+    case APPLYMETHOD::METHOD_MAX:
+        for (size_t i = 0; i < bytesToUse; i++)
+        {
+            *(buffer + i) = std::max(*(buffer + i), *(frameData + i));
+        }
+        break;
+    case APPLYMETHOD::METHOD_OVERWRITEIFBLACK:
+        for (size_t i = 0; i < bytesToUse; i++)
+        {
+            if (*(buffer + i) == 0)
+            {
+                *(buffer + i) = *(frameData + i);
+            }
+        }
+        break;
+    }
+}
+
+static const char* MethodName(APPLYMETHOD method)
+{
+    switch (method)
+    {
+    case APPLYMETHOD::METHOD_OVERWRITE: return "Overwrite";
+    case APPLYMETHOD::METHOD_OVERWRITEIFBLACK: return "Overwrite If Black";
+    case APPLYMETHOD::METHOD_MASK: return "Mask";
+    case APPLYMETHOD::METHOD_UNMASK: return "Unmask";
+    case APPLYMETHOD::METHOD_AVERAGE: return "Average";
+    case APPLYMETHOD::METHOD_MAX: return "Max";
+    }
+    return "";
+}
+
+// a guard either side of the run catches writes outside it
+#define GUARD 64
+
+int main()
+{
+    std::vector<APPLYMETHOD> methods = {
+        APPLYMETHOD::METHOD_OVERWRITE, APPLYMETHOD::METHOD_OVERWRITEIFBLACK, APPLYMETHOD::METHOD_MASK,
+        APPLYMETHOD::METHOD_UNMASK, APPLYMETHOD::METHOD_AVERAGE, APPLYMETHOD::METHOD_MAX
+    };
+
+    std::vector<size_t> lengths;
+    for (size_t l = 0; l <= 130; l++)
+    {
+        lengths.push_back(l);
+    }
+    for (size_t l : { 255, 256, 257, 511, 512, 513, 1023, 1024, 1025, 4095, 4096, 4097, 65536 + 7 })
+    {
+        lengths.push_back(l);
+    }
+    size_t longest = *std::max_element(lengths.begin(), lengths.end());
+
+    std::mt19937 rng(12345);
+    std::vector<wxByte> dstData(longest + 2 * GUARD + 32);
+    std::vector<wxByte> srcData(longest + 2 * GUARD + 32);
+    std::vector<wxByte> expected(dstData.size());
+    std::vector<wxByte> kernel(dstData.size());
+    std::vector<wxByte> scalar(dstData.size());
+
+    int failures = 0;
+    long checks = 0;
+
+    printf("Testing the %s kernels\n", GetBlendKernelName());
+
+    for (auto method = methods.begin(); method != methods.end(); ++method)
+    {
+        for (auto length = lengths.begin(); length != lengths.end(); ++length)
+        {
+            // big runs only get a few alignments
+            size_t alignments = *length > 1024 ? 4 : 32;
+            for (size_t dstAlign = 0; dstAlign < alignments; dstAlign++)
+            {
+                for (size_t srcAlign = 0; srcAlign < alignments; srcAlign += (*length > 130 ? 3 : 1))
+                {
+                    // plenty of zeros and 255s as the masks turn on them
+                    size_t used = *length + 2 * GUARD + 32;
+                    for (size_t i = 0; i < used; i++)
+                    {
+                        int r = rng() % 8;
+                        dstData[i] = r == 0 ? 0 : r == 1 ? 255 : (wxByte)rng();
+                        r = rng() % 8;
+                        srcData[i] = r == 0 ? 0 : r == 1 ? 255 : (wxByte)rng();
+                    }
+
+                    memcpy(&expected[0], &dstData[0], used);
+                    memcpy(&kernel[0], &dstData[0], used);
+                    memcpy(&scalar[0], &dstData[0], used);
+                    const wxByte* src = &srcData[GUARD + srcAlign];
+                    OldBlend(&expected[GUARD + dstAlign], src, *length, *method);
+                    BlendChannels(&kernel[GUARD + dstAlign], src, *length, *method);
+                    BlendChannelsScalar(&scalar[GUARD + dstAlign], src, *length, *method);
+                    checks++;
+
+                    if (memcmp(&kernel[0], &expected[0], used) != 0)
+                    {
+                        if (failures < 20)
+                        {
+                            printf("FAIL BlendChannels %s length %d dst offset %d src offset %d\n", MethodName(*method), (int)*length, (int)dstAlign, (int)srcAlign);
+                        }
+                        failures++;
+                    }
+                    if (memcmp(&scalar[0], &expected[0], used) != 0)
+                    {
+                        if (failures < 20)
+                        {
+                            printf("FAIL BlendChannelsScalar %s length %d dst offset %d src offset %d\n", MethodName(*method), (int)*length, (int)dstAlign, (int)srcAlign);
+                        }
+                        failures++;
+                    }
+                }
+            }
+        }
+    }
+
+    printf("%ld checks, %d failures\n", checks, failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,381 @@
+// Checks BlurPixels against the float blur PixelBufferClass used before the fixed point
+// rewrite on random buffers, sizes and blur values ... the gaussian may be out by one
+// through rounding, the box average must match exactly
+
+#include "BlurKernels.h"
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+static int __failures = 0;
+static int __checks = 0;
+
+#pragma region Old float blur
+
+namespace Old
+{
+    static void boxesForGauss(int d, std::vector<float> &boxes)
+    {
+        switch (d) {
+            case 2: case 3: boxes.push_back(1.0); break;
+            case 4: case 5: case 6: boxes.push_back(3.0); break;
+            case 7: case 8: case 9: boxes.push_back(5.0); break;
+            case 10: case 11: case 12: boxes.push_back(7.0); break;
+            case 13: case 14: case 15: boxes.push_back(9.0); break;
+        }
+        float b = boxes.back();
+        switch (d) {
+            case 2: case 4: case 5: case 7: case 8: case 10: case 11: case 13: case 14:
+                boxes.push_back(b);
+                break;
+            default:
+                boxes.push_back(b + 2.0);
+                break;
+        }
+        switch (d) {
+            case 4: case 7: case 10: case 13:
+                boxes.push_back(b);
+                break;
+            default:
+                boxes.push_back(b + 2.0);
+        }
+    }
+
+#define RED(a, b) a[(b)*4]
+#define GREEN(a, b) a[(b)*4 + 1]
+#define BLUE(a, b) a[(b)*4 + 2]
+#define ALPHA(a, b) a[(b)*4 + 3]
+    static inline void SET(float *ar, int idx, float r, float g, float b, float a) {
+        idx *= 4;
+        ar[idx++] = r;
+        ar[idx++] = g;
+        ar[idx++] = b;
+        ar[idx] = a;
+    }
+
+    static void boxBlurH_4 (const float  * const scl, float *tcl, int w, int h, float r) {
+        float iarr = 1.0f / (r+r+1.0f);
+        for(int i=0; i<h; i++) {
+            int ti = i*w;
+            int li = ti;
+            int ri = ti+r;
+            int maxri = ti + w - 1;
+            int fvIdx = ti;
+            int lvIdx = ti+w-1;
+
+            float valr = (r+1.0) * RED(scl,fvIdx);
+            float valg = (r+1.0) * GREEN(scl,fvIdx);
+            float valb = (r+1.0) * BLUE(scl,fvIdx);
+            float vala = (r+1.0) * ALPHA(scl,fvIdx);
+
+            float fvRed = RED(scl, fvIdx);
+            float fvGreen = GREEN(scl, fvIdx);
+            float fvBlue = BLUE(scl, fvIdx);
+            float fvAlpha = ALPHA(scl, fvIdx);
+            float lvRed = RED(scl, lvIdx);
+            float lvGreen = GREEN(scl, lvIdx);
+            float lvBlue = BLUE(scl, lvIdx);
+            float lvAlpha = ALPHA(scl, lvIdx);
+
+            for (int j=0; j<r; j++) {
+                int idx = j < w ? ti+j : lvIdx;
+                valr += RED(scl, idx);
+                valg += GREEN(scl, idx);
+                valb += BLUE(scl, idx);
+                vala += ALPHA(scl, idx);
+            }
+            for (int j=0  ; j<=r ; j++) {
+                int idx = ri <= maxri ? ri++ : lvIdx;
+                valr += RED(scl, idx) - fvRed;
+                valg += GREEN(scl, idx) - fvGreen;
+                valb += BLUE(scl, idx) - fvBlue;
+                vala += ALPHA(scl, idx) - fvAlpha;
+
+                if (ti <= maxri) {
+                    SET(tcl, ti, valr*iarr, valg*iarr, valb*iarr, vala*iarr);
+                    ti++;
+                }
+            }
+            for (int j=r+1; j<w-r; j++) {
+                int c = ri <= maxri ? ri++ : lvIdx;
+                int c2 = li <= maxri ? li++ : lvIdx;
+                valr += RED(scl, c) - RED(scl, c2);
+                valg += GREEN(scl, c) - GREEN(scl, c2);
+                valb += BLUE(scl, c) - BLUE(scl, c2);
+                vala += ALPHA(scl, c) - ALPHA(scl, c2);
+                if (ti <= maxri) {
+                    SET(tcl, ti, valr*iarr, valg*iarr, valb*iarr, vala*iarr);
+                    ti++;
+                }
+            }
+
+            for (int j=w-r; j<w  ; j++) {
+                int c2 = li <= maxri ? li++: lvIdx;
+                valr += lvRed - RED(scl, c2);
+                valg += lvGreen - GREEN(scl, c2);
+                valb += lvBlue - BLUE(scl, c2);
+                vala += lvAlpha - ALPHA(scl, c2);
+                if (ti <= maxri) {
+                    SET(tcl, ti, valr*iarr, valg*iarr, valb*iarr, vala*iarr);
+                    ti++;
+                }
+            }
+        }
+    }
+    static void boxBlurT_4 (const float * const scl, float *tcl, int w, int h, float r) {
+        float iarr = 1.0f / (r+r+1.0f);
+        for(int i=0; i<w; i++) {
+            int ti = i;
+            int li = ti;
+            int ri = ti+r*w;
+
+            int maxri = ti+w*(h-1);
+
+            int fvIdx = ti;
+            int lvIdx = ti+w*(h-1);
+
+            float fvRed = RED(scl, fvIdx);
+            float fvGreen = GREEN(scl, fvIdx);
+            float fvBlue = BLUE(scl, fvIdx);
+            float fvAlpha = ALPHA(scl, fvIdx);
+            float lvRed = RED(scl, lvIdx);
+            float lvGreen = GREEN(scl, lvIdx);
+            float lvBlue = BLUE(scl, lvIdx);
+            float lvAlpha = ALPHA(scl, lvIdx);
+
+            float valr = (r+1)*fvRed;
+            float valg = (r+1)*fvGreen;
+            float valb = (r+1)*fvBlue;
+            float vala = (r+1)*fvAlpha;
+
+            for(int j=0; j<r; j++) {
+                int idx = j < w ? ti+j*w : lvIdx;
+                valr += RED(scl, idx);
+                valg += GREEN(scl, idx);
+                valb += BLUE(scl, idx);
+                vala += ALPHA(scl, idx);
+            }
+            for(int j=0  ; j<=r ; j++) {
+                int idx = ri <= maxri ? ri : lvIdx;
+                valr += RED(scl, idx) - fvRed;
+                valg += GREEN(scl, idx) - fvGreen;
+                valb += BLUE(scl, idx) - fvBlue;
+                vala += ALPHA(scl, idx) - fvAlpha;
+                if (ti <= maxri) {
+                    SET(tcl, ti, valr*iarr, valg*iarr, valb*iarr, vala*iarr);
+                }
+                ri+=w;
+                ti+=w;
+            }
+            for(int j=r+1; j<h-r; j++) {
+                int c = ri <= maxri ? ri : lvIdx;
+                int c2 = li <= maxri ? li : lvIdx;
+                valr += RED(scl, c) - RED(scl, c2);
+                valg += GREEN(scl, c) - GREEN(scl, c2);
+                valb += BLUE(scl, c) - BLUE(scl, c2);
+                vala += ALPHA(scl, c) - ALPHA(scl, c2);
+                if (ti <= maxri) {
+                    SET(tcl, ti, valr*iarr, valg*iarr, valb*iarr, vala*iarr);
+                }
+                li+=w; ri+=w; ti+=w;
+            }
+            for(int j=h-r; j<h  ; j++) {
+                int c2 = li <= maxri ? li : lvIdx;
+                valr += lvRed - RED(scl, c2);
+                valg += lvGreen - GREEN(scl, c2);
+                valb += lvBlue - BLUE(scl, c2);
+                vala += lvAlpha - ALPHA(scl, c2);
+                if (ti <= maxri) {
+                    SET(tcl, ti, valr*iarr, valg*iarr, valb*iarr, vala*iarr);
+                }
+                li += w;
+                ti += w;
+            }
+        }
+    }
+    static void boxBlur_4(float *scl, float *tcl, int w, int h, float r, int size) {
+        memcpy(tcl, scl, sizeof(float)*4*size);
+        boxBlurH_4(tcl, scl, w, h, r);
+        boxBlurT_4(scl, tcl, w, h, r);
+    }
+
+    static void gaussBlur_4(float *scl, float *tcl, int w, int h, int r, int size) {
+        std::vector<float> bxs;
+        boxesForGauss(r - 1, bxs);
+        boxBlur_4 (scl, tcl, w, h, (bxs[0]-1)/2, size);
+        boxBlur_4 (tcl, scl, w, h, (bxs[1]-1)/2, size);
+        boxBlur_4 (scl, tcl, w, h, (bxs[2]-1)/2, size);
+    }
+#undef RED
+#undef GREEN
+#undef BLUE
+#undef ALPHA
+
+    static inline int roundInt(float r) {
+        int tmp = static_cast<int> (r);
+        tmp += (r-tmp>=.5) - (r-tmp<=-.5);
+        return tmp;
+    }
+
+    // PixelBufferClass::Blur as it was
+    static void Blur(std::vector<xlColor>& pixels, int w, int h, int b)
+    {
+        if (w == 1 && h == 1) {
+            return;
+        }
+        if (b < 2) {
+            return;
+        } else if (b > 2 && w > 6 && h > 6) {
+            int pixCount = pixels.size();
+            std::vector<float> input(pixCount * 4);
+            std::vector<float> tmp(pixCount * 4);
+            for (int x = 0; x < pixCount; x++) {
+                const xlColor &c = pixels[x];
+                input[x * 4] = c.red;
+                input[x * 4 + 1] = c.green;
+                input[x * 4 + 2] = c.blue;
+                input[x * 4 + 3] = c.alpha;
+            }
+            gaussBlur_4(&input[0], &tmp[0], w, h, b, pixCount);
+
+            for (int x = 0; x < pixCount; x++) {
+                pixels[x].Set(roundInt(tmp[x*4]),
+                              roundInt(tmp[x*4 + 1]),
+                              roundInt(tmp[x*4 + 2]),
+                              roundInt(tmp[x*4 + 3]));
+            }
+        } else {
+            int d = 0;
+            int u = 0;
+            if (b % 2 == 0)
+            {
+                d = b / 2;
+                u = (b - 1) / 2;
+            }
+            else
+            {
+                d = (b - 1) / 2;
+                u = (b - 1) / 2;
+            }
+            std::vector<xlColor> orig(pixels);
+            for (int x = 0; x < w; x++)
+            {
+                for (int y = 0; y < h; y++)
+                {
+                    int r = 0;
+                    int g = 0;
+                    int bl = 0;
+                    int a = 0;
+                    int sm = 0;
+                    for (int i = x - d; i <= x + u; i++)
+                    {
+                        if (i >= 0 && i < w)
+                        {
+                            for (int j = y - d; j <= y + u; j++)
+                            {
+                                if (j >= 0 && j < h)
+                                {
+                                    const xlColor &c = orig[j * w + i];
+                                    r += c.red;
+                                    g += c.green;
+                                    bl += c.blue;
+                                    a += c.alpha;
+                                    ++sm;
+                                }
+                            }
+                        }
+                    }
+                    pixels[y * w + x].Set(r / sm, g / sm, bl / sm, a / sm);
+                }
+            }
+        }
+    }
+}
+
+#pragma endregion
+
+// smooth gradients, hard edges and noise ... each shows up different rounding
+static std::vector<xlColor> RandomPixels(std::mt19937& rng, int w, int h)
+{
+    std::vector<xlColor> pixels(w * h);
+    int kind = rng() % 3;
+    for (int y = 0; y < h; y++)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            xlColor& c = pixels[y * w + x];
+            if (kind == 0)
+            {
+                c.Set(rng() % 256, rng() % 256, rng() % 256, rng() % 256);
+            }
+            else if (kind == 1)
+            {
+                c.Set(x * 255 / w, y * 255 / h, (x + y) % 256, 255);
+            }
+            else
+            {
+                bool on = (x / 3 + y / 2) % 2 == 0;
+                c.Set(on ? 255 : 0, on ? 0 : 255, rng() % 2 ? 255 : 0, on ? 255 : 128);
+            }
+        }
+    }
+    return pixels;
+}
+
+static void Compare(std::mt19937& rng, int w, int h, int b, BlurScratch& scratch)
+{
+    std::vector<xlColor> expected = RandomPixels(rng, w, h);
+    std::vector<xlColor> actual(expected);
+    Old::Blur(expected, w, h, b);
+    BlurPixels(&actual[0], w, h, b, scratch);
+
+    // only the gaussian was allowed to change
+    bool gaussian = b > 2 && w > 6 && h > 6;
+    int allowed = gaussian ? 1 : 0;
+    int worst = 0;
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        worst = std::max(worst, std::abs((int)expected[i].red - (int)actual[i].red));
+        worst = std::max(worst, std::abs((int)expected[i].green - (int)actual[i].green));
+        worst = std::max(worst, std::abs((int)expected[i].blue - (int)actual[i].blue));
+        worst = std::max(worst, std::abs((int)expected[i].alpha - (int)actual[i].alpha));
+    }
+    __checks++;
+    if (worst > allowed)
+    {
+        printf("FAIL %s blur %d on %dx%d is out by %d\n", gaussian ? "gaussian" : "box", b, w, h, worst);
+        __failures++;
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(1357);
+    // one scratch for every size like a layer whose buffer changes size between effects
+    BlurScratch scratch;
+
+    // the corners between the two paths
+    for (int b = 2; b <= 16; b++)
+    {
+        Compare(rng, 6, 6, b, scratch);
+        Compare(rng, 7, 7, b, scratch);
+        Compare(rng, 7, 6, b, scratch);
+        Compare(rng, 1, 50, b, scratch);
+        Compare(rng, 50, 1, b, scratch);
+        Compare(rng, 2, 1, b, scratch);
+    }
+
+    for (int i = 0; i < 2000; i++)
+    {
+        int w = 1 + rng() % 120;
+        int h = 1 + rng() % 120;
+        int b = 2 + rng() % 15;
+        Compare(rng, w, h, b, scratch);
+    }
+
+    printf("%d checks, %d failures\n", __checks, __failures);
+    return __failures == 0 ? 0 : 1;
+}
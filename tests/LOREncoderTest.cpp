@@ -0,0 +1,236 @@
+// Decodes the bytes LOREncoder produces the way a LOR controller would and checks
+// the lights end up showing what the sequence asked for, whatever the port budget
+
+#include "outputs/LOREncoder.h"
+
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+static int __failures = 0;
+static int __checks = 0;
+
+static void Check(bool ok, const std::string& what)
+{
+    __checks++;
+    if (!ok)
+    {
+        printf("FAIL %s\n", what.c_str());
+        __failures++;
+    }
+}
+
+struct Controllers
+{
+    std::map<long, wxByte> intensity; // channel -> intensity byte last received
+    int heartbeats = 0;
+    int commands = 0;
+    bool garbled = false;
+};
+
+// walks the stream one command at a time ... anything not a heartbeat or intensity command is garbage
+static void Decode(const std::vector<wxByte>& buffer, Controllers& controllers)
+{
+    size_t i = 0;
+    while (i < buffer.size())
+    {
+        if (i + LOR_HEARTBEAT_LEN <= buffer.size() && buffer[i] == 0 && buffer[i + 1] == 0xFF &&
+            buffer[i + 2] == 0x81 && buffer[i + 3] == 0x56 && buffer[i + 4] == 0)
+        {
+            controllers.heartbeats++;
+            i += LOR_HEARTBEAT_LEN;
+        }
+        else if (i + LOR_INTENSITY_COMMAND_LEN <= buffer.size() && buffer[i] == 0 && buffer[i + 1] != 0 &&
+            buffer[i + 2] == 3 && (buffer[i + 4] & 0x80) != 0 && buffer[i + 5] == 0)
+        {
+            long channel = (buffer[i + 1] - 1) * 16 + (buffer[i + 4] & 0x0F);
+            controllers.intensity[channel] = buffer[i + 3];
+            controllers.commands++;
+            i += LOR_INTENSITY_COMMAND_LEN;
+        }
+        else
+        {
+            controllers.garbled = true;
+            return;
+        }
+    }
+}
+
+static bool Showing(const Controllers& controllers, const std::vector<wxByte>& values)
+{
+    for (long c = 0; c < (long)values.size(); c++)
+    {
+        auto it = controllers.intensity.find(c);
+        if (it == controllers.intensity.end() || it->second != LOREncoder::IntensityByte(values[c])) return false;
+    }
+    return true;
+}
+
+static std::vector<wxByte> Frame(LOREncoder& encoder, Controllers& controllers, size_t maxBytes, bool heartbeat = false)
+{
+    std::vector<wxByte> buffer;
+    if (heartbeat)
+    {
+        LOREncoder::AppendHeartbeat(buffer);
+    }
+    encoder.Encode(buffer, maxBytes);
+    Decode(buffer, controllers);
+    return buffer;
+}
+
+static void TestIntensityBytes()
+{
+    Check(LOREncoder::IntensityByte(0) == 0xF0, "0 is off");
+    Check(LOREncoder::IntensityByte(255) == 0x01, "255 is full");
+    Check(LOREncoder::IntensityByte(1) == 0xF0, "1 rounds to off");
+    Check(LOREncoder::IntensityByte(128) == 228 - 50 * 2, "128 is 50%");
+}
+
+static void TestFirstFrameSendsEverything()
+{
+    LOREncoder encoder;
+    encoder.SetChannels(200);
+    Controllers controllers;
+
+    auto buffer = Frame(encoder, controllers, LOR_NO_LIMIT, true);
+    Check(!controllers.garbled, "first frame decodes");
+    Check(controllers.heartbeats == 1, "first frame keeps the heartbeat");
+    Check(controllers.commands == 200, "first frame sends every channel");
+    Check(encoder.GetLastChanged() == 200 && encoder.GetLastDeferred() == 0, "first frame counts every channel as changed");
+    Check(Showing(controllers, std::vector<wxByte>(200, 0)), "first frame turns everything off");
+
+    buffer = Frame(encoder, controllers, LOR_NO_LIMIT);
+    Check(buffer.empty() && encoder.GetLastChanged() == 0, "nothing changed sends nothing");
+}
+
+static void TestOnlyChangesAreSent()
+{
+    LOREncoder encoder;
+    encoder.SetChannels(200);
+    Controllers controllers;
+    std::vector<wxByte> values(200, 0);
+    Frame(encoder, controllers, LOR_NO_LIMIT);
+
+    values[5] = 255;
+    values[150] = 128;
+    values[7] = 1; // still shows as off
+    for (long c = 0; c < 200; c++)
+    {
+        encoder.SetOneChannel(c, values[c]);
+    }
+    controllers.commands = 0;
+    Frame(encoder, controllers, LOR_NO_LIMIT);
+    Check(!controllers.garbled, "changes decode");
+    Check(controllers.commands == 2, "only visibly changed channels are sent");
+    Check(Showing(controllers, values), "changes are shown");
+
+    // channels past 16 land on the right unit
+    encoder.SetOneChannel(199, 255);
+    values[199] = 255;
+    Frame(encoder, controllers, LOR_NO_LIMIT);
+    Check(Showing(controllers, values), "last channel is on the last unit");
+}
+
+static void TestBudget()
+{
+    LOREncoder encoder;
+    encoder.SetChannels(200);
+    Controllers controllers;
+    std::vector<wxByte> values(200, 0);
+    Frame(encoder, controllers, LOR_NO_LIMIT);
+
+    for (long c = 0; c < 200; c++)
+    {
+        values[c] = (wxByte)(c + 40);
+        encoder.SetOneChannel(c, values[c]);
+    }
+
+    // room for 10 commands a frame
+    size_t budget = 10 * LOR_INTENSITY_COMMAND_LEN;
+    int frames = 0;
+    bool overBudget = false;
+    do
+    {
+        auto buffer = Frame(encoder, controllers, budget);
+        if (buffer.size() > budget) overBudget = true;
+        frames++;
+    } while (encoder.GetLastDeferred() > 0 && frames < 100);
+
+    Check(!overBudget, "frames stay inside the budget");
+    Check(!controllers.garbled, "budgeted frames decode");
+    Check(frames == 20, "held back channels go out on later frames");
+    Check(Showing(controllers, values), "held back channels all arrive");
+
+    // the biggest change goes first when only one fits
+    encoder.SetOneChannel(10, values[10] + 5);
+    encoder.SetOneChannel(20, 255);
+    auto buffer = Frame(encoder, controllers, LOR_INTENSITY_COMMAND_LEN);
+    Check(buffer.size() == LOR_INTENSITY_COMMAND_LEN && (buffer[4] & 0x0F) == 20 % 16 && buffer[1] == 20 / 16 + 1, "biggest change goes first");
+    Check(encoder.GetLastChanged() == 2 && encoder.GetLastDeferred() == 1, "the other change is held back");
+
+    // and the one held back goes next even though a bigger change has come along
+    encoder.SetOneChannel(30, 255);
+    buffer = Frame(encoder, controllers, LOR_INTENSITY_COMMAND_LEN);
+    Check(buffer.size() == LOR_INTENSITY_COMMAND_LEN && (buffer[4] & 0x0F) == 10 % 16 && buffer[1] == 10 / 16 + 1, "longest held back goes first");
+
+    // no room at all sends nothing
+    buffer = Frame(encoder, controllers, 0);
+    Check(buffer.empty() && encoder.GetLastDeferred() == 1, "no room sends nothing");
+}
+
+static void TestRefresh()
+{
+    LOREncoder encoder;
+    encoder.SetChannels(64);
+    Controllers controllers;
+    std::vector<wxByte> values(64, 0);
+    for (long c = 0; c < 64; c++)
+    {
+        values[c] = (wxByte)(c * 4);
+        encoder.SetOneChannel(c, values[c]);
+    }
+    Frame(encoder, controllers, LOR_NO_LIMIT);
+
+    // a controller that was power cycled forgets everything ... spare room must bring it back
+    controllers.intensity.clear();
+    int frames = 0;
+    while (!Showing(controllers, values) && frames < 1000)
+    {
+        auto buffer = Frame(encoder, controllers, 100 * LOR_INTENSITY_COMMAND_LEN);
+        if (frames == 0) Check(buffer.size() < 100 * LOR_INTENSITY_COMMAND_LEN, "refresh leaves most of the room free");
+        frames++;
+    }
+    Check(!controllers.garbled, "refresh decodes");
+    Check(Showing(controllers, values), "refresh brings a forgetful controller back");
+
+    // but never with no limit
+    auto buffer = Frame(encoder, controllers, LOR_NO_LIMIT);
+    Check(buffer.empty(), "no refresh without a limit");
+}
+
+static void TestReset()
+{
+    LOREncoder encoder;
+    encoder.SetChannels(50);
+    Controllers controllers;
+    Frame(encoder, controllers, LOR_NO_LIMIT);
+
+    encoder.Reset();
+    controllers.commands = 0;
+    Frame(encoder, controllers, LOR_NO_LIMIT);
+    Check(controllers.commands == 50 && encoder.GetLastChanged() == 50, "reset sends every channel again");
+}
+
+int main()
+{
+    TestIntensityBytes();
+    TestFirstFrameSendsEverything();
+    TestOnlyChangesAreSent();
+    TestBudget();
+    TestRefresh();
+    TestReset();
+
+    printf("%d checks, %d failures\n", __checks, __failures);
+    return __failures == 0 ? 0 : 1;
+}
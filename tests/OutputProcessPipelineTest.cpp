@@ -0,0 +1,248 @@
+// Runs random output processing lists through OutputProcessPipeline and through each
+// process's own Frame in turn and checks both give the same bytes, including remaps
+// that overlap and lists that change between frames
+
+#include "OutputProcessPipeline.h"
+#include "OutputProcessColourOrder.h"
+#include "OutputProcessDim.h"
+#include "OutputProcessDimWhite.h"
+#include "OutputProcessRemap.h"
+#include "OutputProcessReverse.h"
+#include "OutputProcessSet.h"
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+static int __failures = 0;
+static int __checks = 0;
+
+static void Check(bool ok, const std::string& what)
+{
+    __checks++;
+    if (!ok)
+    {
+        printf("FAIL %s\n", what.c_str());
+        __failures++;
+    }
+}
+
+// a process that can be changed in place ... the pipeline bakes its value into a lookup
+// table so it only stays right if the change count makes the pipeline recompile
+class OutputProcessAdd : public OutputProcess
+{
+    size_t _channels;
+    int _add;
+
+public:
+
+    OutputProcessAdd(size_t startChannel, size_t channels, int add) : OutputProcess(startChannel, "")
+    {
+        _channels = channels;
+        _add = add;
+    }
+    void SetAdd(int add) { if (add != _add) { _add = add; _changeCount++; } }
+    virtual wxXmlNode* Save() override { return nullptr; }
+    virtual size_t GetP1() const override { return _channels; }
+    virtual size_t GetP2() const override { return _add; }
+    virtual std::string GetType() const override { return "Add"; }
+
+    virtual void Frame(wxByte* buffer, size_t size) override
+    {
+        size_t chs = std::min(_channels, size - (_startChannel - 1));
+        for (size_t i = 0; i < chs; i++)
+        {
+            buffer[_startChannel - 1 + i] = (wxByte)(buffer[_startChannel - 1 + i] + _add);
+        }
+    }
+
+    virtual void Compile(OutputProcessPipeline& pipeline, size_t size) override
+    {
+        std::array<wxByte, 256> lut;
+        for (int i = 0; i < 256; i++)
+        {
+            lut[i] = (wxByte)(i + _add);
+        }
+        pipeline.MapChannels(_startChannel - 1, std::min(_channels, size - (_startChannel - 1)), lut);
+    }
+};
+
+static OutputProcess* RandomProcess(std::mt19937& rng, size_t size)
+{
+    static const int colourOrders[] = { 123, 132, 213, 231, 312, 321 };
+    static const int dims[] = { 0, 100, 50, 1, 99 };
+
+    size_t start = 1 + rng() % size;
+    size_t channels = 1 + rng() % size;
+    size_t nodes = rng() % (size / 3 + 2);
+    int dim = rng() % 3 == 0 ? dims[rng() % 5] : rng() % 101;
+    switch (rng() % 6)
+    {
+    case 0:
+        return new OutputProcessDim(start, channels, dim, "");
+    case 1:
+        return new OutputProcessSet(start, channels, rng() % 256, "");
+    case 2:
+        // often close to the start so the ranges overlap
+        return new OutputProcessRemap(start, rng() % 2 ? 1 + rng() % size : std::max((size_t)1, std::min(size, start + (rng() % 7) - 3)), channels, "");
+    case 3:
+        return new OutputProcessColourOrder(start, nodes, colourOrders[rng() % 6], "");
+    case 4:
+        return new OutputProcessReverse(start, nodes, 0, "");
+    default:
+        return new OutputProcessDimWhite(start, nodes, dim, "");
+    }
+}
+
+// white nodes, repeated values and noise so dim white and the tables all get work
+static std::vector<wxByte> RandomFrame(std::mt19937& rng, size_t size)
+{
+    std::vector<wxByte> frame(size);
+    for (size_t i = 0; i < size; i += 3)
+    {
+        wxByte v = rng() % 256;
+        bool white = rng() % 3 == 0;
+        for (size_t j = i; j < std::min(i + 3, size); j++)
+        {
+            frame[j] = white ? v : rng() % 256;
+        }
+    }
+    return frame;
+}
+
+static void Compare(OutputProcessPipeline& pipeline, const std::list<OutputProcess*>& processes, const std::vector<wxByte>& frame, const std::string& what)
+{
+    std::vector<wxByte> expected(frame);
+    for (auto it = processes.begin(); it != processes.end(); ++it)
+    {
+        (*it)->Frame(&expected[0], expected.size());
+    }
+
+    std::vector<wxByte> actual(frame);
+    pipeline.Frame(processes, &actual[0], actual.size());
+
+    size_t bad = 0;
+    while (bad < expected.size() && expected[bad] == actual[bad]) bad++;
+    __checks++;
+    if (bad != expected.size())
+    {
+        printf("FAIL %s: channel %d is %d but should be %d\n", what.c_str(), (int)bad + 1, actual[bad], expected[bad]);
+        __failures++;
+    }
+}
+
+static void Clear(std::list<OutputProcess*>& processes)
+{
+    for (auto it = processes.begin(); it != processes.end(); ++it)
+    {
+        delete *it;
+    }
+    processes.clear();
+}
+
+static void TestRandomLists(std::mt19937& rng)
+{
+    for (int i = 0; i < 3000; i++)
+    {
+        size_t size = 3 + rng() % 600;
+        std::list<OutputProcess*> processes;
+        int count = 1 + rng() % 12;
+        for (int p = 0; p < count; p++)
+        {
+            processes.push_back(RandomProcess(rng, size));
+        }
+
+        // a few frames through the one compiled program
+        OutputProcessPipeline pipeline;
+        for (int f = 0; f < 3; f++)
+        {
+            Compare(pipeline, processes, RandomFrame(rng, size), "random list " + std::to_string(i));
+        }
+        Clear(processes);
+    }
+}
+
+static void TestOverlappingRemaps(std::mt19937& rng)
+{
+    size_t size = 60;
+    std::vector<std::list<OutputProcess*>> lists(5);
+    // shifted up and down over itself
+    lists[0].push_back(new OutputProcessRemap(5, 1, 20, ""));
+    lists[1].push_back(new OutputProcessRemap(1, 5, 20, ""));
+    // chained through each other
+    lists[2].push_back(new OutputProcessRemap(10, 1, 15, ""));
+    lists[2].push_back(new OutputProcessRemap(20, 10, 15, ""));
+    lists[2].push_back(new OutputProcessRemap(1, 25, 15, ""));
+    // a set and a dim caught in the middle of remaps
+    lists[3].push_back(new OutputProcessSet(12, 4, 200, ""));
+    lists[3].push_back(new OutputProcessRemap(3, 10, 30, ""));
+    lists[3].push_back(new OutputProcessDim(1, 20, 50, ""));
+    lists[3].push_back(new OutputProcessRemap(11, 1, 30, ""));
+    // remapped then reordered and remapped back
+    lists[4].push_back(new OutputProcessRemap(31, 1, 30, ""));
+    lists[4].push_back(new OutputProcessColourOrder(31, 10, 321, ""));
+    lists[4].push_back(new OutputProcessReverse(28, 8, 0, ""));
+    lists[4].push_back(new OutputProcessRemap(2, 31, 30, ""));
+
+    for (size_t l = 0; l < lists.size(); l++)
+    {
+        OutputProcessPipeline pipeline;
+        Compare(pipeline, lists[l], RandomFrame(rng, size), "overlapping remaps " + std::to_string(l));
+        Clear(lists[l]);
+    }
+}
+
+static void TestChanges(std::mt19937& rng)
+{
+    size_t size = 90;
+    OutputProcessPipeline pipeline;
+    std::list<OutputProcess*> processes;
+    processes.push_back(new OutputProcessRemap(1, 31, 30, ""));
+    processes.push_back(new OutputProcessDim(1, 60, 50, ""));
+    OutputProcessAdd* add = new OutputProcessAdd(40, 20, 10);
+    processes.push_back(add);
+    Compare(pipeline, processes, RandomFrame(rng, size), "before any change");
+
+    // a setting changed in place
+    add->SetAdd(77);
+    Compare(pipeline, processes, RandomFrame(rng, size), "after a setting changed");
+
+    // the dialog deletes the old process and makes a new one ... likely at the same address
+    OutputProcess* old = processes.front();
+    processes.pop_front();
+    delete old;
+    processes.push_front(new OutputProcessRemap(1, 61, 30, ""));
+    Compare(pipeline, processes, RandomFrame(rng, size), "after a process was replaced");
+
+    old = *std::next(processes.begin());
+    processes.erase(std::next(processes.begin()));
+    delete old;
+    processes.insert(std::next(processes.begin()), new OutputProcessDim(1, 60, 50, ""));
+    Compare(pipeline, processes, RandomFrame(rng, size), "after a process was replaced with the same settings");
+
+    // reordered, removed and added
+    processes.reverse();
+    Compare(pipeline, processes, RandomFrame(rng, size), "after the list was reordered");
+    processes.remove(add);
+    Compare(pipeline, processes, RandomFrame(rng, size), "after a process was removed");
+    processes.push_back(add);
+    processes.push_back(new OutputProcessSet(85, 10, 7, ""));
+    Compare(pipeline, processes, RandomFrame(rng, size), "after processes were added");
+
+    // the frame got bigger
+    Compare(pipeline, processes, RandomFrame(rng, size * 2), "after the frame grew");
+    Clear(processes);
+}
+
+int main()
+{
+    std::mt19937 rng(97531);
+
+    TestOverlappingRemaps(rng);
+    TestChanges(rng);
+    TestRandomLists(rng);
+
+    printf("%d checks, %d failures\n", __checks, __failures);
+    return __failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,178 @@
+// Checks RangeOverlapSweep finds exactly the model pairs the old pairwise comparison
+// of every model's ranges against every other model's found, on random layouts,
+// and times them and the old set per channel on a 1M channel, 1000 model layout
+
+#include "RenderUtils.h"
+
+#include <cstdio>
+#include <chrono>
+#include <random>
+#include <set>
+#include <vector>
+
+static int __failures = 0;
+static int __checks = 0;
+
+typedef std::vector<std::vector<NodeRange>> Layout;
+
+static long long NowUS()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// how RenderTree and Render worked out overlaps before the sweep
+static std::vector<std::pair<int, int>> Pairwise(const Layout& layout)
+{
+    std::vector<std::pair<int, int>> res;
+    for (int a = 0; a < (int)layout.size(); a++)
+    {
+        for (int b = a + 1; b < (int)layout.size(); b++)
+        {
+            bool overlaps = false;
+            for (auto ra = layout[a].begin(); !overlaps && ra != layout[a].end(); ++ra)
+            {
+                for (auto rb = layout[b].begin(); !overlaps && rb != layout[b].end(); ++rb)
+                {
+                    overlaps = ra->Overlaps(*rb);
+                }
+            }
+            if (overlaps)
+            {
+                res.push_back(std::pair<int, int>(a, b));
+            }
+        }
+    }
+    return res;
+}
+
+// how Render worked out which jobs wait on which before the sweep
+static std::vector<std::pair<int, int>> ChannelMaps(const Layout& layout, unsigned int channels)
+{
+    std::vector<std::pair<int, int>> res;
+    std::vector<std::set<int>> channelMaps(channels);
+    for (int m = 0; m < (int)layout.size(); m++)
+    {
+        for (auto r = layout[m].begin(); r != layout[m].end(); ++r)
+        {
+            for (unsigned int c = r->start; c <= r->end; c++)
+            {
+                for (auto i = channelMaps[c].begin(); i != channelMaps[c].end(); ++i)
+                {
+                    if (*i != m)
+                    {
+                        res.push_back(std::pair<int, int>(*i, m));
+                    }
+                }
+                channelMaps[c].insert(m);
+            }
+        }
+    }
+    std::sort(res.begin(), res.end());
+    res.erase(std::unique(res.begin(), res.end()), res.end());
+    return res;
+}
+
+static std::vector<std::pair<int, int>> Sweep(const Layout& layout)
+{
+    RangeOverlapSweep sweep;
+    for (int m = 0; m < (int)layout.size(); m++)
+    {
+        for (auto r = layout[m].begin(); r != layout[m].end(); ++r)
+        {
+            sweep.Add(m, *r);
+        }
+    }
+    return sweep.FindOverlaps();
+}
+
+// models laid end to end like a real show with some overlaid on others, some split over
+// several ranges, some a single channel and some sharing an exact range
+static Layout RandomLayout(std::mt19937& rng, int models, unsigned int channels)
+{
+    Layout layout(models);
+    unsigned int each = channels / models;
+    for (int m = 0; m < models; m++)
+    {
+        int kind = rng() % 10;
+        if (kind < 6)
+        {
+            unsigned int start = m * each;
+            // sometimes a gap before the next one
+            unsigned int gap = each > 1 ? rng() % 2 : 0;
+            layout[m].push_back(NodeRange(start, start + each - 1 - gap));
+        }
+        else if (kind < 8)
+        {
+            int pieces = 2 + rng() % 4;
+            for (int p = 0; p < pieces; p++)
+            {
+                unsigned int start = rng() % channels;
+                unsigned int len = 1 + rng() % (each * 2);
+                layout[m].push_back(NodeRange(start, std::min(start + len, channels) - 1));
+            }
+        }
+        else if (kind < 9)
+        {
+            unsigned int c = rng() % channels;
+            layout[m].push_back(NodeRange(c, c));
+        }
+        else if (m > 0)
+        {
+            layout[m] = layout[rng() % m];
+        }
+    }
+    return layout;
+}
+
+static void Compare(const Layout& layout, const char* name)
+{
+    __checks++;
+    auto expected = Pairwise(layout);
+    auto actual = Sweep(layout);
+    if (expected != actual)
+    {
+        printf("FAIL %s: sweep found %d pairs, pairwise found %d\n", name, (int)actual.size(), (int)expected.size());
+        __failures++;
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(2468);
+
+    // touching but not overlapping ranges must not pair up
+    Compare({ { NodeRange(0, 9) }, { NodeRange(10, 19) }, { NodeRange(9, 10) }, { NodeRange(20, 20) }, { NodeRange(20, 20) } }, "edges");
+    Compare({ {}, { NodeRange(0, 100) }, {} }, "empty models");
+
+    for (int i = 0; i < 500; i++)
+    {
+        char name[64];
+        snprintf(name, sizeof(name), "random layout %d", i);
+        Compare(RandomLayout(rng, 1 + rng() % 60, 100 + rng() % 5000), name);
+    }
+
+    // the size of layout the request asked about
+    Layout big = RandomLayout(rng, 1000, 1000000);
+    // the sweep goes first so it is not timed while a million sets are being given back
+    long long start = NowUS();
+    auto actual = Sweep(big);
+    long long sweepUS = NowUS() - start;
+    start = NowUS();
+    auto expected = Pairwise(big);
+    long long pairwiseUS = NowUS() - start;
+    start = NowUS();
+    auto perChannel = ChannelMaps(big, 1000000);
+    long long channelMapsUS = NowUS() - start;
+    __checks++;
+    if (expected != actual || perChannel != actual)
+    {
+        printf("FAIL 1M channel layout: sweep found %d pairs, pairwise found %d, set per channel found %d\n",
+            (int)actual.size(), (int)expected.size(), (int)perChannel.size());
+        __failures++;
+    }
+    printf("1M channels, 1000 models, %d overlapping pairs: sweep %.1fms, pairwise %.1fms, set per channel %.1fms\n",
+        (int)actual.size(), sweepUS / 1000.0, pairwiseUS / 1000.0, channelMapsUS / 1000.0);
+
+    printf("%d checks, %d failures\n", __checks, __failures);
+    return __failures == 0 ? 0 : 1;
+}
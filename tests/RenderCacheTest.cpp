@@ -0,0 +1,239 @@
+// Renders made up models into SequenceData cold and again with some of them copied
+// back from the render cache and checks both leave exactly the same bytes, whether
+// or not the render clears first and whatever the frames held before
+
+#include <cstring>
+
+#include "RenderCache.h"
+#include "SequenceData.h"
+
+#include <wx/filename.h>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+static int __failures = 0;
+static int __checks = 0;
+
+static void Check(bool ok, const std::string& what)
+{
+    __checks++;
+    if (!ok)
+    {
+        printf("FAIL %s\n", what.c_str());
+        __failures++;
+    }
+}
+
+// stands in for the effects ... each model's output depends on its key and on whatever
+// the models rendered before it left on shared channels, like model blending
+static void Render(const std::vector<RenderCache::Entry>& models, const std::vector<bool>& skip, SequenceData& seqData)
+{
+    for (unsigned int frame = 0; frame < seqData.NumFrames(); frame++)
+    {
+        FrameData fd = seqData[frame];
+        std::vector<bool> written(seqData.NumChannels(), false);
+        for (size_t m = 0; m < models.size(); m++)
+        {
+            if (skip[m]) continue;
+            for (auto r = models[m].ranges.begin(); r != models[m].ranges.end(); ++r)
+            {
+                for (unsigned int ch = r->start; ch <= r->end; ch++)
+                {
+                    RenderCache::Hasher h;
+                    h.Add((long long)models[m].key);
+                    h.Add((long long)frame * 1000003 + ch);
+                    unsigned char v = h.Get() & 0xFF;
+                    fd[ch] = written[ch] ? (fd[ch] + v) / 2 : v;
+                    written[ch] = true;
+                }
+            }
+        }
+    }
+}
+
+static std::vector<std::pair<int, int>> Overlaps(const std::vector<RenderCache::Entry>& models)
+{
+    RangeOverlapSweep sweep;
+    for (size_t m = 0; m < models.size(); m++)
+    {
+        for (auto r = models[m].ranges.begin(); r != models[m].ranges.end(); ++r)
+        {
+            sweep.Add(m, *r);
+        }
+    }
+    return sweep.FindOverlaps();
+}
+
+// models with gaps between them, so some channels belong to no model, and some overlaid on others
+static std::vector<RenderCache::Entry> RandomModels(std::mt19937& rng, unsigned int channels)
+{
+    std::vector<RenderCache::Entry> models;
+    unsigned int ch = rng() % 10;
+    int n = 0;
+    while (ch < channels)
+    {
+        RenderCache::Entry entry;
+        entry.model = "Model " + std::to_string(n++);
+        entry.key = ((uint64_t)rng() << 32) | rng();
+        unsigned int len = 1 + rng() % 40;
+        entry.ranges.push_back(NodeRange(ch, std::min(ch + len, channels) - 1));
+        if (rng() % 5 == 0)
+        {
+            unsigned int start = rng() % channels;
+            entry.ranges.push_back(NodeRange(start, std::min(start + 1 + (unsigned int)(rng() % 20), channels) - 1));
+        }
+        models.push_back(entry);
+        ch += len + rng() % 15;
+    }
+    return models;
+}
+
+static void Fill(std::mt19937& rng, SequenceData& seqData)
+{
+    for (unsigned int frame = 0; frame < seqData.NumFrames(); frame++)
+    {
+        FrameData fd = seqData[frame];
+        for (unsigned int ch = 0; ch < seqData.NumChannels(); ch++)
+        {
+            fd[ch] = rng() % 256;
+        }
+    }
+}
+
+static bool Same(const SequenceData& a, const SequenceData& b)
+{
+    for (unsigned int frame = 0; frame < a.NumFrames(); frame++)
+    {
+        if (memcmp(a[frame][0], b[frame][0], a.NumChannels()) != 0) return false;
+    }
+    return true;
+}
+
+static void Copy(const SequenceData& from, SequenceData& to)
+{
+    to.init(from.NumChannels(), from.NumFrames(), from.FrameTime());
+    for (unsigned int frame = 0; frame < from.NumFrames(); frame++)
+    {
+        memcpy(&to[frame][0], from[frame][0], from.NumChannels());
+    }
+}
+
+// what a render that starts from before and ignores the cache leaves behind
+static void Cold(const std::vector<RenderCache::Entry>& models, const SequenceData& before, const std::vector<NodeRange>& clearRanges, SequenceData& seqData)
+{
+    Copy(before, seqData);
+    RenderCache none;
+    none.Restore(models, Overlaps(models), clearRanges, seqData);
+    Render(models, std::vector<bool>(models.size(), false), seqData);
+}
+
+// what Render does with the cache ... returns how many models were loaded
+static int Cached(RenderCache& cache, const std::vector<RenderCache::Entry>& models, const SequenceData& before, const std::vector<NodeRange>& clearRanges, SequenceData& seqData)
+{
+    Copy(before, seqData);
+    std::vector<bool> loaded = cache.Restore(models, Overlaps(models), clearRanges, seqData);
+    Render(models, loaded, seqData);
+    int count = 0;
+    for (size_t m = 0; m < loaded.size(); m++)
+    {
+        if (loaded[m]) count++;
+    }
+    return count;
+}
+
+// saves from a copy that is scribbled over straight away ... Save must have taken what it
+// needs before it returns as the next render can start while it is still writing
+static void SaveAll(std::mt19937& rng, RenderCache& cache, const std::vector<RenderCache::Entry>& models, const SequenceData& seqData)
+{
+    std::vector<std::string> keep;
+    for (auto it = models.begin(); it != models.end(); ++it)
+    {
+        keep.push_back(it->model);
+    }
+    SequenceData scratch;
+    Copy(seqData, scratch);
+    cache.Save(models, keep, scratch);
+    Fill(rng, scratch);
+    cache.Wait();
+}
+
+// returns true if the edited render took some models from the cache and rendered others
+static bool TestRound(std::mt19937& rng, RenderCache& cache, bool clear, int round)
+{
+    std::string name = std::string(clear ? "clearing" : "not clearing") + " round " + std::to_string(round);
+    unsigned int channels = 50 + rng() % 500;
+    SequenceData before;
+    before.init(channels, 5 + rng() % 30, 50);
+    // whatever the last render or a deleted model left behind
+    Fill(rng, before);
+    std::vector<NodeRange> clearRanges;
+    if (clear)
+    {
+        // the same past the end range Render uses
+        clearRanges.push_back(NodeRange(0, channels));
+    }
+
+    std::vector<RenderCache::Entry> models = RandomModels(rng, channels);
+    SequenceData first;
+    Cold(models, before, clearRanges, first);
+    SaveAll(rng, cache, models, first);
+
+    // nothing changed ... everything comes from the cache
+    SequenceData expected;
+    SequenceData actual;
+    Cold(models, before, clearRanges, expected);
+    int loaded = Cached(cache, models, before, clearRanges, actual);
+    Check(loaded == (int)models.size(), name + ": unchanged models all come from the cache");
+    Check(Same(expected, actual), name + ": all from the cache matches a cold render");
+
+    // edit a few models ... they and anything sharing channels with them render, the rest load
+    for (auto it = models.begin(); it != models.end(); ++it)
+    {
+        if (rng() % 4 == 0) it->key++;
+    }
+    Cold(models, before, clearRanges, expected);
+    loaded = Cached(cache, models, before, clearRanges, actual);
+    Check(Same(expected, actual), name + ": " + std::to_string(loaded) + " of " + std::to_string(models.size()) + " from the cache matches a cold render");
+    bool mixed = loaded > 0 && loaded < (int)models.size();
+
+    // and the render after that starts from what this one left
+    SaveAll(rng, cache, models, actual);
+    Copy(actual, before);
+    Cold(models, before, clearRanges, expected);
+    loaded = Cached(cache, models, before, clearRanges, actual);
+    Check(loaded == (int)models.size() && Same(expected, actual), name + ": the next render matches too");
+
+    // a model left out of a save is pruned once the writing is done
+    Check(cache.Matches(models.back().model, models.back().key, actual.NumFrames(), models.back().ranges), name + ": the last model is in the cache");
+    std::vector<RenderCache::Entry> kept(models.begin(), models.end() - 1);
+    SaveAll(rng, cache, kept, actual);
+    Check(!cache.Matches(models.back().model, models.back().key, actual.NumFrames(), models.back().ranges), name + ": a model left out of a save is pruned");
+
+    // and everything else goes
+    std::vector<std::string> keep;
+    cache.Prune(keep);
+    return mixed;
+}
+
+int main()
+{
+    std::mt19937 rng(8642);
+    std::string sequence = (wxFileName::GetTempDir() + wxFileName::GetPathSeparator() + "xLightsRenderCacheTest.xsq").ToStdString();
+    RenderCache cache;
+    cache.SetSequence(sequence);
+
+    int mixed = 0;
+    for (int round = 0; round < 40; round++)
+    {
+        if (TestRound(rng, cache, round % 2 == 0, round)) mixed++;
+    }
+    Check(mixed > 20, "most edited renders mix cached and rendered models");
+
+    wxFileName fn(sequence);
+    wxRmdir(fn.GetPath() + wxFileName::GetPathSeparator() + fn.GetName() + "_RenderCache");
+
+    printf("%d checks, %d failures\n", __checks, __failures);
+    return __failures == 0 ? 0 : 1;
+}
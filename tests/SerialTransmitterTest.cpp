@@ -0,0 +1,237 @@
+// Runs SerialTransmitter against a pseudo terminal opened through SerialPort and
+// reads the other end to check whole frames arrive in order, a slow port drops
+// old frames rather than queueing them and the last frame goes out on Stop
+
+#include "outputs/SerialTransmitter.h"
+#include "outputs/serial.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <pty.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+
+#define FRAME_SIZE 513
+
+static int __failures = 0;
+static int __checks = 0;
+
+static void Check(bool ok, const std::string& what)
+{
+    __checks++;
+    if (!ok)
+    {
+        printf("FAIL %s\n", what.c_str());
+        __failures++;
+    }
+}
+
+// the controller end of the port
+class Reader
+{
+    int _fd;
+    std::thread _thread;
+    std::atomic<bool> _stop;
+    std::atomic<bool> _paused;
+    std::mutex _lock;
+    std::vector<wxByte> _received;
+
+    void Run()
+    {
+        wxByte buffer[4096];
+        while (!_stop)
+        {
+            if (_paused)
+            {
+                usleep(1000);
+                continue;
+            }
+            pollfd pfd = { _fd, POLLIN, 0 };
+            if (poll(&pfd, 1, 10) <= 0) continue;
+            int n = read(_fd, buffer, sizeof(buffer));
+            if (n <= 0) continue;
+            std::unique_lock<std::mutex> lock(_lock);
+            _received.insert(_received.end(), buffer, buffer + n);
+        }
+    }
+
+public:
+    Reader(int fd) : _fd(fd), _stop(false), _paused(false)
+    {
+        _thread = std::thread([this]() { Run(); });
+    }
+
+    ~Reader()
+    {
+        _stop = true;
+        _thread.join();
+    }
+
+    void Pause(bool pause) { _paused = pause; }
+
+    // waits for the port to go quiet then hands back everything read
+    std::vector<wxByte> Take()
+    {
+        size_t last = (size_t)-1;
+        for (;;)
+        {
+            usleep(50000);
+            std::unique_lock<std::mutex> lock(_lock);
+            if (_received.size() == last) break;
+            last = _received.size();
+        }
+        std::unique_lock<std::mutex> lock(_lock);
+        std::vector<wxByte> res;
+        res.swap(_received);
+        return res;
+    }
+};
+
+// every byte of frame n is n so a frame that arrives torn or out of order shows up
+static void Send(SerialTransmitter& transmitter, wxByte n)
+{
+    std::vector<wxByte> frame(FRAME_SIZE, n);
+    transmitter.Send(&frame[0], frame.size());
+}
+
+static bool Frames(const std::vector<wxByte>& received, std::vector<wxByte>& frames)
+{
+    frames.clear();
+    if (received.size() % FRAME_SIZE != 0) return false;
+    for (size_t f = 0; f < received.size(); f += FRAME_SIZE)
+    {
+        for (size_t i = 1; i < FRAME_SIZE; i++)
+        {
+            if (received[f + i] != received[f]) return false;
+        }
+        frames.push_back(received[f]);
+    }
+    return true;
+}
+
+static bool InOrder(const std::vector<wxByte>& frames)
+{
+    for (size_t i = 1; i < frames.size(); i++)
+    {
+        if (frames[i] <= frames[i - 1]) return false;
+    }
+    return true;
+}
+
+static void TestSteadyStream(SerialPort& port, Reader& reader)
+{
+    SerialTransmitter transmitter(&port, "pty", 115200);
+    Check(transmitter.Start(), "transmitter starts");
+
+    for (int n = 1; n <= 200; n++)
+    {
+        Send(transmitter, n);
+        usleep(1000);
+    }
+    transmitter.Stop();
+    Check(!transmitter.IsRunning(), "transmitter stops");
+
+    std::vector<wxByte> frames;
+    bool whole = Frames(reader.Take(), frames);
+    auto stats = transmitter.GetStats();
+    Check(whole, "frames arrive whole");
+    Check(InOrder(frames), "frames arrive in order");
+    Check(stats.errors == 0, "no write errors");
+    Check(stats.frames == frames.size(), "every frame written arrives");
+    Check(stats.frames + stats.dropped == 200, "every frame is either written or dropped");
+    Check(!frames.empty() && frames.back() == 200, "the last frame arrives");
+    printf("steady: %d written, %d dropped, slowest write %ldus, worst latency %ldus\n",
+        (int)stats.frames, (int)stats.dropped, stats.maxWriteUS, stats.maxLatencyUS);
+}
+
+static void TestSlowPort(SerialPort& port, Reader& reader)
+{
+    SerialTransmitter transmitter(&port, "pty", 115200);
+    transmitter.Start();
+
+    // the port stops taking data ... new frames must replace the waiting one not queue up
+    reader.Pause(true);
+    for (int n = 1; n <= 100; n++)
+    {
+        Send(transmitter, n);
+        usleep(2000);
+    }
+    reader.Pause(false);
+    transmitter.Stop();
+
+    std::vector<wxByte> frames;
+    bool whole = Frames(reader.Take(), frames);
+    auto stats = transmitter.GetStats();
+    Check(whole, "frames arrive whole from a slow port");
+    Check(InOrder(frames), "frames arrive in order from a slow port");
+    Check(stats.dropped > 0, "a slow port drops frames");
+    Check(stats.frames + stats.dropped == 100, "a slow port accounts for every frame");
+    Check(!frames.empty() && frames.back() == 100, "the newest frame wins on a slow port");
+    printf("slow: %d written, %d dropped, slowest write %ldus\n", (int)stats.frames, (int)stats.dropped, stats.maxWriteUS);
+}
+
+static void TestStopFlushes(SerialPort& port, Reader& reader)
+{
+    SerialTransmitter transmitter(&port, "pty", 115200);
+
+    Send(transmitter, 1);
+    Check(transmitter.GetStats().frames == 0 && transmitter.GetStats().dropped == 0, "frames sent before Start are ignored");
+
+    // the blackout sent as playback ends must not be lost
+    for (int round = 0; round < 20; round++)
+    {
+        transmitter.Start();
+        Send(transmitter, 10);
+        Send(transmitter, 20 + round);
+        transmitter.Stop();
+
+        std::vector<wxByte> frames;
+        Frames(reader.Take(), frames);
+        if (frames.empty() || frames.back() != 20 + round)
+        {
+            Check(false, "the frame waiting at Stop goes out");
+            return;
+        }
+    }
+    Check(true, "the frame waiting at Stop goes out");
+}
+
+int main()
+{
+    int master;
+    int slave;
+    if (openpty(&master, &slave, nullptr, nullptr, nullptr) != 0)
+    {
+        printf("Unable to open a pseudo terminal ... skipped\n");
+        return 0;
+    }
+    std::string name = ttyname(slave);
+
+    SerialPort port;
+    if (port.Open(name, 115200) < 0)
+    {
+        printf("FAIL unable to open %s\n", name.c_str());
+        return 1;
+    }
+    // SerialPort has its own handle now
+    close(slave);
+
+    {
+        Reader reader(master);
+        TestSteadyStream(port, reader);
+        TestSlowPort(port, reader);
+        TestStopFlushes(port, reader);
+    }
+
+    port.Close();
+    close(master);
+
+    printf("%d checks, %d failures\n", __checks, __failures);
+    return __failures == 0 ? 0 : 1;
+}
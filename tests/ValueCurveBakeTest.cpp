@@ -0,0 +1,145 @@
+// Checks that a baked value curve gives the same values as working the curve out
+// exactly, to within VALUECURVE_BAKED_ERROR, for every curve type
+
+#include "ValueCurve.h"
+
+#include <cstdio>
+#include <cmath>
+#include <string>
+#include <vector>
+
+struct Parameters
+{
+    float p1;
+    float p2;
+    float p3;
+    float p4;
+};
+
+static int __failures = 0;
+static int __checks = 0;
+
+static void Compare(ValueCurve& exact, ValueCurve& baked, const std::string& name)
+{
+    if (!baked.IsBaked())
+    {
+        printf("FAIL %s: curve was not baked\n", name.c_str());
+        __failures++;
+        return;
+    }
+
+    std::vector<float> offsets = { -0.5f, 0.0f, 1.0f, 1.5f };
+    for (int i = 0; i <= 100000; i++)
+    {
+        offsets.push_back((float)i / 100000.0f);
+    }
+    // either side of every sample and every point
+    for (int i = 0; i <= VALUECURVE_BAKED_SIZE; i++)
+    {
+        float x = (float)i / VALUECURVE_BAKED_SIZE;
+        offsets.push_back(std::nextafter(x, -1.0f));
+        offsets.push_back(std::nextafter(x, 2.0f));
+    }
+    auto points = exact.GetPoints();
+    for (auto it = points.begin(); it != points.end(); ++it)
+    {
+        offsets.push_back(std::nextafter(it->x, -1.0f));
+        offsets.push_back(it->x);
+        offsets.push_back(std::nextafter(it->x, 2.0f));
+    }
+
+    float worst = 0.0f;
+    float worstAt = 0.0f;
+    for (auto it = offsets.begin(); it != offsets.end(); ++it)
+    {
+        float e = exact.GetValueAt(*it);
+        float b = baked.GetValueAt(*it);
+        float error = std::abs(e - b);
+        if (error > worst)
+        {
+            worst = error;
+            worstAt = *it;
+        }
+        __checks++;
+    }
+
+    if (worst > VALUECURVE_BAKED_ERROR)
+    {
+        printf("FAIL %s: baked value is %f out at %f\n", name.c_str(), worst, worstAt);
+        __failures++;
+    }
+}
+
+static void Check(const std::string& type, const Parameters& p, bool wrap)
+{
+    ValueCurve exact("test", 0.0f, 100.0f, type, p.p1, p.p2, p.p3, p.p4, wrap);
+    exact.SetActive(true);
+    ValueCurve baked("test", 0.0f, 100.0f, type, p.p1, p.p2, p.p3, p.p4, wrap);
+    baked.SetActive(true);
+    baked.SetBaked(true);
+
+    char name[256];
+    snprintf(name, sizeof(name), "%s P1=%g P2=%g P3=%g P4=%g%s", type.c_str(), p.p1, p.p2, p.p3, p.p4, wrap ? " wrapped" : "");
+    Compare(exact, baked, name);
+}
+
+static void CheckCustom(const std::vector<std::pair<float, float>>& points, const std::string& name)
+{
+    ValueCurve exact("test", 0.0f, 100.0f, "Custom");
+    ValueCurve baked("test", 0.0f, 100.0f, "Custom");
+    exact.SetActive(true);
+    baked.SetActive(true);
+    for (auto it = points.begin(); it != points.end(); ++it)
+    {
+        exact.SetValueAt(it->first, it->second);
+        baked.SetValueAt(it->first, it->second);
+    }
+    // points set after baking must be seen too
+    baked.SetBaked(true);
+    Compare(exact, baked, "Custom " + name);
+
+    ValueCurve rebaked("test", 0.0f, 100.0f, "Custom");
+    rebaked.SetActive(true);
+    rebaked.SetBaked(true);
+    for (auto it = points.begin(); it != points.end(); ++it)
+    {
+        rebaked.SetValueAt(it->first, it->second);
+    }
+    Compare(exact, rebaked, "Custom " + name + " set while baked");
+}
+
+int main()
+{
+    std::vector<std::string> types = {
+        "Flat", "Ramp", "Ramp Up/Down", "Ramp Up/Down Hold", "Saw Tooth", "Square",
+        "Parabolic Down", "Parabolic Up", "Logarithmic Up", "Logarithmic Down",
+        "Exponential Up", "Exponential Down", "Sine", "Abs Sine"
+    };
+
+    std::vector<Parameters> parameters = {
+        { 0, 0, 0, 0 },
+        { 0, 100, 0, 0 },
+        { 100, 0, 50, 50 },
+        { 25, 75, 10, 50 },
+        { 10, 90, 1, 0 },
+        { 50, 50, 100, 100 },
+        { 33, 67, 7, 80 },
+        { 75, 20, 3, 25 },
+    };
+
+    for (auto t = types.begin(); t != types.end(); ++t)
+    {
+        for (auto p = parameters.begin(); p != parameters.end(); ++p)
+        {
+            Check(*t, *p, false);
+            Check(*t, *p, true);
+        }
+    }
+
+    CheckCustom({ { 0.0f, 0.0f }, { 1.0f, 1.0f } }, "line");
+    CheckCustom({ { 0.0f, 0.2f }, { 0.3f, 0.9f }, { 0.31f, 0.1f }, { 1.0f, 0.5f } }, "step");
+    CheckCustom({ { 0.0f, 1.0f }, { 0.5f, 0.0f }, { 0.75f, 1.0f }, { 1.0f, 0.0f } }, "zig zag");
+
+    printf("%d checks, %d failures\n", __checks, __failures);
+    return __failures == 0 ? 0 : 1;
+}
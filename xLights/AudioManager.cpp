@@ -5,9 +5,11 @@
 #include <wx/string.h>
 #include <wx/ffile.h>
 #include <wx/log.h>
+#include <wx/thread.h>
 #include <math.h>
 #include <stdlib.h>
 #include "kiss_fft/tools/kiss_fftr.h"
+#include <condition_variable>
 #include <log4cpp/Category.hh>
 
 using namespace Vamp;
@@ -541,7 +543,8 @@ AudioManager::AudioManager(const std::string& audio_file, int step, int block)
 	_data[0] = nullptr; // Left channel data
 	_data[1] = nullptr; // right channel data
 	_intervalMS = -1; // no length
-	_frameDataPrepared = false; // frame data is used by effects to react to the sone
+	_frameData = nullptr; // frame data is used by effects to react to the sone
+	_frameDataProgress = 0;
 	_media_state = MEDIAPLAYINGSTATE::STOPPED;
 	_pcmdata = nullptr;
 	_polyphonicTranscriptionDone = false;
@@ -566,58 +569,183 @@ AudioManager::AudioManager(const std::string& audio_file, int step, int block)
 	}
 }
 
-std::list<float> AudioManager::CalculateSpectrumAnalysis(const float* in, int n, float& max, int id)
+// Spectrum analysis of a whole song.  The MIDI note bucket boundaries for the window size are worked
+// out once, then the windows are analysed in chunks by the calling thread and helper jobs on the
+// audio job pool.  Each window produces SPECTRUM_NOTES values in spectra.
+#define SPECTRUM_NOTES 127
+#define SPECTRUM_CHUNK 64
+
+class SpectrumAnalysis
+{
+public:
+	SpectrumAnalysis(AudioManager* audio, int step, int windows, std::atomic<int>* progress);
+
+	int GetChunks() const { return (_windows + SPECTRUM_CHUNK - 1) / SPECTRUM_CHUNK; }
+	void ProcessChunks();
+	void WaitForChunks();
+
+	std::vector<float> spectra; // windows * SPECTRUM_NOTES
+	std::vector<float> maxes;   // largest value in each window
+	std::vector<uint8_t> valid; // 0 if the window had no data
+
+private:
+	void Analyse(kiss_fftr_cfg cfg, kiss_fft_cpx* out, int window);
+
+	AudioManager* _audio;
+	int _step;
+	int _windows;
+	int _outcount;
+	std::vector<int> _start; // fft bucket range for each note
+	std::vector<int> _end;
+	std::atomic<int>* _progress;
+	std::atomic<int> _nextChunk;
+	std::atomic<int> _windowsDone;
+	std::mutex _lock;
+	std::condition_variable _signal;
+	int _chunksDone;
+};
+
+class SpectrumAnalysisJob : public Job
+{
+	std::shared_ptr<SpectrumAnalysis> _analysis;
+
+public:
+	SpectrumAnalysisJob(std::shared_ptr<SpectrumAnalysis> analysis) : _analysis(analysis) {}
+	virtual ~SpectrumAnalysisJob() {}
+	virtual void Process() override { _analysis->ProcessChunks(); }
+	virtual std::string GetStatus() override { return "Spectrum analysis."; }
+	virtual bool DeleteWhenComplete() override { return true; }
+};
+
+SpectrumAnalysis::SpectrumAnalysis(AudioManager* audio, int step, int windows, std::atomic<int>* progress)
+	: _audio(audio), _step(step), _windows(windows), _progress(progress), _nextChunk(0), _windowsDone(0), _chunksDone(0)
+{
+	spectra.resize((size_t)windows * SPECTRUM_NOTES);
+	maxes.resize(windows, 0.0f);
+	valid.resize(windows, 0);
+
+	// choose the right buckets for each MIDI note
+	_outcount = step / 2 + 1;
+	long rate = audio->GetRate();
+	for (int j = 0; j < SPECTRUM_NOTES; j++)
+	{
+		double freq = 440.0 * exp2f(((double)j - 69.0) / 12.0);
+		double freqnext = 440.0 * exp2f(((double)j + 1.0 - 69.0) / 12.0);
+		_start.push_back((int)(freq * (double)step / (double)rate));
+		_end.push_back((int)(freqnext * (double)step / (double)rate));
+	}
+}
+
+void SpectrumAnalysis::Analyse(kiss_fftr_cfg cfg, kiss_fft_cpx* out, int window)
 {
-	std::list<float> res;
-	int outcount = n / 2 + 1;
-	kiss_fftr_cfg cfg;
-	kiss_fft_cpx* out = (kiss_fft_cpx*)malloc(sizeof(kiss_fft_cpx) * (outcount));
-	if (out != nullptr)
+	const float* in = _audio->GetLeftDataPtr(window * _step);
+	if (in == nullptr)
+	{
+		return;
+	}
+
+	kiss_fftr(cfg, in, out);
+
+	float* res = &spectra[(size_t)window * SPECTRUM_NOTES];
+	float max = 0.0;
+	for (int j = 0; j < SPECTRUM_NOTES; j++)
 	{
-		if ((cfg = kiss_fftr_alloc(n, 0/*is_inverse_fft*/, NULL, nullptr)) != nullptr)
+		float val = 0.0;
+
+		// got through all buckets up to the next note and take the maximums
+		if (_end[j] < _outcount - 1)
 		{
-			kiss_fftr(cfg, in, out);
-			free(cfg);
+			for (int k = _start[j]; k <= _end[j]; k++)
+			{
+				kiss_fft_cpx* cur = out + k;
+				val = std::max(val, sqrtf(cur->r * cur->r + cur->i * cur->i));
+			}
 		}
 
-		for (int j = 0; j < 127; j++)
+		float db = log10(val);
+		if (db < 0.0)
 		{
-            // choose the right bucket for this MIDI note
-            double freq = 440.0 * exp2f(((double)j - 69.0) / 12.0);
-            int start = freq * (double)n / (double)_rate;
-            double freqnext = 440.0 * exp2f(((double)j + 1.0 - 69.0) / 12.0);
-            int end = freqnext * (double)n / (double)_rate;
+			db = 0.0;
+		}
 
-            float val = 0.0;
+		res[j] = db;
+		if (db > max)
+		{
+			max = db;
+		}
+	}
+	maxes[window] = max;
+	valid[window] = 1;
+}
 
-            // got through all buckets up to the next note and take the maximums
-            if (end < outcount-1)
-            {
-                for (int k = start; k <= end; k++)
-                {
-                    kiss_fft_cpx* cur = out + k;
-                    val = std::max(val, sqrtf(cur->r * cur->r + cur->i * cur->i));
-                    //float valscaled = valnew * scaling;
-                }
-            }
+void SpectrumAnalysis::ProcessChunks()
+{
+	// kiss_fftr keeps its scratch space in the plan so every thread needs its own
+	kiss_fftr_cfg cfg = nullptr;
+	kiss_fft_cpx* out = nullptr;
 
-			float db = log10(val);
-			if (db < 0.0)
-			{
-				db = 0.0;
-			}
+	int chunks = GetChunks();
+	for (int chunk = _nextChunk++; chunk < chunks; chunk = _nextChunk++)
+	{
+		if (cfg == nullptr)
+		{
+			cfg = kiss_fftr_alloc(_step, 0/*is_inverse_fft*/, NULL, nullptr);
+			out = (kiss_fft_cpx*)malloc(sizeof(kiss_fft_cpx) * _outcount);
+		}
 
-			res.push_back(db);
-			if (db > max)
+		int first = chunk * SPECTRUM_CHUNK;
+		int last = std::min(first + SPECTRUM_CHUNK, _windows);
+		if (cfg != nullptr && out != nullptr)
+		{
+			for (int w = first; w < last; w++)
 			{
-				max = db;
+				Analyse(cfg, out, w);
 			}
 		}
 
+		int done = (_windowsDone += last - first);
+		*_progress = (int)((int64_t)done * 100 / _windows);
+
+		std::unique_lock<std::mutex> locker(_lock);
+		_chunksDone++;
+		_signal.notify_all();
+	}
+
+	if (cfg != nullptr)
+	{
+		free(cfg);
+	}
+	if (out != nullptr)
+	{
 		free(out);
 	}
+}
+
+void SpectrumAnalysis::WaitForChunks()
+{
+	std::unique_lock<std::mutex> locker(_lock);
+	while (_chunksDone < GetChunks())
+	{
+		_signal.wait(locker);
+	}
+}
+
+void AudioManager::CalculateSpectrumAnalysis(int step, int windows, std::vector<float>& spectra, std::vector<float>& maxes, std::vector<uint8_t>& valid)
+{
+	std::shared_ptr<SpectrumAnalysis> analysis = std::make_shared<SpectrumAnalysis>(this, step, windows, &_frameDataProgress);
+
+	// this thread works through the chunks too so nothing waits on the pool having a free thread
+	int helpers = std::min(analysis->GetChunks() - 1, (int)wxThread::GetCPUCount() - 1);
+	for (int i = 0; i < helpers; i++)
+	{
+		_jobPool.PushJob(new SpectrumAnalysisJob(analysis));
+	}
+	analysis->ProcessChunks();
+	analysis->WaitForChunks();
 
-	return res;
+	spectra.swap(analysis->spectra);
+	maxes.swap(analysis->maxes);
+	valid.swap(analysis->valid);
 }
 
 void AudioManager::DoPolyphonicTranscription(wxProgressDialog* dlg, AudioManagerProgressCallback fn)
@@ -636,6 +764,12 @@ void AudioManager::DoPolyphonicTranscription(wxProgressDialog* dlg, AudioManager
     logger_pianodata.debug("Interval %d.", _intervalMS);
     logger_pianodata.debug("BitRate %d.", GetRate());
 
+    // the notes are added to a copy of the rest of the frame data
+    if (_frameData.load() == nullptr)
+    {
+        PrepareFrameData(false);
+    }
+
     // Initialise Polyphonic Transcription
     _vamp.GetAllAvailablePlugins(this); // this initialises Vamp
     Vamp::Plugin* pt = _vamp.GetPlugin("Polyphonic Transcription");
@@ -705,6 +839,8 @@ void AudioManager::DoPolyphonicTranscription(wxProgressDialog* dlg, AudioManager
         }
 
         // Process the Polyphonic Transcription
+        const FrameDataStore* current = _frameData.load();
+        std::vector<std::vector<float>> notes(current->GetFrames());
         try
         {
             unsigned int total = 0;
@@ -733,9 +869,9 @@ void AudioManager::DoPolyphonicTranscription(wxProgressDialog* dlg, AudioManager
                 if (currentstart - sframe * _intervalMS > _intervalMS / 2) {
                     sframe++;
                 }
-                int eframe = currentend / _intervalMS;
+                int eframe = std::min(currentend / _intervalMS, (int)notes.size() - 1);
                 while (sframe <= eframe) {
-                    _frameData[sframe][4].push_back(features[0][j].values[0]);
+                    notes[sframe].push_back(features[0][j].values[0]);
                     sframe++;
                 }
             }
@@ -746,11 +882,11 @@ void AudioManager::DoPolyphonicTranscription(wxProgressDialog* dlg, AudioManager
             {
                 logger_pianodata.debug("Piano data calculated:");
                 logger_pianodata.debug("Time MS, Keys");
-                for (size_t i = 0; i < _frameData.size(); i++)
+                for (size_t i = 0; i < notes.size(); i++)
                 {
                     int ms = i * _intervalMS;
                     std::string keys = "";
-                    for (auto it2 = _frameData[i][4].begin(); it2 != _frameData[i][4].end(); ++it2)
+                    for (auto it2 = notes[i].begin(); it2 != notes[i].end(); ++it2)
                     {
                         keys += " " + std::string(wxString::Format("%f", *it2).c_str());
                     }
@@ -764,6 +900,28 @@ void AudioManager::DoPolyphonicTranscription(wxProgressDialog* dlg, AudioManager
             logger_base.warn("Polyphonic Transcription threw an error getting the remaining features.");
         }
 
+        // publish a new store with the notes included
+        {
+            std::unique_lock<std::mutex> locker(_mutex);
+            current = _frameData.load();
+            size_t frames = current->GetFrames();
+            std::vector<std::vector<float>> slots(frames * FrameDataStore::SLOTS);
+            const FRAMEDATATYPE types[] = { FRAMEDATA_HIGH, FRAMEDATA_LOW, FRAMEDATA_SPREAD, FRAMEDATA_VU };
+            for (size_t i = 0; i < frames; i++)
+            {
+                for (int t = 0; t < FrameDataStore::SLOT_NOTES; t++)
+                {
+                    const FrameDataSpan* span = current->Get(i, types[t]);
+                    slots[i * FrameDataStore::SLOTS + t].assign(span->begin(), span->end());
+                }
+                if (i < notes.size())
+                {
+                    slots[i * FrameDataStore::SLOTS + FrameDataStore::SLOT_NOTES].swap(notes[i]);
+                }
+            }
+            PublishFrameData(slots, frames);
+        }
+
         //done with VAMP Polyphonic Transcriber
         delete pt;
     }
@@ -779,10 +937,10 @@ void AudioManager::DoPrepareFrameData()
     logger_base.info("Start processing audio frame data.");
 
 	// lock the mutex
-    std::unique_lock<std::shared_timed_mutex> locker(_mutex);
+    std::unique_lock<std::mutex> locker(_mutex);
 
 	// if we have already done it ... bail
-	if (_frameDataPrepared)
+	if (_frameData.load() != nullptr)
 	{
 		logger_base.info("Aborting processing audio frame data ... it has already been done.");
 		return;
@@ -803,75 +961,63 @@ void AudioManager::DoPrepareFrameData()
 	_bigmin = 1;
 	_bigspectogrammax = -1;
 
-	size_t step = 2048;
-	float *pdata[2];
+	int step = 2048;
+
+	// the spectrogram uses fixed size windows, window w covers samples w * step to (w + 1) * step
+	int windows = totalsamples > 0 ? (totalsamples - 1) / step : 0;
+	std::vector<float> spectra;
+	std::vector<float> spectramax;
+	std::vector<uint8_t> spectravalid;
+	_frameDataProgress = 0;
+	CalculateSpectrumAnalysis(step, windows, spectra, spectramax, spectravalid);
 
-	int pos = 0;
-	std::list<float> spectrogram;
+	int window = 0;
+	std::vector<float> spectrogram;
+
+	// built up here then packed into a store once it is complete
+	std::vector<std::vector<float>> slots(frames * FrameDataStore::SLOTS);
 
 	// process each frome of the song
 	for (int i = 0; i < frames; i++)
 	{
-		std::vector<std::list<float>> aFrameData;
-		aFrameData.resize(5); // preallocate the spots we will need
-
 		// accumulators
 		float max = -100.0;
 		float min = 100.0;
 		float spread = -100;
 
 		// clear the data if we are about to get new data ... dont clear it if we wont
-		// this happens because the spectrogram function has a fixed window based on the parameters we set and it
-		// does not match our time slices exactly so we have to select which one to use
-		if (pos < i * samplesperframe + samplesperframe  && pos + step < totalsamples)
+		// this happens because the spectrogram windows do not match our time slices exactly so we take
+		// the windows that start in this frame, or if there are none keep the last frames values
+		if (window < windows && window * step < i * samplesperframe + samplesperframe)
 		{
 			spectrogram.clear();
 		}
 
-		// only get the data if we are not ahead of the music
-		while (pos < i * samplesperframe + samplesperframe && pos + step < totalsamples)
+		while (window < windows && window * step < i * samplesperframe + samplesperframe)
 		{
-			std::list<float> subspectrogram;
-			pdata[0] = GetLeftDataPtr(pos);
-			pdata[1] = GetRightDataPtr(pos);
-			float max2 = 0;
-
-			if (pdata[0] == nullptr)
-			{
-				subspectrogram.clear();
-			}
-			else
-			{
-				subspectrogram = CalculateSpectrumAnalysis(pdata[0], step, max2, i);
-			}
-
 			// and keep track of the larges value so we can normalise it
-			if (max2 > _bigspectogrammax)
+			if (spectramax[window] > _bigspectogrammax)
 			{
-				_bigspectogrammax = max2;
+				_bigspectogrammax = spectramax[window];
 			}
-			pos += step;
 
-			// either take the newly calculated values or if we are merging two results take the maximum of each value
-			if (spectrogram.size() == 0)
-			{
-				spectrogram = subspectrogram;
-			}
-			else
+			// either take the window's values or if we are merging two results take the maximum of each value
+			if (spectravalid[window])
 			{
-				if (subspectrogram.size() > 0)
+				const float* sub = &spectra[(size_t)window * SPECTRUM_NOTES];
+				if (spectrogram.size() == 0)
+				{
+					spectrogram.assign(sub, sub + SPECTRUM_NOTES);
+				}
+				else
 				{
-					std::list<float>::iterator sub = subspectrogram.begin();
-					for (std::list<float>::iterator fr = spectrogram.begin(); fr != spectrogram.end(); ++fr)
+					for (int j = 0; j < SPECTRUM_NOTES; j++)
 					{
-						if (*sub > *fr)
-						{
-							*fr = *sub;
-						}
-						++sub;
+						spectrogram[j] = std::max(spectrogram[j], sub[j]);
 					}
 				}
 			}
+			window++;
 		}
 
 		// now do the raw data analysis for the frame
@@ -912,18 +1058,11 @@ void AudioManager::DoPrepareFrameData()
 		}
 
 		// Now save the results for the frame
-		std::list<float> maxlist;
-		maxlist.push_back(max);
-		std::list<float> minlist;
-		minlist.push_back(min);
-		std::list<float> spreadlist;
-		spreadlist.push_back(spread);
-		aFrameData[0] = maxlist;
-		aFrameData[1] = minlist;
-		aFrameData[2] = spreadlist;
-		aFrameData[3] = spectrogram;
-
-		_frameData.push_back(aFrameData);
+		std::vector<float>* frameData = &slots[i * FrameDataStore::SLOTS];
+		frameData[FrameDataStore::SLOT_HIGH].push_back(max);
+		frameData[FrameDataStore::SLOT_LOW].push_back(min);
+		frameData[FrameDataStore::SLOT_SPREAD].push_back(spread);
+		frameData[FrameDataStore::SLOT_VU].assign(spectrogram.begin(), spectrogram.end());
 	}
 
 	// normalise data ... basically scale the data so the highest value is the scale value.
@@ -932,40 +1071,100 @@ void AudioManager::DoPrepareFrameData()
 	float bigminscale = 1 / (_bigmin * scale);
 	float bigspreadscale = 1 / (_bigspread * scale);
 	float bigspectrogramscale = 1 / (_bigspectogrammax * scale);
-	for (std::vector<std::vector<std::list<float>>>::iterator itframe = _frameData.begin(); itframe != _frameData.end(); ++itframe)
+	for (int i = 0; i < frames; i++)
 	{
-		std::list<float>* fl = &(*itframe)[0];
-		std::list<float>::iterator f = fl->begin();
-		*f = (*f * bigmaxscale);
-
-		fl = &(*itframe)[1];
-		f = fl->begin();
-		*f = (*f * bigminscale);
-
-		fl = &(*itframe)[2];
-		f = fl->begin();
-		*f = (*f * bigspreadscale);
-
-		fl = &(*itframe)[3];
-		for (std::list<float>::iterator ff = fl->begin(); ff != fl->end(); ++ff)
+		std::vector<float>* frameData = &slots[i * FrameDataStore::SLOTS];
+		frameData[FrameDataStore::SLOT_HIGH][0] *= bigmaxscale;
+		frameData[FrameDataStore::SLOT_LOW][0] *= bigminscale;
+		frameData[FrameDataStore::SLOT_SPREAD][0] *= bigspreadscale;
+		for (auto ff = frameData[FrameDataStore::SLOT_VU].begin(); ff != frameData[FrameDataStore::SLOT_VU].end(); ++ff)
 		{
 			*ff = *ff * bigspectrogramscale;
 		}
 	}
 
-	// flag the fact that the data is all ready
-	_frameDataPrepared = true;
+	// publish it ... from here on effects can read it without a lock
+	PublishFrameData(slots, frames);
 
 	logger_base.info("Audio frame data processing complete.");
 }
 
+// Must be called holding _mutex
+void AudioManager::PublishFrameData(const std::vector<std::vector<float>>& slots, size_t frames)
+{
+	FrameDataStore* store = new FrameDataStore(slots, frames);
+
+	// older stores are kept until we are destroyed as a render thread may still be reading one
+	_frameDataStores.push_back(std::unique_ptr<FrameDataStore>(store));
+	_frameData.store(store);
+}
+
+FrameDataStore::FrameDataStore(const std::vector<std::vector<float>>& slots, size_t frames) : _frames(frames)
+{
+	size_t total = 0;
+	for (auto it = slots.begin(); it != slots.end(); ++it)
+	{
+		total += it->size();
+	}
+
+	std::vector<size_t> offsets;
+	offsets.reserve(frames * SLOTS + 1);
+	_values.reserve(total);
+	for (size_t i = 0; i < frames * SLOTS; i++)
+	{
+		offsets.push_back(_values.size());
+		_values.insert(_values.end(), slots[i].begin(), slots[i].end());
+	}
+	offsets.push_back(_values.size());
+
+	// _values wont move again so the spans can point straight into it
+	const float* base = _values.data();
+	_spans.reserve(frames * SLOTS);
+	for (size_t i = 0; i < frames * SLOTS; i++)
+	{
+		_spans.push_back(FrameDataSpan(base + offsets[i], base + offsets[i + 1]));
+	}
+}
+
+const FrameDataSpan* FrameDataStore::Get(int frame, FRAMEDATATYPE fdt) const
+{
+	if (frame < 0 || frame >= (int)_frames)
+	{
+		return nullptr;
+	}
+
+	int slot;
+	switch (fdt)
+	{
+	case FRAMEDATA_HIGH:
+		slot = SLOT_HIGH;
+		break;
+	case FRAMEDATA_LOW:
+		slot = SLOT_LOW;
+		break;
+	case FRAMEDATA_SPREAD:
+		slot = SLOT_SPREAD;
+		break;
+	case FRAMEDATA_VU:
+		slot = SLOT_VU;
+		break;
+	case FRAMEDATA_NOTES:
+		slot = SLOT_NOTES;
+		break;
+	default:
+		// FRAMEDATA_ISTIMINGMARK ... nothing is stored
+		return nullptr;
+	}
+	return &_spans[frame * SLOTS + slot];
+}
+
 // Called to trigger frame data creation
 void AudioManager::PrepareFrameData(bool separateThread)
 {
 	if (separateThread)
 	{
 		// if we have not prepared the frame data and no job has been created
-		if (!_frameDataPrepared && _job == nullptr)
+		if (_frameData.load() == nullptr && _job == nullptr)
 		{
 			_job = (Job*)new AudioScanJob(this);
 			_jobPool.PushJob(_job);
@@ -987,71 +1186,33 @@ void ProgressFunction(wxProgressDialog* pd, int p)
 }
 
 // Get the pre-prepared data for this frame
-std::list<float>* AudioManager::GetFrameData(int frame, FRAMEDATATYPE fdt, std::string timing)
+// This is called from every render thread so it must not take a lock once the data is prepared
+const FrameDataSpan* AudioManager::GetFrameData(int frame, FRAMEDATATYPE fdt, const std::string& timing)
 {
-    // Grab the lock so we can safely access the frame data
-    std::shared_lock<std::shared_timed_mutex> lock(_mutex);
-
+	const FrameDataStore* store = _frameData.load();
 
 	// if the frame data has not been prepared
-	if (!_frameDataPrepared)
+	if (store == nullptr)
 	{
-		// prepare it
-		lock.unlock();
+		// prepare it ... if the background job is already doing it this waits for it to finish
 		PrepareFrameData(false);
 
-        lock.lock();
-		// wait until the new thread grabs the lock
-		while (!_frameDataPrepared)
+		store = _frameData.load();
+		while (store == nullptr)
 		{
-			lock.unlock();
 			wxMilliSleep(5);
-            lock.lock();
+			store = _frameData.load();
 		}
 	}
     if (fdt == FRAMEDATA_NOTES && !_polyphonicTranscriptionDone) {
         //need to do the polyphonic stuff
         wxProgressDialog dlg("Processing Audio", "");
         DoPolyphonicTranscription(&dlg, ProgressFunction);
+        store = _frameData.load();
     }
 
 	// now we can grab the data we need
-	std::list<float>* rc = NULL;
-	try
-	{
-		if (frame < (int)_frameData.size())
-		{
-			std::vector<std::list<float>>* framedata = &_frameData[frame];
-
-			switch (fdt)
-			{
-			case FRAMEDATA_HIGH:
-				rc = &framedata->at(0);
-				break;
-			case FRAMEDATA_LOW:
-				rc = &framedata->at(1);
-				break;
-			case FRAMEDATA_SPREAD:
-				rc = &framedata->at(2);
-				break;
-			case FRAMEDATA_VU:
-				rc = &framedata->at(3);
-				break;
-			case FRAMEDATA_ISTIMINGMARK:
-				// we dont need to do anything here
-				break;
-			case FRAMEDATA_NOTES:
-				rc = &framedata->at(4);
-				break;
-			}
-		}
-	}
-	catch (...)
-	{
-		rc = nullptr;
-	}
-
-	return rc;
+	return store->Get(frame, fdt);
 }
 
 // Constant Bitrate Detection Functions
@@ -1746,6 +1907,15 @@ void AudioScanJob::Process()
 	_status = "Done.";
 }
 
+std::string AudioScanJob::GetStatus()
+{
+	if (_status == "Processing.")
+	{
+		return "Processing " + std::to_string(_audio->GetFrameDataProgress()) + "%.";
+	}
+	return _status;
+}
+
 // xLightsVamp Functions
 xLightsVamp::xLightsVamp()
 {
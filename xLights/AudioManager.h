@@ -3,7 +3,10 @@
 
 #include <string>
 #include <list>
-#include <shared_mutex>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
 
 extern "C"
 {
@@ -34,7 +37,7 @@ public:
 	AudioScanJob(AudioManager* audio);
 	virtual ~AudioScanJob() {};
 	virtual void Process() override;
-	virtual std::string GetStatus() override { return _status; }
+	virtual std::string GetStatus() override;
     virtual bool DeleteWhenComplete() override { return true; }
 };
 
@@ -74,6 +77,41 @@ typedef enum FRAMEDATATYPE {
 	FRAMEDATA_NOTES
 } FRAMEDATATYPE;
 
+// Read only view of the values of one type of frame data for one frame
+class FrameDataSpan
+{
+    const float* _begin;
+    const float* _end;
+
+public:
+    FrameDataSpan() : _begin(nullptr), _end(nullptr) {}
+    FrameDataSpan(const float* begin, const float* end) : _begin(begin), _end(end) {}
+    const float* begin() const { return _begin; }
+    const float* end() const { return _end; }
+    size_t size() const { return _end - _begin; }
+    bool empty() const { return _begin == _end; }
+    float operator[](size_t i) const { return _begin[i]; }
+};
+
+// All the frame data for a song packed frame major into one block of floats.  A store is never
+// changed once it has been published so it can be read from any thread without a lock.
+class FrameDataStore
+{
+public:
+    // slots stored for each frame, FRAMEDATA_ISTIMINGMARK has no data
+    enum { SLOT_HIGH, SLOT_LOW, SLOT_SPREAD, SLOT_VU, SLOT_NOTES, SLOTS };
+
+    FrameDataStore(const std::vector<std::vector<float>>& slots, size_t frames);
+
+    size_t GetFrames() const { return _frames; }
+    const FrameDataSpan* Get(int frame, FRAMEDATATYPE fdt) const;
+
+private:
+    size_t _frames;
+    std::vector<float> _values;
+    std::vector<FrameDataSpan> _spans; // _frames * SLOTS
+};
+
 typedef enum MEDIAPLAYINGSTATE {
 	PLAYING,
 	PAUSED,
@@ -150,8 +188,9 @@ class AudioManager
 {
 	JobPool _jobPool;
 	Job* _job;
-    std::shared_timed_mutex _mutex;
-	std::vector<std::vector<std::list<float>>> _frameData;
+    std::mutex _mutex; // serialises building the frame data, readers dont need it
+	std::atomic<const FrameDataStore*> _frameData; // nullptr until the frame data is prepared
+	std::list<std::unique_ptr<FrameDataStore>> _frameDataStores; // every store published, effects may still be reading older ones
 	std::string _audio_file;
 	xLightsVamp _vamp;
 	long _rate;
@@ -169,11 +208,11 @@ class AudioManager
 	std::string _album;
 	int _intervalMS;
 	int _lengthMS;
-	bool _frameDataPrepared;
 	float _bigmax;
 	float _bigspread;
 	float _bigmin;
 	float _bigspectogrammax;
+	std::atomic<int> _frameDataProgress; // percentage of the spectrum analysis done
 	MEDIAPLAYINGSTATE _media_state;
 	bool _polyphonicTranscriptionDone;
     int _sdlid;
@@ -190,7 +229,7 @@ class AudioManager
 	int decodebitrateindex(int bitrateindex, int version, int layertype);
 	int decodesamplerateindex(int samplerateindex, int version);
 	int decodesideinfosize(int version, int mono);
-	std::list<float> CalculateSpectrumAnalysis(const float* in, int n, float& max, int id);
+	void CalculateSpectrumAnalysis(int step, int windows, std::vector<float>& spectra, std::vector<float>& maxes, std::vector<uint8_t>& valid);
 
 public:
     bool IsOk() const { return _ok; }
@@ -227,10 +266,12 @@ public:
 	void SetStepBlock(int step, int block);
 	void SetFrameInterval(int intervalMS);
 	int GetFrameInterval() { return _intervalMS; }
-	std::list<float>* GetFrameData(int frame, FRAMEDATATYPE fdt, std::string timing);
+	const FrameDataSpan* GetFrameData(int frame, FRAMEDATATYPE fdt, const std::string& timing);
 	void DoPrepareFrameData();
+	void PublishFrameData(const std::vector<std::vector<float>>& slots, size_t frames);
 	void DoPolyphonicTranscription(wxProgressDialog* dlg, AudioManagerProgressCallback progresscallback);
 	bool IsPolyphonicTranscriptionDone() { return _polyphonicTranscriptionDone; };
+	int GetFrameDataProgress() const { return _frameDataProgress; }
 };
 
 #endif
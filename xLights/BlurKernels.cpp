@@ -0,0 +1,360 @@
+#include "BlurKernels.h"
+
+#include <algorithm>
+
+//http://blog.ivank.net/fastest-gaussian-blur.html
+
+static void boxesForGauss(int d, int n, std::vector<float> &boxes)  // standard deviation, number of boxes
+{
+    switch (d) {
+        case 2:
+        case 3:
+            boxes.push_back(1.0);
+            break;
+        case 4:
+        case 5:
+        case 6:
+            boxes.push_back(3.0);
+            break;
+        case 7:
+        case 8:
+        case 9:
+            boxes.push_back(5.0);
+            break;
+        case 10:
+        case 11:
+        case 12:
+            boxes.push_back(7.0);
+            break;
+        case 13:
+        case 14:
+        case 15:
+            boxes.push_back(9.0);
+            break;
+    }
+    float b = boxes.back();
+    switch (d) {
+        case 2:
+        case 4:
+        case 5:
+        case 7:
+        case 8:
+        case 10:
+        case 11:
+        case 13:
+        case 14:
+            boxes.push_back(b);
+            break;
+        default:
+            boxes.push_back(b + 2.0);
+            break;
+    }
+    switch (d) {
+        case 4:
+        case 7:
+        case 10:
+        case 13:
+            boxes.push_back(b);
+            break;
+        default:
+            boxes.push_back(b + 2.0);
+    }
+
+
+
+    /*
+    float wIdeal = std::sqrt((12.0f*sigma*sigma/n)+1.0f);  // Ideal averaging filter width
+    float wl = std::floor(wIdeal);
+    if ( (((int)wl)%2) == 0) {
+        wl -= 1.0;
+    }
+    float wu = wl+2;
+
+    float mIdeal = (12.0f*sigma*sigma - n*wl*wl - 4.0f*n*wl - 3.0f*n)/(-4.0f*wl - 4.0f);
+    int m = std::round(mIdeal);
+
+    for(int i=1; i<(n+1); i++) {
+        boxes.push_back(i<=m?wl:wu);
+        printf("%f  %d:    %f\n", sigma, i,  boxes.back());
+    }
+    */
+}
+
+// the blur works on 4 ints per pixel holding each channel in 8.8 fixed point so
+// repeated box passes keep their fractions without needing floats
+#define BLUR_SHIFT 8
+// reciprocal precision for the box average
+#define BLUR_AVG_SHIFT 24
+
+#define RED(a, b) a[(b)*4]
+#define GREEN(a, b) a[(b)*4 + 1]
+#define BLUE(a, b) a[(b)*4 + 2]
+#define ALPHA(a, b) a[(b)*4 + 3]
+static inline int AVG(int v, long long iarr) {
+    return (int)((v * iarr + (1LL << (BLUR_AVG_SHIFT - 1))) >> BLUR_AVG_SHIFT);
+}
+static inline void SET(int *ar, int idx, int r, int g, int b, int a, long long iarr) {
+    idx *= 4;
+    ar[idx++] = AVG(r, iarr);
+    ar[idx++] = AVG(g, iarr);
+    ar[idx++] = AVG(b, iarr);
+    ar[idx] = AVG(a, iarr);
+}
+
+static void boxBlurH_4 (const int  * const scl, int *tcl, int w, int h, int r) {
+    long long iarr = ((1LL << BLUR_AVG_SHIFT) + r) / (r+r+1);
+    for(int i=0; i<h; i++) {
+        int ti = i*w;
+        int li = ti;
+        int ri = ti+r;
+        int maxri = ti + w - 1;
+        int fvIdx = ti;
+        int lvIdx = ti+w-1;
+
+        int valr = (r+1) * RED(scl,fvIdx);
+        int valg = (r+1) * GREEN(scl,fvIdx);
+        int valb = (r+1) * BLUE(scl,fvIdx);
+        int vala = (r+1) * ALPHA(scl,fvIdx);
+
+        int fvRed = RED(scl, fvIdx);
+        int fvGreen = GREEN(scl, fvIdx);
+        int fvBlue = BLUE(scl, fvIdx);
+        int fvAlpha = ALPHA(scl, fvIdx);
+        int lvRed = RED(scl, lvIdx);
+        int lvGreen = GREEN(scl, lvIdx);
+        int lvBlue = BLUE(scl, lvIdx);
+        int lvAlpha = ALPHA(scl, lvIdx);
+
+        for (int j=0; j<r; j++) {
+            int idx = j < w ? ti+j : lvIdx;
+            valr += RED(scl, idx);
+            valg += GREEN(scl, idx);
+            valb += BLUE(scl, idx);
+            vala += ALPHA(scl, idx);
+        }
+        for (int j=0  ; j<=r ; j++) {
+            int idx = ri <= maxri ? ri++ : lvIdx;
+            valr += RED(scl, idx) - fvRed;
+            valg += GREEN(scl, idx) - fvGreen;
+            valb += BLUE(scl, idx) - fvBlue;
+            vala += ALPHA(scl, idx) - fvAlpha;
+
+            if (ti <= maxri) {
+                SET(tcl, ti, valr, valg, valb, vala, iarr);
+                ti++;
+            }
+        }
+        for (int j=r+1; j<w-r; j++) {
+            int c = ri <= maxri ? ri++ : lvIdx;
+            int c2 = li <= maxri ? li++ : lvIdx;
+            valr += RED(scl, c) - RED(scl, c2);
+            valg += GREEN(scl, c) - GREEN(scl, c2);
+            valb += BLUE(scl, c) - BLUE(scl, c2);
+            vala += ALPHA(scl, c) - ALPHA(scl, c2);
+            if (ti <= maxri) {
+                SET(tcl, ti, valr, valg, valb, vala, iarr);
+                ti++;
+            }
+        }
+
+        for (int j=w-r; j<w  ; j++) {
+            int c2 = li <= maxri ? li++: lvIdx;
+            valr += lvRed - RED(scl, c2);
+            valg += lvGreen - GREEN(scl, c2);
+            valb += lvBlue - BLUE(scl, c2);
+            vala += lvAlpha - ALPHA(scl, c2);
+            if (ti <= maxri) {
+                SET(tcl, ti, valr, valg, valb, vala, iarr);
+                ti++;
+            }
+        }
+    }
+}
+static void boxBlurT_4 (const int * const scl, int *tcl, int w, int h, int r) {
+    long long iarr = ((1LL << BLUR_AVG_SHIFT) + r) / (r+r+1);
+    for(int i=0; i<w; i++) {
+        int ti = i;
+        int li = ti;
+        int ri = ti+r*w;
+
+        int maxri = ti+w*(h-1);
+
+        int fvIdx = ti;
+        int lvIdx = ti+w*(h-1);
+
+        int fvRed = RED(scl, fvIdx);
+        int fvGreen = GREEN(scl, fvIdx);
+        int fvBlue = BLUE(scl, fvIdx);
+        int fvAlpha = ALPHA(scl, fvIdx);
+        int lvRed = RED(scl, lvIdx);
+        int lvGreen = GREEN(scl, lvIdx);
+        int lvBlue = BLUE(scl, lvIdx);
+        int lvAlpha = ALPHA(scl, lvIdx);
+
+        int valr = (r+1)*fvRed;
+        int valg = (r+1)*fvGreen;
+        int valb = (r+1)*fvBlue;
+        int vala = (r+1)*fvAlpha;
+
+        for(int j=0; j<r; j++) {
+            int idx = j < w ? ti+j*w : lvIdx;
+            valr += RED(scl, idx);
+            valg += GREEN(scl, idx);
+            valb += BLUE(scl, idx);
+            vala += ALPHA(scl, idx);
+        }
+        for(int j=0  ; j<=r ; j++) {
+            int idx = ri <= maxri ? ri : lvIdx;
+            valr += RED(scl, idx) - fvRed;
+            valg += GREEN(scl, idx) - fvGreen;
+            valb += BLUE(scl, idx) - fvBlue;
+            vala += ALPHA(scl, idx) - fvAlpha;
+            if (ti <= maxri) {
+                SET(tcl, ti, valr, valg, valb, vala, iarr);
+            }
+            ri+=w;
+            ti+=w;
+        }
+        for(int j=r+1; j<h-r; j++) {
+            int c = ri <= maxri ? ri : lvIdx;
+            int c2 = li <= maxri ? li : lvIdx;
+            valr += RED(scl, c) - RED(scl, c2);
+            valg += GREEN(scl, c) - GREEN(scl, c2);
+            valb += BLUE(scl, c) - BLUE(scl, c2);
+            vala += ALPHA(scl, c) - ALPHA(scl, c2);
+            if (ti <= maxri) {
+                SET(tcl, ti, valr, valg, valb, vala, iarr);
+            }
+            li+=w; ri+=w; ti+=w;
+        }
+        for(int j=h-r; j<h  ; j++) {
+            int c2 = li <= maxri ? li : lvIdx;
+            valr += lvRed - RED(scl, c2);
+            valg += lvGreen - GREEN(scl, c2);
+            valb += lvBlue - BLUE(scl, c2);
+            vala += lvAlpha - ALPHA(scl, c2);
+            if (ti <= maxri) {
+                SET(tcl, ti, valr, valg, valb, vala, iarr);
+            }
+            li += w;
+            ti += w;
+        }
+    }
+}
+// the horizontal pass writes every pixel of tcl so there is no need to copy scl into it first
+static void boxBlur_4(int *scl, int *tcl, int w, int h, int r) {
+    boxBlurH_4(scl, tcl, w, h, r);
+    boxBlurT_4(tcl, scl, w, h, r);
+}
+
+// result ends up back in scl
+static void gaussBlur_4(int *scl, int *tcl, int w, int h, const std::vector<float> &bxs) {
+    boxBlur_4 (scl, tcl, w, h, ((int)bxs[0]-1)/2);
+    boxBlur_4 (scl, tcl, w, h, ((int)bxs[1]-1)/2);
+    boxBlur_4 (scl, tcl, w, h, ((int)bxs[2]-1)/2);
+}
+
+void BlurPixels(xlColor *pixels, int w, int h, int b, BlurScratch &scratch)
+{
+    if (w == 1 && h == 1) {
+        return;
+    }
+    if (b < 2) {
+        return;
+    }
+
+    int pixCount = w * h;
+    if (scratch.buffer1.size() < (size_t)pixCount * 4) {
+        scratch.buffer1.resize(pixCount * 4);
+        scratch.buffer2.resize(pixCount * 4);
+    }
+    int *input = &scratch.buffer1[0];
+    int *tmp = &scratch.buffer2[0];
+
+    if (b > 2 && w > 6 && h > 6) {
+        for (int x = 0; x < pixCount; x++) {
+            const xlColor &c = pixels[x];
+            input[x * 4] = c.red << BLUR_SHIFT;
+            input[x * 4 + 1] = c.green << BLUR_SHIFT;
+            input[x * 4 + 2] = c.blue << BLUR_SHIFT;
+            input[x * 4 + 3] = c.alpha << BLUR_SHIFT;
+        }
+        if (scratch.boxesFor != b) {
+            scratch.boxes.clear();
+            boxesForGauss(b - 1, 3, scratch.boxes);
+            scratch.boxesFor = b;
+        }
+        gaussBlur_4(input, tmp, w, h, scratch.boxes);
+
+        const int half = 1 << (BLUR_SHIFT - 1);
+        for (int x = 0; x < pixCount; x++) {
+            pixels[x].Set((input[x*4] + half) >> BLUR_SHIFT,
+                          (input[x*4 + 1] + half) >> BLUR_SHIFT,
+                          (input[x*4 + 2] + half) >> BLUR_SHIFT,
+                          (input[x*4 + 3] + half) >> BLUR_SHIFT);
+        }
+    } else {
+        // average of the d left/below to u right/above ... clipped to the buffer.
+        // The sum over the box is the sum down the columns of sums along the rows
+        // so do the rows first then the columns.
+        int d = 0;
+        int u = 0;
+        if (b % 2 == 0)
+        {
+            d = b / 2;
+            u = (b - 1) / 2;
+        }
+        else
+        {
+            d = (b - 1) / 2;
+            u = (b - 1) / 2;
+        }
+        for (int y = 0; y < h; y++)
+        {
+            const xlColor *row = &pixels[y * w];
+            int *out = &tmp[y * w * 4];
+            for (int x = 0; x < w; x++)
+            {
+                int r = 0;
+                int g = 0;
+                int bl = 0;
+                int a = 0;
+                int from = std::max(x - d, 0);
+                int to = std::min(x + u, w - 1);
+                for (int i = from; i <= to; i++)
+                {
+                    r += row[i].red;
+                    g += row[i].green;
+                    bl += row[i].blue;
+                    a += row[i].alpha;
+                }
+                out[x * 4] = r;
+                out[x * 4 + 1] = g;
+                out[x * 4 + 2] = bl;
+                out[x * 4 + 3] = a;
+            }
+        }
+        for (int y = 0; y < h; y++)
+        {
+            int from = std::max(y - d, 0);
+            int to = std::min(y + u, h - 1);
+            for (int x = 0; x < w; x++)
+            {
+                int r = 0;
+                int g = 0;
+                int bl = 0;
+                int a = 0;
+                for (int j = from; j <= to; j++)
+                {
+                    const int *c = &tmp[(j * w + x) * 4];
+                    r += c[0];
+                    g += c[1];
+                    bl += c[2];
+                    a += c[3];
+                }
+                int sm = (std::min(x + u, w - 1) - std::max(x - d, 0) + 1) * (to - from + 1);
+                pixels[y * w + x].Set(r / sm, g / sm, bl / sm, a / sm);
+            }
+        }
+    }
+}
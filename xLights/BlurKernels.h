@@ -0,0 +1,21 @@
+#ifndef BLURKERNELS_H
+#define BLURKERNELS_H
+
+#include <vector>
+#include "Color.h"
+
+// working space for BlurPixels ... kept by the caller so blurring every frame does not allocate
+struct BlurScratch
+{
+    std::vector<int> buffer1;
+    std::vector<int> buffer2;
+    std::vector<float> boxes;
+    int boxesFor = -1;
+};
+
+// blurs a w x h buffer in place. Blur values over 2 on buffers bigger than 6x6 use three
+// box passes in fixed point to approximate a gaussian, anything smaller averages the
+// pixels within b of each other
+void BlurPixels(xlColor *pixels, int w, int h, int b, BlurScratch &scratch);
+
+#endif
@@ -21,6 +21,7 @@ ColorCurve::ColorCurve(const std::string& id, const std::string type, xlColor c)
     _timecurve = TC_TIME;
     _values.push_back(ccSortableColorPoint(0.5, c));
     _active = false;
+    _baked = false;
 }
 
 ColorCurve::ColorCurve(const std::string& s)
@@ -29,6 +30,7 @@ ColorCurve::ColorCurve(const std::string& s)
     _values.clear();
     _active = false;
     _timecurve = TC_TIME;
+    _baked = false;
     Deserialise(s);
 
     if (_values.size() == 0)
@@ -79,6 +81,8 @@ void ColorCurve::Deserialise(const std::string& s)
     {
         _values.push_back(ccSortableColorPoint(0.5, *wxBLACK));
     }
+
+    Bake();
 }
 std::string ColorCurve::Serialise()
 {
@@ -159,6 +163,7 @@ void ColorCurve::SetSerialisedValue(std::string k, std::string s)
 void ColorCurve::SetType(std::string type)
 {
     _type = type;
+    Bake();
 }
 
 uint8_t ChannelBlend(uint8_t c1, uint8_t c2, float ratio)
@@ -191,6 +196,77 @@ double CCrand01()
 }
 
 xlColor ColorCurve::GetValueAt(float offset) const
+{
+    if (_bakedValues.size() > 0 && offset >= 0.0f && offset <= 1.0f)
+    {
+        float pos = offset * COLORCURVE_BAKED_SIZE;
+        int i = std::min((int)pos, COLORCURVE_BAKED_SIZE - 1);
+        if (!_bakedExact[i])
+        {
+            const xlColor& c1 = _bakedValues[i];
+            const xlColor& c2 = _bakedValues[i + 1];
+            float ratio = pos - i;
+            return xlColor(c1.Red() + (int)floor(ratio * ((int)c2.Red() - (int)c1.Red()) + 0.5),
+                           c1.Green() + (int)floor(ratio * ((int)c2.Green() - (int)c1.Green()) + 0.5),
+                           c1.Blue() + (int)floor(ratio * ((int)c2.Blue() - (int)c1.Blue()) + 0.5));
+        }
+    }
+
+    return GetExactValueAt(offset);
+}
+
+static bool ColorsNear(const xlColor& c1, const xlColor& c2)
+{
+    return std::abs((int)c1.Red() - (int)c2.Red()) <= COLORCURVE_BAKED_ERROR &&
+           std::abs((int)c1.Green() - (int)c2.Green()) <= COLORCURVE_BAKED_ERROR &&
+           std::abs((int)c1.Blue() - (int)c2.Blue()) <= COLORCURVE_BAKED_ERROR;
+}
+
+// Samples the curve into a table. Between points the colour either holds or blends in a straight
+// line so only the gaps holding a point (or the half way mark between two points) can go wrong ...
+// those always use the exact colour. Every other gap is checked against the exact colour to be sure.
+// Random curves are never baked as they are meant to give a different colour each time.
+void ColorCurve::Bake()
+{
+    _bakedValues.clear();
+    _bakedExact.clear();
+
+    if (!_baked || !_active || _values.size() == 0 || _type == "Random") return;
+
+    _bakedValues.resize(COLORCURVE_BAKED_SIZE + 1);
+    for (int i = 0; i <= COLORCURVE_BAKED_SIZE; i++)
+    {
+        _bakedValues[i] = GetExactValueAt((float)i / COLORCURVE_BAKED_SIZE);
+    }
+
+    _bakedExact.resize(COLORCURVE_BAKED_SIZE, false);
+    float last = -1.0f;
+    for (auto it = _values.begin(); it != _values.end(); ++it)
+    {
+        std::vector<float> marks;
+        marks.push_back(it->x);
+        if (last >= 0.0f) marks.push_back((last + it->x) / 2.0f);
+        last = it->x;
+
+        for (auto m = marks.begin(); m != marks.end(); ++m)
+        {
+            int i = (int)(*m * COLORCURVE_BAKED_SIZE);
+            if (i > 0) _bakedExact[i - 1] = true;
+            if (i < COLORCURVE_BAKED_SIZE) _bakedExact[i] = true;
+        }
+    }
+
+    for (int i = 0; i < COLORCURVE_BAKED_SIZE; i++)
+    {
+        if (!_bakedExact[i])
+        {
+            float mid = ((float)i + 0.5f) / COLORCURVE_BAKED_SIZE;
+            _bakedExact[i] = !ColorsNear(GetValueAt(mid), GetExactValueAt(mid));
+        }
+    }
+}
+
+xlColor ColorCurve::GetExactValueAt(float offset) const
 {
     if (_type == "Gradient")
     {
@@ -344,6 +420,7 @@ void ColorCurve::DeletePoint(float offset)
             }
             it++;
         }
+        Bake();
     }
     else
     {
@@ -360,6 +437,7 @@ void ColorCurve::Flip()
         ccSortableColorPoint scp(1.0f - it->x, it->color);
         _values.push_front(scp);
     }
+    Bake();
 }
 
 void ColorCurve::SetValueAt(float offset, xlColor c)
@@ -377,6 +455,7 @@ void ColorCurve::SetValueAt(float offset, xlColor c)
 
     _values.push_back(ccSortableColorPoint(offset, c));
     _values.sort();
+    Bake();
 }
 
 wxBitmap ColorCurve::GetImage(int x, int y, bool bars)
@@ -6,9 +6,15 @@
 #include <wx/wx.h>
 #include <wx/colour.h>
 #include <list>
+#include <vector>
 
 #include "Color.h"
 
+// samples in a baked color curve
+#define COLORCURVE_BAKED_SIZE 1024
+// a baked color may differ from the exact color by at most this on each channel
+#define COLORCURVE_BAKED_ERROR 1
+
 class ccSortableColorPoint
 {
 public:
@@ -141,8 +147,13 @@ class ColorCurve
     std::string _id;
     bool _active;
     int _timecurve;
+    bool _baked;
+    std::vector<xlColor> _bakedValues; // COLORCURVE_BAKED_SIZE + 1 samples ... empty if not baked
+    std::vector<bool> _bakedExact; // true for the sample gaps where blending the samples is not close enough
 
     void SetSerialisedValue(std::string k, std::string v);
+    void Bake();
+    xlColor GetExactValueAt(float offset) const;
     const ccSortableColorPoint* GetActivePoint(float x, float& duration) const;
     const ccSortableColorPoint* GetPriorActivePoint(float x, float& duration) const;
     const ccSortableColorPoint* GetNextActivePoint(float x, float& duration) const;
@@ -153,7 +164,7 @@ public:
     int GetTimeCurve() const { return _timecurve; }
     std::string GetId() const { return _id; }
     void SetId(std::string& id) { _id = id; }
-    ColorCurve() { ColorCurve(""); _active = false; _timecurve = TC_TIME; };
+    ColorCurve() { ColorCurve(""); _active = false; _timecurve = TC_TIME; _baked = false; };
     ColorCurve(const std::string& serialised);
     ColorCurve(const std::string& id, const std::string type, xlColor c = xlBLACK);
     std::string Serialise();
@@ -164,10 +175,14 @@ public:
     xlColor GetValueAt(float offset) const;
     ccSortableColorPoint* GetPointAt(float offset);
 	wxBitmap GetImage(int x, int y, bool bars);
-    void SetActive(bool a) { _active = a; }
+    void SetActive(bool a) { _active = a; Bake(); }
     bool IsActive() const
     { return IsOk() && _active; }
-    void ToggleActive() { _active = !_active; }
+    void ToggleActive() { _active = !_active; Bake(); }
+    // baked curves are sampled into a table whenever they change so GetValueAt is a lookup
+    // points changed through GetPointAt are not seen ... call SetBaked again after doing that
+    void SetBaked(bool baked) { _baked = baked; Bake(); }
+    bool IsBaked() const { return _bakedValues.size() > 0; }
     void SetValueAt(float offset, xlColor x);
     void DeletePoint(float offset);
     void Flip();
@@ -0,0 +1,445 @@
+#include "FSEQFormat.h"
+
+#include <wx/file.h>
+#include <wx/mstream.h>
+#include <wx/zstream.h>
+#include <wx/time.h>
+#include <algorithm>
+#include <cstring>
+#include <log4cpp/Category.hh>
+
+// aim for blocks of about this many bytes before compression ... big enough to compress well, small enough
+// that playback does not stall decompressing one
+#define FSEQ_V2_BLOCK_SIZE (1024 * 1024)
+
+static void WriteUInt16(std::vector<wxByte>& buf, size_t pos, size_t v)
+{
+    buf[pos] = (wxByte)(v & 0xFF);
+    buf[pos + 1] = (wxByte)((v >> 8) & 0xFF);
+}
+
+static void WriteUInt24(std::vector<wxByte>& buf, size_t pos, size_t v)
+{
+    WriteUInt16(buf, pos, v);
+    buf[pos + 2] = (wxByte)((v >> 16) & 0xFF);
+}
+
+static void WriteUInt32(std::vector<wxByte>& buf, size_t pos, size_t v)
+{
+    WriteUInt16(buf, pos, v);
+    WriteUInt16(buf, pos + 2, v >> 16);
+}
+
+static size_t ReadUInt16(const wxByte* buf)
+{
+    return (size_t)buf[0] + ((size_t)buf[1] << 8);
+}
+
+static size_t ReadUInt24(const wxByte* buf)
+{
+    return ReadUInt16(buf) + ((size_t)buf[2] << 16);
+}
+
+static size_t ReadUInt32(const wxByte* buf)
+{
+    return ReadUInt16(buf) + (ReadUInt16(buf + 2) << 16);
+}
+
+FSEQV2Header::FSEQV2Header()
+{
+    channelDataOffset = 0;
+    channels = 0;
+    frames = 0;
+    frameMS = 0;
+    compression = FSEQ_COMPRESS_NONE;
+}
+
+bool FSEQV2Header::IsV2(const wxByte* header, size_t length)
+{
+    return length >= 8 && memcmp(header, "PSEQ", 4) == 0 && header[7] == 2;
+}
+
+bool FSEQV2Header::Parse(const wxByte* header, size_t length)
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (length < FSEQ_V2_FIXED_HEADER_SIZE || !IsV2(header, length)) return false;
+
+    channelDataOffset = ReadUInt16(header + 4);
+    size_t variableHeaderOffset = ReadUInt16(header + 8);
+    channels = ReadUInt32(header + 10);
+    frames = ReadUInt32(header + 14);
+    frameMS = header[18];
+    compression = header[20] & 0x0F;
+    size_t blockCount = header[21] + ((size_t)(header[20] & 0xF0) << 4);
+    size_t rangeCount = header[22];
+
+    if (compression != FSEQ_COMPRESS_NONE && compression != FSEQ_COMPRESS_ZLIB)
+    {
+        logger_base.error("FSEQ v2 compression type %d is not supported.", compression);
+        return false;
+    }
+
+    size_t pos = FSEQ_V2_FIXED_HEADER_SIZE;
+    if (channelDataOffset > length || pos + blockCount * 8 + rangeCount * 6 > channelDataOffset)
+    {
+        logger_base.error("FSEQ v2 header is truncated.");
+        return false;
+    }
+
+    blocks.clear();
+    wxFileOffset offset = channelDataOffset;
+    for (size_t i = 0; i < blockCount; i++)
+    {
+        Block b;
+        b.firstFrame = ReadUInt32(header + pos);
+        b.length = ReadUInt32(header + pos + 4);
+        b.offset = offset;
+        b.frames = 0;
+        offset += b.length;
+        pos += 8;
+
+        // writers may pad the index with empty blocks
+        if (b.length == 0) continue;
+        if (!blocks.empty())
+        {
+            if (b.firstFrame <= blocks.back().firstFrame) return false;
+            blocks.back().frames = b.firstFrame - blocks.back().firstFrame;
+        }
+        blocks.push_back(b);
+    }
+    if (!blocks.empty())
+    {
+        if (blocks.back().firstFrame >= frames) return false;
+        blocks.back().frames = frames - blocks.back().firstFrame;
+    }
+
+    ranges.clear();
+    for (size_t i = 0; i < rangeCount; i++)
+    {
+        Range r;
+        r.start = ReadUInt24(header + pos);
+        r.channels = ReadUInt24(header + pos + 3);
+        pos += 6;
+        if (r.start + r.channels > channels)
+        {
+            logger_base.error("FSEQ v2 sparse range %d-%d is outside the %d channels in the file.", (int)r.start, (int)(r.start + r.channels), (int)channels);
+            return false;
+        }
+        ranges.push_back(r);
+    }
+
+    if (blocks.empty() && compression == FSEQ_COMPRESS_NONE && frames > 0)
+    {
+        // uncompressed files dont need an index ... the frames just follow each other
+        Block b;
+        b.firstFrame = 0;
+        b.frames = frames;
+        b.offset = channelDataOffset;
+        b.length = frames * GetStoredFrameSize();
+        blocks.push_back(b);
+    }
+
+    mediaFilename = "";
+    pos = std::max(pos, variableHeaderOffset);
+    while (pos + 4 <= channelDataOffset)
+    {
+        size_t len = ReadUInt16(header + pos);
+        if (len <= 4 || pos + len > channelDataOffset) break;
+        if (header[pos + 2] == 'm' && header[pos + 3] == 'f')
+        {
+            mediaFilename = std::string((const char*)header + pos + 4, strnlen((const char*)header + pos + 4, len - 4));
+        }
+        pos += len;
+    }
+
+    return true;
+}
+
+size_t FSEQV2Header::GetStoredFrameSize() const
+{
+    if (ranges.empty()) return channels;
+
+    size_t size = 0;
+    for (auto it = ranges.begin(); it != ranges.end(); ++it)
+    {
+        size += it->channels;
+    }
+    return size;
+}
+
+int FSEQV2Header::FindBlock(size_t frame) const
+{
+    if (frame >= frames || blocks.empty()) return -1;
+
+    // blocks are in frame order so the last one starting at or before the frame holds it
+    auto it = std::upper_bound(blocks.begin(), blocks.end(), frame, [](size_t f, const Block& b) { return f < b.firstFrame; });
+    if (it == blocks.begin()) return -1;
+    return (int)(it - blocks.begin()) - 1;
+}
+
+bool FSEQV2Header::ReadBlock(wxFile& f, int block, std::vector<wxByte>& data) const
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (block < 0 || block >= (int)blocks.size()) return false;
+
+    const Block& b = blocks[block];
+    size_t size = b.frames * GetStoredFrameSize();
+    data.resize(size);
+
+    std::vector<wxByte> compressed(b.length);
+    if (f.Seek(b.offset) == wxInvalidOffset || f.Read(compressed.data(), b.length) != (ssize_t)b.length)
+    {
+        logger_base.error("FSEQ v2 block %d could not be read.", block);
+        return false;
+    }
+
+    if (compression == FSEQ_COMPRESS_NONE)
+    {
+        if (b.length != size) return false;
+        data.swap(compressed);
+        return true;
+    }
+
+    wxMemoryInputStream mis(compressed.data(), compressed.size());
+    wxZlibInputStream zis(mis, wxZLIB_ZLIB);
+    zis.Read(data.data(), size);
+    if (zis.LastRead() != size)
+    {
+        logger_base.error("FSEQ v2 block %d did not decompress to %d bytes.", block, (int)size);
+        return false;
+    }
+    return true;
+}
+
+void FSEQV2Header::ExpandFrame(const wxByte* stored, wxByte* frame, size_t offset, size_t count) const
+{
+    size_t end = count == 0 ? channels : std::min(channels, offset + count);
+
+    if (ranges.empty())
+    {
+        if (end > offset) memcpy(frame + offset, stored + offset, end - offset);
+        return;
+    }
+
+    // channels not in any range are always off
+    memset(frame + offset, 0x00, end > offset ? end - offset : 0);
+    for (auto it = ranges.begin(); it != ranges.end(); ++it)
+    {
+        size_t s = std::max(offset, it->start);
+        size_t e = std::min(end, it->start + it->channels);
+        if (s < e)
+        {
+            memcpy(frame + s, stored + (s - it->start), e - s);
+        }
+        stored += it->channels;
+    }
+}
+
+FSEQV2Writer::FSEQV2Writer(wxFile& f, size_t channels, size_t frames, int frameMS, const std::string& mediaFilename,
+                           const std::vector<FSEQV2Header::Range>& ranges, bool compress) : _f(f)
+{
+    _header.channels = channels;
+    _header.frames = frames;
+    _header.frameMS = frameMS;
+    _header.compression = compress ? FSEQ_COMPRESS_ZLIB : FSEQ_COMPRESS_NONE;
+    _header.ranges = ranges;
+    _header.mediaFilename = mediaFilename;
+    _framesWritten = 0;
+    _blockFrames = 0;
+    _uniqueId = wxGetUTCTimeUSec().GetValue();
+
+    size_t frameSize = std::max((size_t)1, _header.GetStoredFrameSize());
+    _framesPerBlock = std::max((size_t)1, FSEQ_V2_BLOCK_SIZE / frameSize);
+    _framesPerBlock = std::max(_framesPerBlock, (frames + FSEQ_V2_MAX_BLOCKS - 1) / FSEQ_V2_MAX_BLOCKS);
+    if (frames > 0) _framesPerBlock = std::min(_framesPerBlock, frames);
+
+    // work out all the blocks now so the header size is known ... the lengths get filled in on close
+    for (size_t i = 0; i < frames; i += _framesPerBlock)
+    {
+        FSEQV2Header::Block b;
+        b.firstFrame = i;
+        b.frames = std::min(_framesPerBlock, frames - i);
+        b.offset = 0;
+        b.length = 0;
+        _header.blocks.push_back(b);
+    }
+
+    // write a placeholder header which gets rewritten with the real block lengths on close
+    std::vector<wxByte> header = BuildHeader();
+    _header.channelDataOffset = header.size();
+    _ok = header.size() <= 0xFFFF && ranges.size() <= FSEQ_V2_MAX_RANGES &&
+          _f.Write(header.data(), header.size()) == header.size();
+    _block.reserve(_framesPerBlock * _header.GetStoredFrameSize());
+}
+
+std::vector<wxByte> FSEQV2Writer::BuildHeader() const
+{
+    size_t mediaLength = _header.mediaFilename.empty() ? 0 : _header.mediaFilename.size() + 5;
+    size_t variableHeaderOffset = FSEQ_V2_FIXED_HEADER_SIZE + _header.blocks.size() * 8 + _header.ranges.size() * 6;
+    size_t size = variableHeaderOffset + mediaLength;
+    size = (size + 3) & ~(size_t)3;
+
+    std::vector<wxByte> buf(size, 0);
+    buf[0] = 'P';
+    buf[1] = 'S';
+    buf[2] = 'E';
+    buf[3] = 'Q';
+    WriteUInt16(buf, 4, size);
+    buf[6] = 0;
+    buf[7] = 2;
+    WriteUInt16(buf, 8, variableHeaderOffset);
+    WriteUInt32(buf, 10, _header.channels);
+    WriteUInt32(buf, 14, _header.frames);
+    buf[18] = (wxByte)std::min(_header.frameMS, 255);
+    buf[20] = (wxByte)(_header.compression | ((_header.blocks.size() >> 4) & 0xF0));
+    buf[21] = (wxByte)(_header.blocks.size() & 0xFF);
+    buf[22] = (wxByte)_header.ranges.size();
+    WriteUInt32(buf, 24, (size_t)(_uniqueId & 0xFFFFFFFF));
+    WriteUInt32(buf, 28, (size_t)(_uniqueId >> 32));
+
+    size_t pos = FSEQ_V2_FIXED_HEADER_SIZE;
+    for (auto it = _header.blocks.begin(); it != _header.blocks.end(); ++it)
+    {
+        WriteUInt32(buf, pos, it->firstFrame);
+        WriteUInt32(buf, pos + 4, it->length);
+        pos += 8;
+    }
+    for (auto it = _header.ranges.begin(); it != _header.ranges.end(); ++it)
+    {
+        WriteUInt24(buf, pos, it->start);
+        WriteUInt24(buf, pos + 3, it->channels);
+        pos += 6;
+    }
+    if (mediaLength > 0)
+    {
+        WriteUInt16(buf, pos, mediaLength);
+        buf[pos + 2] = 'm';
+        buf[pos + 3] = 'f';
+        memcpy(&buf[pos + 4], _header.mediaFilename.c_str(), _header.mediaFilename.size());
+    }
+    return buf;
+}
+
+bool FSEQV2Writer::WriteFrame(const wxByte* frame)
+{
+    if (!_ok || _framesWritten >= _header.frames) return false;
+
+    if (_header.ranges.empty())
+    {
+        _block.insert(_block.end(), frame, frame + _header.channels);
+    }
+    else
+    {
+        for (auto it = _header.ranges.begin(); it != _header.ranges.end(); ++it)
+        {
+            _block.insert(_block.end(), frame + it->start, frame + it->start + it->channels);
+        }
+    }
+    _framesWritten++;
+    _blockFrames++;
+
+    if (_blockFrames == _header.blocks[(_framesWritten - 1) / _framesPerBlock].frames)
+    {
+        return FlushBlock();
+    }
+    return true;
+}
+
+bool FSEQV2Writer::FlushBlock()
+{
+    FSEQV2Header::Block& b = _header.blocks[(_framesWritten - 1) / _framesPerBlock];
+
+    if (_header.compression == FSEQ_COMPRESS_NONE)
+    {
+        b.length = _block.size();
+        _ok = _f.Write(_block.data(), _block.size()) == _block.size();
+    }
+    else
+    {
+        wxMemoryOutputStream mos;
+        {
+            // fastest level ... sequence data is mostly zeros and repeats so it still shrinks a lot
+            wxZlibOutputStream zos(mos, 1, wxZLIB_ZLIB);
+            zos.Write(_block.data(), _block.size());
+            zos.Close();
+        }
+        b.length = mos.GetSize();
+        std::vector<wxByte> compressed(b.length);
+        mos.CopyTo(compressed.data(), b.length);
+        _ok = _f.Write(compressed.data(), compressed.size()) == compressed.size();
+    }
+
+    _block.clear();
+    _blockFrames = 0;
+    return _ok;
+}
+
+bool FSEQV2Writer::Close()
+{
+    if (!_ok) return false;
+
+    // any frames never written are off
+    std::vector<wxByte> blank(_header.channels, 0x00);
+    while (_framesWritten < _header.frames && _ok)
+    {
+        WriteFrame(blank.data());
+    }
+
+    std::vector<wxByte> header = BuildHeader();
+    _ok = _f.Seek(0) != wxInvalidOffset && _f.Write(header.data(), header.size()) == header.size();
+    return _ok;
+}
+
+std::vector<FSEQV2Header::Range> FSEQV2Writer::FindUsedRanges(const std::vector<bool>& used)
+{
+    std::vector<FSEQV2Header::Range> ranges;
+
+    // small gaps cost more in range entries than they save so absorb them ... widen the gap we are
+    // prepared to absorb until we fit in the header
+    for (size_t gap = 64; ; gap *= 2)
+    {
+        ranges.clear();
+        size_t i = 0;
+        while (i < used.size())
+        {
+            if (!used[i])
+            {
+                i++;
+                continue;
+            }
+
+            if (!ranges.empty() && i - (ranges.back().start + ranges.back().channels) <= gap)
+            {
+                ranges.back().channels = i + 1 - ranges.back().start;
+            }
+            else
+            {
+                FSEQV2Header::Range r;
+                r.start = i;
+                r.channels = 1;
+                ranges.push_back(r);
+            }
+            i++;
+        }
+        if (ranges.size() <= FSEQ_V2_MAX_RANGES) break;
+    }
+
+    // channel counts are stored in 24 bits
+    for (auto it = ranges.begin(); it != ranges.end(); ++it)
+    {
+        if (it->start + it->channels > 0xFFFFFF) return std::vector<FSEQV2Header::Range>();
+    }
+
+    size_t stored = 0;
+    for (auto it = ranges.begin(); it != ranges.end(); ++it)
+    {
+        stored += it->channels;
+    }
+
+    // not worth it unless we drop at least 10% of the channels
+    if (ranges.empty() || stored * 10 > used.size() * 9) return std::vector<FSEQV2Header::Range>();
+
+    return ranges;
+}
@@ -0,0 +1,110 @@
+#ifndef FSEQFORMAT_H
+#define FSEQFORMAT_H
+
+#include <wx/defs.h>
+#include <wx/filefn.h>
+#include <string>
+#include <vector>
+
+class wxFile;
+
+// FSEQ version 2 files keep the version 1 PSEQ identifier but replace the raw frame dump with
+//  - frames grouped into blocks which are each compressed on their own
+//  - an index of the blocks in the header so any frame can be found without touching the blocks before it
+//  - optional sparse channel ranges so channels that are never used are not stored at all
+//
+// Header layout (all values little endian)
+//   0  'PSEQ'
+//   4  uint16 offset to the channel data
+//   6  uint8 minor version (0)
+//   7  uint8 major version (2)
+//   8  uint16 offset to the first variable header
+//   10 uint32 channels per frame
+//   14 uint32 number of frames
+//   18 uint8 frame time in ms
+//   19 uint8 flags (0)
+//   20 uint8 compression type in the low 4 bits, bits 8-11 of the block count in the high 4 bits
+//   21 uint8 low 8 bits of the block count
+//   22 uint8 number of sparse ranges
+//   23 uint8 flags (0)
+//   24 uint64 unique id
+//   32 block index: uint32 first frame, uint32 compressed length for each block
+//      sparse ranges: uint24 start channel, uint24 channel count for each range
+//      variable headers: uint16 length, 2 character code, data ... eg 'mf' media filename
+//      channel data
+
+#define FSEQ_V2_FIXED_HEADER_SIZE 32
+#define FSEQ_V2_MAX_BLOCKS 4095
+#define FSEQ_V2_MAX_RANGES 255
+
+#define FSEQ_COMPRESS_NONE 0
+#define FSEQ_COMPRESS_ZLIB 2
+
+class FSEQV2Header
+{
+public:
+    struct Block
+    {
+        size_t firstFrame;
+        size_t frames;
+        wxFileOffset offset;
+        size_t length;
+    };
+
+    struct Range
+    {
+        size_t start;
+        size_t channels;
+    };
+
+    size_t channelDataOffset;
+    size_t channels;
+    size_t frames;
+    int frameMS;
+    int compression;
+    std::vector<Block> blocks;
+    std::vector<Range> ranges;
+    std::string mediaFilename;
+
+    FSEQV2Header();
+    // header must hold the file from byte 0 up to the channel data offset
+    bool Parse(const wxByte* header, size_t length);
+    static bool IsV2(const wxByte* header, size_t length);
+
+    // bytes each frame takes up in the file before compression
+    size_t GetStoredFrameSize() const;
+    int FindBlock(size_t frame) const;
+    bool ReadBlock(wxFile& f, int block, std::vector<wxByte>& data) const;
+    // copies the channels offset to offset+count of a stored frame into their place in a full frame
+    void ExpandFrame(const wxByte* stored, wxByte* frame, size_t offset = 0, size_t count = 0) const;
+};
+
+class FSEQV2Writer
+{
+    wxFile& _f;
+    FSEQV2Header _header;
+    size_t _framesPerBlock;
+    size_t _framesWritten;
+    std::vector<wxByte> _block;
+    size_t _blockFrames;
+    wxUint64 _uniqueId;
+    bool _ok;
+
+    bool FlushBlock();
+    std::vector<wxByte> BuildHeader() const;
+
+public:
+    // ranges empty means store every channel
+    FSEQV2Writer(wxFile& f, size_t channels, size_t frames, int frameMS, const std::string& mediaFilename,
+                 const std::vector<FSEQV2Header::Range>& ranges, bool compress);
+
+    // frame is a full frame of channels
+    bool WriteFrame(const wxByte* frame);
+    bool Close();
+
+    // works out the ranges worth storing from a per channel flag of whether it is ever non zero
+    // returns no ranges if dropping the unused channels would not save much
+    static std::vector<FSEQV2Header::Range> FindUsedRanges(const std::vector<bool>& used);
+};
+
+#endif
@@ -15,6 +15,7 @@
 #include "ConvertDialog.h"
 #include "ConvertLogDialog.h"
 #include "outputs/Output.h"
+#include "FSEQFormat.h"
 
 #define string_format wxString::Format
 
@@ -1645,6 +1646,13 @@ void FileConverter::ReadFalconFile(ConvertParameters& params)
     unsigned char hdr[1024];
     f.Read(hdr,fixedHeaderLength);
 
+    if (FSEQV2Header::IsV2(hdr, fixedHeaderLength))
+    {
+        ReadFalconV2File(params, f);
+        f.Close();
+        return;
+    }
+
     int dataOffset = hdr[4] + (hdr[5] << 8);
     if (dataOffset < 1024) {
         f.Seek(0);
@@ -1738,6 +1746,128 @@ void FileConverter::ReadFalconFile(ConvertParameters& params)
     f.Close();
 }
 
+// Version 2 files are read a block at a time and each frame is expanded back out to the full channel layout
+void FileConverter::ReadFalconV2File(ConvertParameters& params, wxFile& f)
+{
+    static log4cpp::Category &logger_conversion = log4cpp::Category::getInstance(std::string("log_conversion"));
+
+    std::vector<wxByte> hdr(FSEQ_V2_FIXED_HEADER_SIZE);
+    f.Seek(0);
+    f.Read(hdr.data(), hdr.size());
+    hdr.resize(hdr[4] + (hdr[5] << 8));
+    f.Seek(0);
+    f.Read(hdr.data(), hdr.size());
+
+    FSEQV2Header header;
+    if (!header.Parse(hdr.data(), hdr.size()))
+    {
+        logger_conversion.debug("Invalid fseq v2 header: %s.", (const char *)params.inp_filename.c_str());
+        params.PlayerError(wxString("Unable to load sequence:\n")+params.inp_filename);
+        return;
+    }
+
+    wxString mf = header.mediaFilename;
+    if( params.media_filename ) {
+        *params.media_filename = mf;
+    }
+
+    if( params.read_mode == ConvertParameters::READ_MODE_LOAD_MAIN ) {
+        params.xLightsFrm->SetMediaFilename(mf);
+    }
+
+    int numChannels = header.channels;
+    int falconPeriods = header.frames;
+    if( params.data_layer != nullptr )
+    {
+        params.data_layer->SetNumFrames(falconPeriods);
+        params.data_layer->SetNumChannels(numChannels);
+    }
+
+    if(params.read_mode == ConvertParameters::READ_MODE_HEADER_ONLY )
+    {
+        return;
+    }
+
+    if(params.read_mode == ConvertParameters::READ_MODE_LOAD_MAIN ||
+       params.read_mode == ConvertParameters::READ_MODE_IMPORT )
+    {
+        params.seq_data.init(numChannels, falconPeriods, header.frameMS);
+    }
+
+    int channel_offset = 0;
+    if( params.data_layer )
+    {
+        channel_offset = params.data_layer->GetChannelOffset();
+    }
+
+    size_t storedFrameSize = header.GetStoredFrameSize();
+    std::vector<wxByte> block;
+    std::vector<wxByte> frame(numChannels);
+    for (int b = 0; b < (int)header.blocks.size(); b++)
+    {
+        if (!header.ReadBlock(f, b, block))
+        {
+            params.PlayerError(wxString("Unable to read all event data from:\n")+params.inp_filename);
+            return;
+        }
+
+        for (size_t i = 0; i < header.blocks[b].frames; i++)
+        {
+            int period = header.blocks[b].firstFrame + i;
+            const wxByte* stored = &block[i * storedFrameSize];
+
+            if (channel_offset == 0 && params.read_mode != ConvertParameters::READ_MODE_IGNORE_BLACK) {
+                header.ExpandFrame(stored, &params.seq_data[period][0]);
+                continue;
+            }
+
+            header.ExpandFrame(stored, frame.data());
+            for (int ch = 0; ch < numChannels; ch++)
+            {
+                int new_index = ch + channel_offset;
+                if( (new_index < 0) || (new_index >= numChannels) ) continue;
+                if( params.read_mode != ConvertParameters::READ_MODE_IGNORE_BLACK || frame[ch] != 0 )
+                {
+                    params.seq_data[period][new_index] = frame[ch];
+                }
+            }
+        }
+    }
+
+#ifndef NDEBUG
+    params.AppendConvertStatus(string_format(wxString("Read FSEQ v2 File SeqData.NumFrames()=%d SeqData.NumChannels()=%d"),params.seq_data.NumFrames(),params.seq_data.NumChannels()));
+#endif
+}
+
+// Writes the sequence as a compressed version 2 fseq leaving out any channels that are never turned on
+bool FileConverter::WriteFSEQV2File(wxFile& f, SequenceData& seq_data, const wxString& media_filename)
+{
+    size_t stepSize = rountTo4(seq_data.NumChannels());
+
+    std::vector<bool> used(stepSize, false);
+    size_t usedCount = 0;
+    for (size_t frame = 0; frame < seq_data.NumFrames() && usedCount < stepSize; frame++)
+    {
+        const unsigned char* data = &seq_data[frame][0];
+        for (size_t ch = 0; ch < stepSize; ch++)
+        {
+            if (data[ch] != 0 && !used[ch])
+            {
+                used[ch] = true;
+                usedCount++;
+            }
+        }
+    }
+
+    FSEQV2Writer writer(f, stepSize, seq_data.NumFrames(), seq_data.FrameTime(), media_filename.ToStdString(),
+                        FSEQV2Writer::FindUsedRanges(used), true);
+    for (size_t frame = 0; frame < seq_data.NumFrames(); frame++)
+    {
+        if (!writer.WriteFrame(&seq_data[frame][0])) break;
+    }
+    return writer.Close();
+}
+
 void FileConverter::WriteFalconPiFile( ConvertParameters& params )
 {
     static log4cpp::Category &logger_conversion = log4cpp::Category::getInstance(std::string("log_conversion"));
@@ -1767,6 +1897,17 @@ void FileConverter::WriteFalconPiFile( ConvertParameters& params )
         return;
     }
 
+    if (params.xLightsFrm != nullptr && params.xLightsFrm->UseCompressedFSEQ())
+    {
+        if (!WriteFSEQV2File(f, params.seq_data, params.media_filename != nullptr ? *params.media_filename : wxString("")))
+        {
+            params.ConversionError(wxString("Unable to write file: ")+params.out_filename);
+        }
+        f.Close();
+        logger_conversion.debug("End fseq v2 write");
+        return;
+    }
+
     wxUint8* buf;
     buf = (wxUint8 *)calloc(sizeof(wxUint8), 1024);
 
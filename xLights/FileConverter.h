@@ -11,6 +11,7 @@ class xLightsFrame; // forward declare to prevent including the world
 class ConvertDialog;
 class ConvertLogDialog;
 class OutputManager;
+class wxFile;
 
 class ConvertParameters
 {
@@ -74,9 +75,11 @@ class FileConverter
         static void ReadConductorFile(ConvertParameters& params);
         static void ReadFalconFile(ConvertParameters& params);
         static void WriteFalconPiFile(ConvertParameters& params);
+        static bool WriteFSEQV2File(wxFile& f, SequenceData& seq_data, const wxString& media_filename);
 
     protected:
     private:
+        static void ReadFalconV2File(ConvertParameters& params, wxFile& f);
 };
 
 #endif // FILECONVERTER_H
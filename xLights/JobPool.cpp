@@ -133,9 +133,12 @@ void* JobPoolWorker::Entry()
 
         Job *job = GetJob();
         if (job) {
+            // a job may requeue itself from Process so it can already be running (or
+            // finished and deleted) on another thread by the time ProcessJob returns
+            bool deleteWhenComplete = job->DeleteWhenComplete();
             // Call user's implementation for processing request
             ProcessJob(job);
-            if (job->DeleteWhenComplete()) {
+            if (deleteWhenComplete) {
                 delete job;
             }
             job = NULL;
@@ -21,6 +21,7 @@ public:
     virtual void Process() = 0;
     virtual std::string GetStatus() = 0;
     
+    // read before Process is called, a job that requeues itself must return false
     virtual bool DeleteWhenComplete() = 0;
 };
 
@@ -28,23 +28,37 @@
 #include "models/SingleLineModel.h"
 #include "UtilClasses.h"
 #include "AudioManager.h"
+#include "RenderProfiler.h"
 #include <log4cpp/Category.hh>
 
 #include <random>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 // This is needed for visual studio
 #ifdef _MSC_VER
 #define M_PI_2 1.57079632679489661923
 #endif
 
-PixelBufferClass::PixelBufferClass(xLightsFrame *f, bool b) : frame(f)
+PixelBufferClass::PixelBufferClass(xLightsFrame *f, bool b, RenderProfiler *p) : frame(f), profiler(p)
 {
     numLayers = 0;
+    modelStrand = -1;
+    modelNode = -1;
     zbModel = nullptr;
     ssModel = nullptr;
     onlyOnMain = b;
 }
 
+void PixelBufferClass::ProfileLayerSetting(const std::string& setting, long long startUS)
+{
+    if (profiler != nullptr && profiler->IsRunning())
+    {
+        profiler->AddLayerSetting(setting, RenderProfiler::NowUS() - startUS);
+    }
+}
+
 PixelBufferClass::~PixelBufferClass()
 {
     if (ssModel != nullptr)
@@ -100,6 +114,9 @@ void PixelBufferClass::reset(int nlayers, int timing)
 void PixelBufferClass::InitBuffer(const Model &pbc, int layers, int timing, bool zeroBased)
 {
     modelName = pbc.name;
+    seedName = pbc.name;
+    modelStrand = -1;
+    modelNode = -1;
     if (zeroBased)
     {
         zbModel = pbc.GetModelManager().CreateModel(pbc.GetModelXml(), zeroBased);
@@ -113,6 +130,11 @@ void PixelBufferClass::InitBuffer(const Model &pbc, int layers, int timing, bool
 }
 void PixelBufferClass::InitStrandBuffer(const Model &pbc, int strand, int timing, int layers)
 {
+    // effects look up their model by name, a strand is not one so it has none
+    modelName = "";
+    seedName = pbc.name;
+    modelStrand = strand;
+    modelNode = -1;
     if (ssModel == nullptr) {
         ssModel = new SingleLineModel(pbc.GetModelManager());
     }
@@ -124,6 +146,9 @@ void PixelBufferClass::InitStrandBuffer(const Model &pbc, int strand, int timing
 void PixelBufferClass::InitNodeBuffer(const Model &pbc, int strand, int node, int timing)
 {
     modelName = pbc.name;
+    seedName = pbc.name;
+    modelStrand = strand;
+    modelNode = node;
     if (ssModel == nullptr) {
         ssModel = new SingleLineModel(pbc.GetModelManager());
     }
@@ -150,34 +175,30 @@ void PixelBufferClass::Clear(int which)
 
 void PixelBufferClass::GetNodeChannelValues(size_t nodenum, unsigned char *buf)
 {
-    layers[0]->buffer.Nodes[nodenum]->GetForChannels(buf);
+    layers[0]->buffer.packedNodes.GetForChannels(nodenum, buf);
 }
 void PixelBufferClass::SetNodeChannelValues(size_t nodenum, const unsigned char *buf)
 {
-    layers[0]->buffer.Nodes[nodenum]->SetFromChannels(buf);
+    layers[0]->buffer.packedNodes.SetFromChannels(nodenum, buf);
 }
 xlColor PixelBufferClass::GetNodeColor(size_t nodenum) const
 {
     xlColor color;
-    layers[0]->buffer.Nodes[nodenum]->GetColor(color);
+    layers[0]->buffer.packedNodes.GetColor(nodenum, color);
     return color;
 }
 int PixelBufferClass::NodeStartChannel(size_t nodenum) const
 {
-    return layers[0]->buffer.Nodes.size() && nodenum < layers[0]->buffer.Nodes.size() ? layers[0]->buffer.Nodes[nodenum]->ActChan: 0;
+    const PackedNodeTable &nodes = layers[0]->buffer.packedNodes;
+    return nodenum < nodes.size() ? nodes.startChannel[nodenum] : 0;
 }
 int PixelBufferClass::GetNodeCount() const
 {
-    return layers[0]->buffer.Nodes.size();
+    return layers[0]->buffer.packedNodes.size();
 }
 int PixelBufferClass::GetChanCountPerNode() const
 {
-    size_t NodeCnt=GetNodeCount();
-    if (NodeCnt == 0)
-    {
-        return 0;
-    }
-    return layers[0]->buffer.Nodes[0]->GetChanCount();
+    return layers[0]->buffer.packedNodes.chanCountPerNode;
 }
 
 
@@ -288,14 +309,7 @@ xlColor PixelBufferClass::mixColors(const wxCoord &x, const wxCoord &y, const xl
 
     HSVValue hsv0;
     HSVValue hsv1;
-    bool handlesAlpha = MixTypeHandlesAlpha(layers[layer]->mixType);
-    if (!handlesAlpha && layers[layer]->fadeFactor != 1.0)
-    {
-        //need to fade the first here as we're not mixing anything
-        hsv0 = c0.asHSV();
-        hsv0.value *= layers[layer]->fadeFactor;
-        c0 = hsv0;
-    }
+    // fade has already been applied to c0 by PrepareLayerColors
 
     float svthresh = layers[layer]->effectMixThreshold;
     if (layers[layer]->effectMixVaries)
@@ -525,396 +539,397 @@ xlColor PixelBufferClass::mixColors(const wxCoord &x, const wxCoord &y, const xl
 }
 
 
-void PixelBufferClass::GetMixedColor(int node, xlColor& c, const std::vector<bool> & validLayers, int EffectPeriod)
-{
+// Layers are mixed a whole layer at a time rather than node by node.  PrepareLayerColors gathers
+// the layer's node colors and applies masks, sparkles, brightness/contrast and fade, then
+// BlendLayer mixes them onto the layers below held in mixedColors.
+//
+// Brightness, contrast and fade used to round trip every pixel through HSV.  Scaling the HSV value
+// scales all three rgb channels by the same factor, so they are now done as integer scaling of the
+// rgb channels.  The result can differ from the HSV path by at most one level per channel for
+// each of those steps, all the mix types themselves are bit exact.
 
-    unsigned short &sparkle = layers[0]->buffer.Nodes[node]->sparkle;
-    int cnt = 0;
-    c = xlBLACK;
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define XL_BLEND_SSE2
+#endif
 
-    int effStartPer, effEndPer;
-    layers[0]->buffer.GetEffectPeriods(effStartPer, effEndPer);
-    float offset = ((float)(EffectPeriod - effStartPer)) / ((float)(effEndPer - effStartPer));
-    offset = std::min(offset, 1.0f);
+enum SimpleBlend {
+    BLEND_ADDITIVE,
+    BLEND_SUBTRACTIVE,
+    BLEND_MIN,
+    BLEND_MAX
+};
 
-    for (int layer = numLayers - 1; layer >= 0; layer--)
-    {
-        if (validLayers[layer])
-        {
-            auto thelayer = layers[layer];
-
-            int x = thelayer->buffer.Nodes[node]->Coords[0].bufX;
-            int y = thelayer->buffer.Nodes[node]->Coords[0].bufY;
-
-            xlColor color;
-            if (layers[layer]->isMasked(x, y)
-                || x < 0
-                || y < 0
-                || x >= thelayer->BufferWi
-                || y >= thelayer->BufferHt
-               ) {
-                color = xlBLACK;
-                color.alpha = 0;
-            } else {
-                thelayer->buffer.GetPixel(x, y, color);
-            }
-
-            // add sparkles
-            if (color != xlBLACK &&
-                (thelayer->music_sparkle_count ||
-                 thelayer->sparkle_count > 0 ||
-                 thelayer->SparklesValueCurve.IsActive())
-                )
-            {
-                int sc = thelayer->sparkle_count;
-                if (thelayer->SparklesValueCurve.IsActive())
-                {
-                    sc = (int)thelayer->SparklesValueCurve.GetOutputValueAt(offset);
-                }
+// per channel saturating blends, src is the layer being mixed onto dst
+template <SimpleBlend type>
+static void BlendSimple(xlColor *dst, const xlColor *src, size_t count)
+{
+    size_t i = 0;
+#ifdef XL_BLEND_SSE2
+    static_assert(sizeof(xlColor) == 4, "xlColor must be packed rgba");
+    const __m128i opaque = _mm_set1_epi32((int)0xFF000000);
+    for (; i + 4 <= count; i += 4) {
+        __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+        __m128i r;
+        switch (type) {
+            case BLEND_ADDITIVE:
+                r = _mm_adds_epu8(d, s);
+                break;
+            case BLEND_SUBTRACTIVE:
+                r = _mm_subs_epu8(d, s);
+                break;
+            case BLEND_MIN:
+                r = _mm_min_epu8(d, s);
+                break;
+            default:
+                r = _mm_max_epu8(d, s);
+                break;
+        }
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_or_si128(r, opaque));
+    }
+#endif
+    for (; i < count; i++) {
+        const xlColor &s = src[i];
+        xlColor &d = dst[i];
+        switch (type) {
+            case BLEND_ADDITIVE:
+                d.Set(std::min(d.red + s.red, 255), std::min(d.green + s.green, 255), std::min(d.blue + s.blue, 255));
+                break;
+            case BLEND_SUBTRACTIVE:
+                d.Set(std::max(d.red - s.red, 0), std::max(d.green - s.green, 0), std::max(d.blue - s.blue, 0));
+                break;
+            case BLEND_MIN:
+                d.Set(std::min(d.red, s.red), std::min(d.green, s.green), std::min(d.blue, s.blue));
+                break;
+            default:
+                d.Set(std::max(d.red, s.red), std::max(d.green, s.green), std::max(d.blue, s.blue));
+                break;
+        }
+    }
+}
 
-                if (thelayer->music_sparkle_count &&
-                    thelayer->buffer.GetMedia() != nullptr)
-                {
-                    float f = 0.0;
-                    std::list<float>* pf = thelayer->buffer.GetMedia()->GetFrameData(thelayer->buffer.curPeriod, FRAMEDATA_HIGH, "");
-                    if (pf != nullptr)
-                    {
-                        f = *pf->begin();
-                    }
-                    sc = (int)((float)sc * f);
-                }
-                switch (sparkle % (208 - sc))
-                {
-                case 1:
-                case 7:
-                    // too dim
-                    //color.Set("#444444");
-                    break;
-                case 2:
-                case 6:
-                    color.Set(0x88, 0x88, 0x88);
-                    break;
-                case 3:
-                case 5:
-                    color.Set(0xbb, 0xbb, 0xbb);
-                    break;
-                case 4:
-                    color.Set(255, 255, 255);
-                    break;
-                }
-                sparkle++;
-            }
-            int b = 0;
-            if (thelayer->BrightnessValueCurve.IsActive())
-            {
-                b = (int)thelayer->BrightnessValueCurve.GetOutputValueAt(offset);
-            }
-            else
-            {
-                b = thelayer->brightness;
-            }
-            if (b != 100 || thelayer->contrast != 0)
-            {
-                HSVValue hsv = color.asHSV();
-                hsv.value = hsv.value * ((double)b/100.0);
+static void BlendNormal(xlColor *dst, const xlColor *src, size_t count, double fadeFactor, float threshold)
+{
+    // same alpha scaling as the per pixel code did, looked up rather than recomputed
+    uint8_t alphas[256];
+    for (int a = 0; a < 256; a++) {
+        alphas[a] = a * fadeFactor * (1.0 - threshold);
+    }
+    for (size_t i = 0; i < count; i++) {
+        xlColor c0 = src[i];
+        c0.alpha = alphas[c0.alpha];
+        dst[i] = c0.AlphaBlend(dst[i]);
+    }
+}
 
-                // Apply Contrast
-                if (hsv.value< 0.5)
-                {
-                    // reduce brightness when below 0.5 in the V value or increase if > 0.5
-                    hsv.value = hsv.value - (hsv.value* ((double)thelayer->contrast/100.0));
-                }
-                else
-                {
-                    hsv.value = hsv.value + (hsv.value* ((double)thelayer->contrast/100.0));
-                }
+static void BlendAverage(xlColor *dst, const xlColor *src, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        // only average when both colors are non-black
+        if (src[i] == xlBLACK) {
+            continue;
+        } else if (dst[i] == xlBLACK) {
+            dst[i] = src[i];
+        } else {
+            dst[i].Set((src[i].red + dst[i].red) / 2, (src[i].green + dst[i].green) / 2, (src[i].blue + dst[i].blue) / 2);
+        }
+    }
+}
 
-                if (hsv.value < 0.0) hsv.value=0.0;
-                if (hsv.value > 1.0) hsv.value=1.0;
-                unsigned char alpha = color.Alpha();
-                color = hsv;
-                color.alpha = alpha;
-            }
+// the HSV value of a color is its largest channel / 255, so the threshold tests
+// only need a table of which of the 256 possible values are above the threshold
+static void BuildValueThreshold(float threshold, bool above[256])
+{
+    for (int v = 0; v < 256; v++) {
+        above[v] = (v / 255.0) > threshold;
+    }
+}
 
-            if (MixTypeHandlesAlpha(thelayer->mixType))
-            {
-                c = mixColors(x, y, color, c, layer);
-            }
-            else
-            {
-                if (cnt == 0 && thelayer->fadeFactor != 1.0)
-                {
-                    //need to fade the first here as we're not mixing anything
-                    HSVValue hsv = color.asHSV();
-                    hsv.value *= thelayer->fadeFactor;
-                    color = hsv;
-                }
-                if (cnt > 0)
-                {
-                    //mix with layer below
-                    c = mixColors(x, y, color, c, layer);
-                }
-                else
-                {
-                    c = color;
-                }
-            }
+static inline uint8_t MaxChannel(const xlColor &c)
+{
+    return std::max(c.red, std::max(c.green, c.blue));
+}
 
-            cnt++;
+// channel * scale[max channel] >> 16 scales the HSV value of a color without leaving rgb
+static void BuildBrightnessScale(int brightness, int contrast, uint32_t scale[256])
+{
+    scale[0] = 0;
+    for (int m = 1; m < 256; m++) {
+        // value * 255 * 100 after brightness, then * 100 after contrast
+        int64_t v = (int64_t)m * brightness;
+        if (v * 2 < 255 * 100) {
+            v *= 100 - contrast;
+        } else {
+            v *= 100 + contrast;
         }
+        v = std::max((int64_t)0, std::min(v, (int64_t)255 * 10000));
+        scale[m] = (uint32_t)((v << 16) / ((int64_t)m * 10000));
     }
 }
 
+static inline void ScaleChannels(xlColor &c, uint32_t scale)
+{
+    c.red = (c.red * scale) >> 16;
+    c.green = (c.green * scale) >> 16;
+    c.blue = (c.blue * scale) >> 16;
+}
 
-//http://blog.ivank.net/fastest-gaussian-blur.html
-
-static void boxesForGauss(int d, int n, std::vector<float> &boxes)  // standard deviation, number of boxes
+void PixelBufferClass::PrepareLayerColors(int layer, float offset)
 {
-    switch (d) {
-        case 2:
-        case 3:
-            boxes.push_back(1.0);
-            break;
-        case 4:
-        case 5:
-        case 6:
-            boxes.push_back(3.0);
-            break;
-        case 7:
-        case 8:
-        case 9:
-            boxes.push_back(5.0);
-            break;
-        case 10:
-        case 11:
-        case 12:
-            boxes.push_back(7.0);
-            break;
-        case 13:
-        case 14:
-        case 15:
-            boxes.push_back(9.0);
-            break;
+    LayerInfo *thelayer = layers[layer];
+    PackedNodeTable &base = layers[0]->buffer.packedNodes;
+    const PackedNodeTable &nodes = thelayer->buffer.packedNodes;
+    size_t count = std::min(base.size(), nodes.size());
+    std::vector<xlColor> &out = thelayer->nodeColors;
+    out.resize(base.size());
+
+    // everything that only depends on the layer is worked out once rather than per node
+    bool sparkles = thelayer->music_sparkle_count ||
+        thelayer->sparkle_count > 0 ||
+        thelayer->SparklesValueCurve.IsActive();
+    int sc = thelayer->sparkle_count;
+    // sparkles cant be timed apart from the rest of the pass so the whole pass is counted against them
+    long long startUS = sparkles ? RenderProfiler::NowUS() : 0;
+    if (sparkles)
+    {
+        if (thelayer->SparklesValueCurve.IsActive())
+        {
+            sc = (int)thelayer->SparklesValueCurve.GetOutputValueAt(offset);
+        }
+
+        if (thelayer->music_sparkle_count &&
+            thelayer->buffer.GetMedia() != nullptr)
+        {
+            float f = 0.0;
+            const FrameDataSpan* pf = thelayer->buffer.GetMedia()->GetFrameData(thelayer->buffer.curPeriod, FRAMEDATA_HIGH, "");
+            if (pf != nullptr)
+            {
+                f = *pf->begin();
+            }
+            sc = (int)((float)sc * f);
+        }
     }
-    float b = boxes.back();
-    switch (d) {
-        case 2:
-        case 4:
-        case 5:
-        case 7:
-        case 8:
-        case 10:
-        case 11:
-        case 13:
-        case 14:
-            boxes.push_back(b);
-            break;
-        default:
-            boxes.push_back(b + 2.0);
-            break;
+
+    int b = 0;
+    if (thelayer->BrightnessValueCurve.IsActive())
+    {
+        b = (int)thelayer->BrightnessValueCurve.GetOutputValueAt(offset);
     }
-    switch (d) {
-        case 4:
-        case 7:
-        case 10:
-        case 13:
-            boxes.push_back(b);
-            break;
-        default:
-            boxes.push_back(b + 2.0);
+    else
+    {
+        b = thelayer->brightness;
+    }
+    bool scaleBrightness = (b != 100 || thelayer->contrast != 0);
+    uint32_t brightnessScale[256];
+    if (scaleBrightness)
+    {
+        BuildBrightnessScale(b, thelayer->contrast, brightnessScale);
     }
 
+    // layers that dont handle alpha get the fade applied before mixing
+    bool fade = !MixTypeHandlesAlpha(thelayer->mixType) && thelayer->fadeFactor != 1.0;
+    uint32_t fadeScale = (uint32_t)(std::max(thelayer->fadeFactor, 0.0) * 65536.0);
 
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!base.IsVisible(i))
+        {
+            continue;
+        }
+        int x = nodes.bufX[i];
+        int y = nodes.bufY[i];
+
+        xlColor color;
+        if (thelayer->isMasked(x, y)
+            || x >= thelayer->BufferWi
+            || y >= thelayer->BufferHt
+           ) {
+            color = xlBLACK;
+            color.alpha = 0;
+        } else {
+            thelayer->buffer.GetPixel(x, y, color);
+        }
 
-    /*
-    float wIdeal = std::sqrt((12.0f*sigma*sigma/n)+1.0f);  // Ideal averaging filter width
-    float wl = std::floor(wIdeal);
-    if ( (((int)wl)%2) == 0) {
-        wl -= 1.0;
-    }
-    float wu = wl+2;
+        // add sparkles
+        if (sparkles && color != xlBLACK)
+        {
+            unsigned short &sparkle = base.sparkle[i];
+            switch (sparkle % (208 - sc))
+            {
+            case 1:
+            case 7:
+                // too dim
+                //color.Set("#444444");
+                break;
+            case 2:
+            case 6:
+                color.Set(0x88, 0x88, 0x88);
+                break;
+            case 3:
+            case 5:
+                color.Set(0xbb, 0xbb, 0xbb);
+                break;
+            case 4:
+                color.Set(255, 255, 255);
+                break;
+            }
+            sparkle++;
+        }
 
-    float mIdeal = (12.0f*sigma*sigma - n*wl*wl - 4.0f*n*wl - 3.0f*n)/(-4.0f*wl - 4.0f);
-    int m = std::round(mIdeal);
+        if (scaleBrightness)
+        {
+            ScaleChannels(color, brightnessScale[MaxChannel(color)]);
+        }
+        if (fade)
+        {
+            ScaleChannels(color, fadeScale);
+            color.alpha = 255;
+        }
+        out[i] = color;
+    }
 
-    for(int i=1; i<(n+1); i++) {
-        boxes.push_back(i<=m?wl:wu);
-        printf("%f  %d:    %f\n", sigma, i,  boxes.back());
+    if (sparkles)
+    {
+        ProfileLayerSetting("Sparkles", startUS);
     }
-    */
 }
 
-#define RED(a, b) a[(b)*4]
-#define GREEN(a, b) a[(b)*4 + 1]
-#define BLUE(a, b) a[(b)*4 + 2]
-#define ALPHA(a, b) a[(b)*4 + 3]
-static inline void SET(float *ar, int idx, float r, float g, float b, float a) {
-    idx *= 4;
-    ar[idx++] = r;
-    ar[idx++] = g;
-    ar[idx++] = b;
-    ar[idx] = a;
-}
+void PixelBufferClass::BlendLayer(int layer, bool first)
+{
+    LayerInfo *thelayer = layers[layer];
+    size_t count = mixedColors.size();
+    if (count == 0)
+    {
+        return;
+    }
+    xlColor *dst = &mixedColors[0];
+    const xlColor *src = &thelayer->nodeColors[0];
+
+    if (first && !MixTypeHandlesAlpha(thelayer->mixType))
+    {
+        // nothing below to mix with
+        std::copy(src, src + count, dst);
+        return;
+    }
+
+    float threshold = thelayer->effectMixThreshold;
+    if (thelayer->effectMixVaries)
+    {
+        threshold = thelayer->buffer.GetEffectTimeIntervalPosition();
+    }
+    if (threshold < 0)
+    {
+        threshold = 0;
+    }
 
-static void boxBlurH_4 (const float  * const scl, float *tcl, int w, int h, float r) {
-    float iarr = 1.0f / (r+r+1.0f);
-    for(int i=0; i<h; i++) {
-        int ti = i*w;
-        int li = ti;
-        int ri = ti+r;
-        int maxri = ti + w - 1;
-        int fvIdx = ti;
-        int lvIdx = ti+w-1;
-
-        float valr = (r+1.0) * RED(scl,fvIdx);
-        float valg = (r+1.0) * GREEN(scl,fvIdx);
-        float valb = (r+1.0) * BLUE(scl,fvIdx);
-        float vala = (r+1.0) * ALPHA(scl,fvIdx);
-
-        float fvRed = RED(scl, fvIdx);
-        float fvGreen = GREEN(scl, fvIdx);
-        float fvBlue = BLUE(scl, fvIdx);
-        float fvAlpha = ALPHA(scl, fvIdx);
-        float lvRed = RED(scl, lvIdx);
-        float lvGreen = GREEN(scl, lvIdx);
-        float lvBlue = BLUE(scl, lvIdx);
-        float lvAlpha = ALPHA(scl, lvIdx);
-
-        for (int j=0; j<r; j++) {
-            int idx = j < w ? ti+j : lvIdx;
-            valr += RED(scl, idx);
-            valg += GREEN(scl, idx);
-            valb += BLUE(scl, idx);
-            vala += ALPHA(scl, idx);
-        }
-        for (int j=0  ; j<=r ; j++) {
-            int idx = ri <= maxri ? ri++ : lvIdx;
-            valr += RED(scl, idx) - fvRed;
-            valg += GREEN(scl, idx) - fvGreen;
-            valb += BLUE(scl, idx) - fvBlue;
-            vala += ALPHA(scl, idx) - fvAlpha;
-
-            if (ti <= maxri) {
-                SET(tcl, ti, valr*iarr, valg*iarr, valb*iarr, vala*iarr);
-                ti++;
+    bool above[256];
+    const PackedNodeTable &nodes = thelayer->buffer.packedNodes;
+    switch (thelayer->mixType)
+    {
+    case Mix_Normal:
+        BlendNormal(dst, src, count, thelayer->fadeFactor, threshold);
+        break;
+    case Mix_Additive:
+        BlendSimple<BLEND_ADDITIVE>(dst, src, count);
+        break;
+    case Mix_Subtractive:
+        BlendSimple<BLEND_SUBTRACTIVE>(dst, src, count);
+        break;
+    case Mix_Min:
+        BlendSimple<BLEND_MIN>(dst, src, count);
+        break;
+    case Mix_Max:
+        BlendSimple<BLEND_MAX>(dst, src, count);
+        break;
+    case Mix_Average:
+        BlendAverage(dst, src, count);
+        break;
+    case Mix_Mask1:
+        // first masks second
+        BuildValueThreshold(threshold, above);
+        for (size_t i = 0; i < count; i++)
+        {
+            if (above[MaxChannel(src[i])])
+            {
+                dst[i].Set(0, 0, 0);
+            }
+        }
+        break;
+    case Mix_Mask2:
+        // second masks first
+        BuildValueThreshold(threshold, above);
+        for (size_t i = 0; i < count; i++)
+        {
+            if (above[MaxChannel(dst[i])])
+            {
+                dst[i].Set(0, 0, 0);
+            }
+            else
+            {
+                dst[i] = src[i];
             }
         }
-        for (int j=r+1; j<w-r; j++) {
-            int c = ri <= maxri ? ri++ : lvIdx;
-            int c2 = li <= maxri ? li++ : lvIdx;
-            valr += RED(scl, c) - RED(scl, c2);
-            valg += GREEN(scl, c) - GREEN(scl, c2);
-            valb += BLUE(scl, c) - BLUE(scl, c2);
-            vala += ALPHA(scl, c) - ALPHA(scl, c2);
-            if (ti <= maxri) {
-                SET(tcl, ti, valr*iarr, valg*iarr, valb*iarr, vala*iarr);
-                ti++;
+        break;
+    case Mix_Layered:
+        BuildValueThreshold(threshold, above);
+        for (size_t i = 0; i < count; i++)
+        {
+            if (!above[MaxChannel(dst[i])])
+            {
+                dst[i] = src[i];
             }
         }
-
-        for (int j=w-r; j<w  ; j++) {
-            int c2 = li <= maxri ? li++: lvIdx;
-            valr += lvRed - RED(scl, c2);
-            valg += lvGreen - GREEN(scl, c2);
-            valb += lvBlue - BLUE(scl, c2);
-            vala += lvAlpha - ALPHA(scl, c2);
-            if (ti <= maxri) {
-                SET(tcl, ti, valr*iarr, valg*iarr, valb*iarr, vala*iarr);
-                ti++;
+        break;
+    case Mix_1_reveals_2:
+        BuildValueThreshold(threshold, above);
+        for (size_t i = 0; i < count; i++)
+        {
+            if (above[MaxChannel(src[i])])
+            {
+                dst[i] = src[i];
             }
         }
-    }
-}
-static void boxBlurT_4 (const float * const scl, float *tcl, int w, int h, float r) {
-    float iarr = 1.0f / (r+r+1.0f);
-    for(int i=0; i<w; i++) {
-        int ti = i;
-        int li = ti;
-        int ri = ti+r*w;
-
-        int maxri = ti+w*(h-1);
-
-        int fvIdx = ti;
-        int lvIdx = ti+w*(h-1);
-
-        float fvRed = RED(scl, fvIdx);
-        float fvGreen = GREEN(scl, fvIdx);
-        float fvBlue = BLUE(scl, fvIdx);
-        float fvAlpha = ALPHA(scl, fvIdx);
-        float lvRed = RED(scl, lvIdx);
-        float lvGreen = GREEN(scl, lvIdx);
-        float lvBlue = BLUE(scl, lvIdx);
-        float lvAlpha = ALPHA(scl, lvIdx);
-
-        float valr = (r+1)*fvRed;
-        float valg = (r+1)*fvGreen;
-        float valb = (r+1)*fvBlue;
-        float vala = (r+1)*fvAlpha;
-
-        for(int j=0; j<r; j++) {
-            int idx = j < w ? ti+j*w : lvIdx;
-            valr += RED(scl, idx);
-            valg += GREEN(scl, idx);
-            valb += BLUE(scl, idx);
-            vala += ALPHA(scl, idx);
-        }
-        for(int j=0  ; j<=r ; j++) {
-            int idx = ri <= maxri ? ri : lvIdx;
-            valr += RED(scl, idx) - fvRed;
-            valg += GREEN(scl, idx) - fvGreen;
-            valb += BLUE(scl, idx) - fvBlue;
-            vala += ALPHA(scl, idx) - fvAlpha;
-            if (ti <= maxri) {
-                SET(tcl, ti, valr*iarr, valg*iarr, valb*iarr, vala*iarr);
+        break;
+    case Mix_2_reveals_1:
+        BuildValueThreshold(threshold, above);
+        for (size_t i = 0; i < count; i++)
+        {
+            if (!above[MaxChannel(dst[i])])
+            {
+                dst[i] = src[i];
             }
-            ri+=w;
-            ti+=w;
-        }
-        for(int j=r+1; j<h-r; j++) {
-            int c = ri <= maxri ? ri : lvIdx;
-            int c2 = li <= maxri ? li : lvIdx;
-            valr += RED(scl, c) - RED(scl, c2);
-            valg += GREEN(scl, c) - GREEN(scl, c2);
-            valb += BLUE(scl, c) - BLUE(scl, c2);
-            vala += ALPHA(scl, c) - ALPHA(scl, c2);
-            if (ti <= maxri) {
-                SET(tcl, ti, valr*iarr, valg*iarr, valb*iarr, vala*iarr);
+        }
+        break;
+    case Mix_BottomTop:
+        for (size_t i = 0; i < count && i < nodes.size(); i++)
+        {
+            if (nodes.bufY[i] < thelayer->BufferHt / 2)
+            {
+                dst[i] = src[i];
             }
-            li+=w; ri+=w; ti+=w;
-        }
-        for(int j=h-r; j<h  ; j++) {
-            int c2 = li <= maxri ? li : lvIdx;
-            valr += lvRed - RED(scl, c2);
-            valg += lvGreen - GREEN(scl, c2);
-            valb += lvBlue - BLUE(scl, c2);
-            vala += lvAlpha - ALPHA(scl, c2);
-            if (ti <= maxri) {
-                SET(tcl, ti, valr*iarr, valg*iarr, valb*iarr, vala*iarr);
+        }
+        break;
+    case Mix_LeftRight:
+        for (size_t i = 0; i < count && i < nodes.size(); i++)
+        {
+            if (nodes.bufX[i] < thelayer->BufferWi / 2)
+            {
+                dst[i] = src[i];
             }
-            li += w;
-            ti += w;
         }
+        break;
+    default:
+        // the hsv based mixes stay per pixel
+        for (size_t i = 0; i < count && i < nodes.size(); i++)
+        {
+            dst[i] = mixColors(nodes.bufX[i], nodes.bufY[i], src[i], dst[i], layer);
+        }
+        break;
     }
 }
-static void boxBlur_4(float *scl, float *tcl, int w, int h, float r, int size) {
-    memcpy(tcl, scl, sizeof(float)*4*size);
-    boxBlurH_4(tcl, scl, w, h, r);
-    boxBlurT_4(scl, tcl, w, h, r);
-}
 
-static void gaussBlur_4(float *scl, float *tcl, int w, int h, int r, int size) {
-    std::vector<float> bxs;
-    boxesForGauss(r - 1, 3, bxs);
-    boxBlur_4 (scl, tcl, w, h, (bxs[0]-1)/2, size);
-    boxBlur_4 (tcl, scl, w, h, (bxs[1]-1)/2, size);
-    boxBlur_4 (scl, tcl, w, h, (bxs[2]-1)/2, size);
-}
 
-static inline int roundInt(float r) {
-    int tmp = static_cast<int> (r);
-    tmp += (r-tmp>=.5) - (r-tmp<=-.5);
-    return tmp;
-}
 void PixelBufferClass::Blur(LayerInfo* layer, float offset)
 {
     int b = 0;
@@ -927,77 +942,7 @@ void PixelBufferClass::Blur(LayerInfo* layer, float offset)
         b = layer->blur;
     }
 
-    if (layer->BufferWi == 1 && layer->BufferHt == 1) {
-        return;
-    }
-    if (b < 2) {
-        return;
-    } else if (b > 2 && layer->BufferWi > 6 && layer->BufferHt > 6) {
-        int pixCount = layer->buffer.pixels.size();
-        float * input = new float[pixCount * 4];
-        float * tmp = new float[pixCount * 4];
-        for (int x = 0; x < pixCount; x++) {
-            const xlColor &c = layer->buffer.pixels[x];
-            input[x * 4] = c.red;
-            input[x * 4 + 1] = c.green;
-            input[x * 4 + 2] = c.blue;
-            input[x * 4 + 3] = c.alpha;
-        }
-        gaussBlur_4(input, tmp, layer->BufferWi, layer->BufferHt, b, pixCount);
-
-        for (int x = 0; x < pixCount; x++) {
-            layer->buffer.pixels[x].Set(roundInt(tmp[x*4]),
-                                        roundInt(tmp[x*4 + 1]),
-                                        roundInt(tmp[x*4 + 2]),
-                                        roundInt(tmp[x*4 + 3]));
-        }
-        delete [] input;
-        delete [] tmp;
-    } else {
-        int d = 0;
-        int u = 0;
-        if (b % 2 == 0)
-        {
-            d = b / 2;
-            u = (b - 1) / 2;
-        }
-        else
-        {
-            d = (b - 1) / 2;
-            u = (b - 1) / 2;
-        }
-        RenderBuffer orig(layer->buffer);
-        for (int x = 0; x < layer->BufferWi; x++)
-        {
-            for (int y = 0; y < layer->BufferHt; y++)
-            {
-                int r = 0;
-                int g = 0;
-                int b = 0;
-                int a = 0;
-                int sm = 0;
-                for (int i = x - d; i <= x + u; i++)
-                {
-                    if (i >= 0 && i < layer->BufferWi)
-                    {
-                        for (int j = y - d; j <= y + u; j++)
-                        {
-                            if (j >=0 && j < layer->BufferHt)
-                            {
-                                const xlColor &c = orig.GetPixel(i, j);
-                                r += c.red;
-                                g += c.green;
-                                b += c.blue;
-                                a += c.alpha;
-                                ++sm;
-                            }
-                        }
-                    }
-                }
-                layer->buffer.SetPixel(x, y, xlColor(r/sm, g/sm, b/sm, a/sm));
-            }
-        }
-    }
+    BlurPixels(&layer->buffer.pixels[0], layer->BufferWi, layer->BufferHt, b, layer->blurScratch);
 }
 
 void PixelBufferClass::SetPalette(int layer, xlColorVector& newcolors, xlColorCurveVector& newcc)
@@ -1178,7 +1123,7 @@ RenderBuffer& PixelBufferClass::BufferForLayer(int layer)
 void PixelBufferClass::SetLayer(int newlayer, int period, bool resetState)
 {
     CurrentLayer=newlayer;
-    layers[CurrentLayer]->buffer.SetState(period, resetState, modelName);
+    layers[CurrentLayer]->buffer.SetState(period, resetState, modelName, newlayer, seedName, modelStrand, modelNode);
 }
 
 void PixelBufferClass::SetTimes(int layer, int startTime, int endTime)
@@ -1198,45 +1143,53 @@ static inline bool IsInRange(const std::vector<NodeRange> &restrictRange, size_t
 }
 void PixelBufferClass::GetColors(unsigned char *fdata, const std::vector<NodeRange> &restrictRange) {
 
-    // KW ... I think this needs to be optimised
-
     if (layers[0] != nullptr) // I dont like this ... it should never be null
     {
-        for (size_t n = 0; n < layers[0]->buffer.Nodes.size(); n++) {
-            size_t start = NodeStartChannel(n);
-            if (IsInRange(restrictRange, start)) {
-                if (layers[0]->buffer.Nodes[n]->model != nullptr) // nor this
-                {
-                    DimmingCurve *curve = layers[0]->buffer.Nodes[n]->model->modelDimmingCurve;
-                    if (curve != nullptr) {
-                        xlColor color;
-                        layers[0]->buffer.Nodes[n]->GetColor(color);
-                        curve->apply(color);
-                        layers[0]->buffer.Nodes[n]->SetColor(color);
-                    }
-                }
-                layers[0]->buffer.Nodes[n]->GetForChannels(&fdata[start]);
+        PackedNodeTable &nodes = layers[0]->buffer.packedNodes;
+        size_t count = nodes.size();
+
+        // nodes of a model almost always share one model, only look the curve up when it changes
+        const Model *lastModel = nullptr;
+        DimmingCurve *curve = nullptr;
+        xlColor color;
+        for (size_t n = 0; n < count; n++) {
+            size_t start = nodes.startChannel[n];
+            if (!IsInRange(restrictRange, start)) {
+                continue;
             }
+            const Model *m = nodes.models[n];
+            if (m != lastModel) {
+                lastModel = m;
+                curve = m == nullptr ? nullptr : m->modelDimmingCurve;
+            }
+            if (curve != nullptr) {
+                nodes.GetColor(n, color);
+                curve->apply(color);
+                nodes.SetColor(n, color);
+            }
+            nodes.GetForChannels(n, &fdata[start]);
         }
     }
 }
 void PixelBufferClass::SetColors(int layer, const unsigned char *fdata)
 {
     xlColor color;
-    for (size_t n = 0; n < layers[layer]->buffer.Nodes.size(); n++)
+    RenderBuffer &buffer = layers[layer]->buffer;
+    PackedNodeTable &nodes = buffer.packedNodes;
+    size_t count = nodes.size();
+    for (size_t n = 0; n < count; n++)
     {
         int start = NodeStartChannel(n);
-        layers[layer]->buffer.Nodes[n]->SetFromChannels(&fdata[start]);
-        layers[layer]->buffer.Nodes[n]->GetColor(color);
-        DimmingCurve *curve = layers[layer]->buffer.Nodes[n]->model->modelDimmingCurve;
+        nodes.SetFromChannels(n, &fdata[start]);
+        nodes.GetColor(n, color);
+        DimmingCurve *curve = nodes.models[n]->modelDimmingCurve;
         if (curve != nullptr) {
             curve->reverse(color);
         }
 
-        for (size_t x = 0; x < layers[layer]->buffer.Nodes[n]->Coords.size(); x++)
+        for (uint32_t x = nodes.coordStart[n]; x < nodes.coordStart[n + 1]; x++)
         {
-            layers[layer]->buffer.SetPixel(layers[layer]->buffer.Nodes[n]->Coords[x].bufX,
-                                           layers[layer]->buffer.Nodes[n]->Coords[x].bufY, color);
+            buffer.SetPixel(nodes.coordX[x], nodes.coordY[x], color);
         }
     }
 }
@@ -1275,9 +1228,7 @@ void PixelBufferClass::RotoZoom(LayerInfo* layer, float offset)
 
     if (rotation != 0.0 || zoom != 1.0)
     {
-        static const float PI_2 = 6.283185307f;
-        xlColor c;
-        RenderBuffer orig(layer->buffer);
+        long long startUS = RenderProfiler::NowUS();
         int q = layer->zoomquality;
         int cx = layer->pivotpointx;
         if (layer->PivotPointXValueCurve.IsActive())
@@ -1289,36 +1240,78 @@ void PixelBufferClass::RotoZoom(LayerInfo* layer, float offset)
         {
             cy = layer->PivotPointYValueCurve.GetOutputValueAt(offset);
         }
-        float inc = 1.0 / (float)q;
 
-        float angle = PI_2 * -rotation;
-        float xoff = (cx * layer->buffer.BufferWi) / 100.0;
-        float yoff = (cy * layer->BufferHt) / 100.0;
-        float anglecos = cos(-angle);
-        float anglesin = sin(-angle);
+        int w = layer->BufferWi;
+        int h = layer->BufferHt;
+        int pixCount = w * h;
+        if (pixCount == 0 || layer->buffer.pixels.size() < (size_t)pixCount) return;
 
+        // most layers use fixed settings so the map is only built on the first frame
+        if (layer->rotoZoomMap.size() != (size_t)pixCount || layer->rotoZoomMapWi != w ||
+            layer->rotoZoomMapZoom != zoom || layer->rotoZoomMapRotation != rotation ||
+            layer->rotoZoomMapQuality != q || layer->rotoZoomMapCX != cx || layer->rotoZoomMapCY != cy)
+        {
+            BuildRotoZoomMap(layer, zoom, rotation, q, cx, cy);
+        }
 
-        layer->buffer.Clear();
-        for (int x = 0; x < layer->BufferWi; x++)
+        // every pixel ends up as a copy of one source pixel or cleared
+        layer->rotoZoomScratch.assign(layer->buffer.pixels.begin(), layer->buffer.pixels.begin() + pixCount);
+        const int *map = &layer->rotoZoomMap[0];
+        const xlColor *src = &layer->rotoZoomScratch[0];
+        xlColor *dest = &layer->buffer.pixels[0];
+        const xlColor cleared(0, 0, 0, 0);
+        for (int i = 0; i < pixCount; i++)
         {
-            for (int i = 0; i < q; i++)
+            dest[i] = map[i] >= 0 ? src[map[i]] : cleared;
+        }
+        ProfileLayerSetting("RotoZoom", startUS);
+    }
+}
+
+// Works out which source pixel ends up in each destination pixel.
+// The pixels are pushed forward through the transform in the same order the rotozoom always
+// has so where several land on one pixel the last one wins and gaps stay clear exactly as before.
+void PixelBufferClass::BuildRotoZoomMap(LayerInfo* layer, float zoom, float rotation, int q, int cx, int cy)
+{
+    static const float PI_2 = 6.283185307f;
+
+    layer->rotoZoomMapZoom = zoom;
+    layer->rotoZoomMapRotation = rotation;
+    layer->rotoZoomMapQuality = q;
+    layer->rotoZoomMapCX = cx;
+    layer->rotoZoomMapCY = cy;
+    layer->rotoZoomMapWi = layer->BufferWi;
+
+    int w = layer->BufferWi;
+    int h = layer->BufferHt;
+    layer->rotoZoomMap.assign(w * h, -1);
+
+    float inc = 1.0 / (float)q;
+
+    float angle = PI_2 * -rotation;
+    float xoff = (cx * layer->buffer.BufferWi) / 100.0;
+    float yoff = (cy * layer->BufferHt) / 100.0;
+    float anglecos = cos(-angle);
+    float anglesin = sin(-angle);
+
+    for (int x = 0; x < w; x++)
+    {
+        for (int i = 0; i < q; i++)
+        {
+            for (int y = 0; y < h; y++)
             {
-                for (int y = 0; y < layer->BufferHt; y++)
+                for (int j = 0; j < q; j++)
                 {
-                    orig.GetPixel(x, y, c);
-                    for (int j = 0; j < q; j++)
+                    float xx = (float)x + ((float)i * inc) - xoff;
+                    float yy = (float)y + ((float)j * inc) - yoff;
+                    float u = xoff + anglecos * xx * zoom + anglesin * yy * zoom;
+                    if (u >= 0 && u < w)
                     {
-                        float xx = (float)x + ((float)i * inc) - xoff;
-                        float yy = (float)y + ((float)j * inc) - yoff;
-                        float u = xoff + anglecos * xx * zoom + anglesin * yy * zoom;
-                        if (u >= 0 && u < layer->BufferWi)
-                        {
-                            float v = yoff + -anglesin * xx * zoom + anglecos * yy * zoom;
+                        float v = yoff + -anglesin * xx * zoom + anglecos * yy * zoom;
 
-                            if (v >= 0 && v < layer->BufferHt)
-                            {
-                                layer->buffer.SetPixel(u, v, c);
-                            }
+                        if (v >= 0 && v < h)
+                        {
+                            layer->rotoZoomMap[(int)v * w + (int)u] = y * w + x;
                         }
                     }
                 }
@@ -1329,8 +1322,6 @@ void PixelBufferClass::RotoZoom(LayerInfo* layer, float offset)
 
 void PixelBufferClass::CalcOutput(int EffectPeriod, const std::vector<bool> & validLayers)
 {
-    xlColor color;
-    HSVValue hsv;
     int curStep;
 
     // blur all the layers if necessary ... before the merge?
@@ -1344,7 +1335,9 @@ void PixelBufferClass::CalcOutput(int EffectPeriod, const std::vector<bool> & va
         // do gausian blur
         if (layers[layer]->BlurValueCurve.IsActive() || layers[layer]->blur > 1)
         {
+            long long startUS = RenderProfiler::NowUS();
             Blur(layers[layer], offset);
+            ProfileLayerSetting("Blur", startUS);
         }
         RotoZoom(layers[layer], offset);
     }
@@ -1391,31 +1384,53 @@ void PixelBufferClass::CalcOutput(int EffectPeriod, const std::vector<bool> & va
             } else {
                 layers[ii]->outMaskFactor = fadeOutFactor;
             }
+            long long startUS = RenderProfiler::NowUS();
             layers[ii]->calculateMask(isFirstFrame);
+            // the name is only built when someone is looking
+            if (profiler != nullptr && profiler->IsRunning()) {
+                if (layers[ii]->inMaskFactor < 1.0) {
+                    ProfileLayerSetting("Transition " + layers[ii]->inTransitionType, startUS);
+                } else if (layers[ii]->outMaskFactor < 1.0) {
+                    ProfileLayerSetting("Transition " + layers[ii]->outTransitionType, startUS);
+                }
+            }
         } else {
             layers[ii]->mask.clear();
         }
     }
 
     // layer calculation and map to output
-    size_t NodeCount = layers[0]->buffer.Nodes.size();
+    PackedNodeTable &nodes = layers[0]->buffer.packedNodes;
+    size_t NodeCount = nodes.size();
+    mixedColors.assign(NodeCount, xlBLACK);
+
+    int effStartPer, effEndPer;
+    layers[0]->buffer.GetEffectPeriods(effStartPer, effEndPer);
+    float offset = ((float)(EffectPeriod - effStartPer)) / ((float)(effEndPer - effStartPer));
+    offset = std::min(offset, 1.0f);
+
+    bool first = true;
+    for (int layer = numLayers - 1; layer >= 0; layer--)
+    {
+        if (validLayers[layer])
+        {
+            PrepareLayerColors(layer, offset);
+            BlendLayer(layer, first);
+            first = false;
+        }
+    }
+
     for(size_t i = 0; i < NodeCount; i++)
     {
-        if (!layers[0]->buffer.Nodes[i]->IsVisible())
+        if (!nodes.IsVisible(i))
         {
             // unmapped pixel - set to black
-            layers[0]->buffer.Nodes[i]->SetColor(xlBLACK);
+            nodes.SetColor(i, xlBLACK);
         }
         else
         {
-            // get blend of two effects
-            GetMixedColor(i,
-                          color,
-                          validLayers, EffectPeriod);
-
-
             // set color for physical output
-            layers[0]->buffer.Nodes[i]->SetColor(color);
+            nodes.SetColor(i, mixedColors[i]);
         }
     }
 }
@@ -1464,6 +1479,125 @@ static int DecodeType(const std::string &type)
 }
 
 
+#define TRANSITION_FIELD_CIRCLE 1
+#define TRANSITION_FIELD_CLOCK 2
+#define TRANSITION_FIELD_BLEND 3
+
+// Per pixel values a transition compares against its progress each frame.
+// They only depend on the buffer size (and the block size for blend) so they are worked out
+// once and shared by every layer of every model with the same dimensions.
+class TransitionField
+{
+public:
+    TransitionField(int t, int w, int h, int a) : type(t), wi(w), ht(h), adjust(a), rng(1234), placed(0) {
+        switch (type) {
+        case TRANSITION_FIELD_CIRCLE:
+            // distance from centre
+            values.resize(wi * ht);
+            for (int x = 0; x < wi; x++) {
+                for (int y = 0; y < ht; y++) {
+                    values[x * ht + y] = sqrt((x - (wi / 2)) * (x - (wi / 2)) + (y - (ht / 2)) * (y - (ht / 2)));
+                }
+            }
+            break;
+        case TRANSITION_FIELD_CLOCK:
+            // angle around the centre 0 -> 2PI
+            values.resize(wi * ht);
+            for (int x = 0; x < wi; x++) {
+                for (int y = 0; y < ht; y++) {
+                    float radianspixel;
+                    if (x - wi / 2 == 0 && y - ht / 2 == 0) {
+                        radianspixel = 0.0;
+                    } else {
+                        radianspixel = atan2(x - wi / 2, y - ht / 2);
+                    }
+                    if (radianspixel < 0) {
+                        radianspixel += 2.0f * (float)M_PI;
+                    }
+                    values[x * ht + y] = radianspixel;
+                }
+            }
+            break;
+        case TRANSITION_FIELD_BLEND:
+            order.assign(wi * ht, -1);
+            break;
+        }
+    }
+
+    // blend reveals random blocks in a fixed order ... extend that order until count blocks are showing
+    // caller must hold the lock
+    void Reveal(int count) {
+        int actualpixels = (wi * ht) / (adjust * adjust);
+        if (actualpixels == 0) {
+            return;
+        }
+        int xpixels = wi / adjust;
+        while (xpixels * adjust < wi) {
+            xpixels++;
+        }
+        int ypixels = ht / adjust;
+        while (ypixels * adjust < ht) {
+            ypixels++;
+        }
+        while (placed < count) {
+            int jy = rng() % actualpixels;
+            int jx = rng() % actualpixels;
+
+            int x = jx % xpixels * adjust;
+            int y = jy % ypixels * adjust;
+            if (order[x * ht + y] == -1) {
+                for (int k = 0; k < adjust; k++) {
+                    if ((x + k) < wi) {
+                        for (int l = 0; l < adjust; l++) {
+                            if ((y + l) < ht) {
+                                order[(x + k) * ht + y + l] = placed;
+                            }
+                        }
+                    }
+                }
+                placed++;
+            }
+        }
+    }
+
+    const int type;
+    const int wi;
+    const int ht;
+    const int adjust;
+    std::vector<float> values;
+
+    // blend only ... the block reveal order for each pixel or -1 if not revealed yet
+    std::mutex lock;
+    std::vector<int> order;
+    std::minstd_rand rng;
+    int placed;
+};
+
+static std::mutex __transitionFieldsLock;
+static std::map<std::tuple<int, int, int, int>, std::weak_ptr<TransitionField>> __transitionFields;
+
+TransitionField &PixelBufferClass::LayerInfo::GetMaskField(bool out, int type, int adjust) {
+    std::shared_ptr<TransitionField> &field = maskFields[out ? 1 : 0];
+    if (field == nullptr || field->type != type || field->wi != BufferWi || field->ht != BufferHt || field->adjust != adjust) {
+        std::unique_lock<std::mutex> lock(__transitionFieldsLock);
+        std::tuple<int, int, int, int> key(type, BufferWi, BufferHt, adjust);
+        field = __transitionFields[key].lock();
+        if (field == nullptr) {
+            // forget any sizes nothing is using any more
+            for (auto it = __transitionFields.begin(); it != __transitionFields.end();) {
+                if (it->second.expired()) {
+                    it = __transitionFields.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            field = std::make_shared<TransitionField>(type, BufferWi, BufferHt, adjust);
+            __transitionFields[key] = field;
+        }
+    }
+    return *field;
+}
+
 void PixelBufferClass::LayerInfo::createFromMiddleMask(bool out) {
     bool reverse = inTransitionReverse;
     float factor = inMaskFactor;
@@ -1524,13 +1658,10 @@ void PixelBufferClass::LayerInfo::createCircleExplodeMask(bool out) {
 
     float rad = maxradius * factor;
 
-    for (int x = 0; x < BufferWi; x++)
+    const std::vector<float> &radius = GetMaskField(out, TRANSITION_FIELD_CIRCLE, 0).values;
+    for (size_t i = 0; i < radius.size(); i++)
     {
-        for (int y = 0; y < BufferHt; y++)
-        {
-            float radius = sqrt((x - (BufferWi / 2)) * (x - (BufferWi / 2)) + (y - (BufferHt / 2)) * (y - (BufferHt / 2)));
-            mask[x * BufferHt + y] = radius < rad ? m2 : m1;
-        }
+        mask[i] = radius[i] < rad ? m2 : m1;
     }
 }
 void PixelBufferClass::LayerInfo::createSquareExplodeMask(bool out)
@@ -1664,34 +1795,18 @@ void PixelBufferClass::LayerInfo::createClockMask(bool out) {
         currentradians = startradians + currentradians;
     }
 
-    for (int x = 0; x < BufferWi; x++)
+    const std::vector<float> &angles = GetMaskField(out, TRANSITION_FIELD_CLOCK, 0).values;
+    for (size_t i = 0; i < angles.size(); i++)
     {
-        for (int y = 0; y < BufferHt; y++)
-        {
-            float radianspixel;
-            if (x - BufferWi / 2 == 0 && y - BufferHt / 2 == 0)
-            {
-                radianspixel = 0.0;
-            }
-            else
-            {
-                radianspixel = atan2(x - BufferWi / 2,
-                                     y - BufferHt / 2);
-            }
-            if (radianspixel < 0)
-            {
-                radianspixel += 2.0f * (float)M_PI;
-            }
-            if (currentradians > 2.0f * (float)M_PI && radianspixel < startradians) {
-                radianspixel += 2.0f * (float)M_PI;
-            }
-
-            bool s_lt_p = radianspixel > startradians;
-            bool c_gt_p = radianspixel < currentradians;
-            mask[x * BufferHt + y] = (s_lt_p && c_gt_p) ? m2 : m1;
+        float radianspixel = angles[i];
+        if (currentradians > 2.0f * (float)M_PI && radianspixel < startradians) {
+            radianspixel += 2.0f * (float)M_PI;
         }
-    }
 
+        bool s_lt_p = radianspixel > startradians;
+        bool c_gt_p = radianspixel < currentradians;
+        mask[i] = (s_lt_p && c_gt_p) ? m2 : m1;
+    }
 }
 
 
@@ -1750,52 +1865,20 @@ void PixelBufferClass::LayerInfo::createBlendMask(bool out) {
         adjust = outTransitionAdjust;
     }
 
-    std::minstd_rand rng(1234);
-
     int pixels = BufferWi * BufferHt;
     adjust = 10 * adjust / 100;
     if (adjust == 0) {
         adjust = 1;
     }
-    int actualpixels = pixels / (adjust * adjust);
     float step = ((float)pixels / (adjust*adjust)) * factor;
-
-    int xpixels = BufferWi / adjust;
-    while (xpixels * adjust < BufferWi) {
-        xpixels++;
-    }
-    int ypixels = BufferHt / adjust;
-    while (ypixels * adjust < BufferHt) {
-        ypixels++;
-    }
-
-    // set all the background first
-    for (int x = 0; x < BufferWi; x++) {
-        for (int y = 0; y < BufferHt; y++) {
-            mask[x * BufferHt + y] = m1;
-        }
-    }
-
-    for (int i = 0; i < step; i++)
-    {
-        int jy = rng() % actualpixels;
-        int jx = rng() % actualpixels;
-
-        int x = jx % xpixels * adjust;
-        int y = jy % ypixels * adjust;
-        if (mask[x * BufferHt + y] == m2) {
-            i--;
-        } else {
-            for (int k = 0; k < adjust; k++) {
-                if ((x + k) < BufferWi) {
-                    for (int l = 0; l < adjust; l++) {
-                        if ((y + l) < BufferHt) {
-                            mask[(x + k) * BufferHt + y + l] = m2;
-                        }
-                    }
-                }
-            }
-        }
+    // blocks are revealed one at a time so this is how many are showing
+    int revealed = step > 0 ? (int)std::ceil(step) : 0;
+
+    TransitionField &field = GetMaskField(out, TRANSITION_FIELD_BLEND, adjust);
+    std::unique_lock<std::mutex> lock(field.lock);
+    field.Reveal(revealed);
+    for (size_t i = 0; i < field.order.size(); i++) {
+        mask[i] = (field.order[i] >= 0 && field.order[i] < revealed) ? m2 : m1;
     }
 }
 
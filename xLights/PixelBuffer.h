@@ -29,9 +29,15 @@
 #include "models/Model.h"
 #include "models/SingleLineModel.h"
 #include "RenderBuffer.h"
+#include "BlurKernels.h"
 #include "ValueCurve.h"
 #include "RenderUtils.h"
 
+#include <memory>
+
+class TransitionField;
+class RenderProfiler;
+
 /**
  * \brief enumeration of the different techniques used in layering effects
  */
@@ -91,6 +97,11 @@ private:
             fadeInSteps = fadeOutSteps = 0;
             inTransitionAdjust = outTransitionAdjust = 0;
             inTransitionReverse = outTransitionReverse = false;
+            rotoZoomMapZoom = 1.0f;
+            rotoZoomMapRotation = 0.0f;
+            rotoZoomMapQuality = 0;
+            rotoZoomMapCX = rotoZoomMapCY = -1;
+            rotoZoomMapWi = 0;
         }
         RenderBuffer buffer;
         std::string bufferType;
@@ -143,11 +154,28 @@ private:
         float outMaskFactor;
         
         std::vector<uint8_t> mask;
+        std::vector<xlColor> nodeColors;    // this layers node colors for the frame being output
+
+        BlurScratch blurScratch;
+
+        // rotozoom destination to source pixel map and the settings it was built for
+        std::vector<int> rotoZoomMap;
+        std::vector<xlColor> rotoZoomScratch;
+        float rotoZoomMapZoom;
+        float rotoZoomMapRotation;
+        int rotoZoomMapQuality;
+        int rotoZoomMapCX;
+        int rotoZoomMapCY;
+        int rotoZoomMapWi;
         void calculateMask(bool isFirstFrame);
         void calculateMask(const std::string &type, bool mode, bool isFirstFrame);
         bool isMasked(int x, int y);
         
     private:
+        // the fields the in [0] and out [1] transitions are using
+        std::shared_ptr<TransitionField> maskFields[2];
+        TransitionField &GetMaskField(bool out, int type, int adjust);
+
         void createSquareExplodeMask(bool end);
         void createCircleExplodeMask(bool end);
         void createWipeMask(bool end);
@@ -167,14 +195,22 @@ private:
 
     int CurrentLayer;
 
-    void GetMixedColor(int node, xlColor& c, const std::vector<bool> & validLayers, int EffectPeriod);
+    std::vector<xlColor> mixedColors;
+    void PrepareLayerColors(int layer, float offset);
+    void BlendLayer(int layer, bool first);
     xlColor mixColors(const wxCoord &x, const wxCoord &y, const xlColor &c0, const xlColor &c1, int layer);
     void SetDimmingCurve(DimmingCurve *value);
     void reset(int layers, int timing);
 	void Blur(LayerInfo* layer, float offset);
     void RotoZoom(LayerInfo* layer, float offset);
+    void BuildRotoZoomMap(LayerInfo* layer, float zoom, float rotation, int q, int cx, int cy);
+    // adds the time since startUS to the render profile for the layer setting
+    void ProfileLayerSetting(const std::string& setting, long long startUS);
 
     std::string modelName;
+    std::string seedName; // the whole model ... strand buffers have no model name but still need their own random numbers
+    int modelStrand; // strand and node being rendered for strand and node buffers, otherwise -1
+    int modelNode;
     std::string lastBufferType;
     std::string lastBufferTransform;
     const Model *model;
@@ -182,6 +218,7 @@ private:
     SingleLineModel *ssModel;
     bool onlyOnMain;
     xLightsFrame *frame;
+    RenderProfiler *profiler;
 public:
     void GetNodeChannelValues(size_t nodenum, unsigned char *buf);
     void SetNodeChannelValues(size_t nodenum, const unsigned char *buf);
@@ -190,7 +227,8 @@ public:
     int GetNodeCount() const;
     int GetChanCountPerNode() const;
 
-    PixelBufferClass(xLightsFrame *f, bool onlyOnMainThread);
+    // layer setting timings go to profiler when there is one
+    PixelBufferClass(xLightsFrame *f, bool onlyOnMainThread, RenderProfiler *profiler = nullptr);
     virtual ~PixelBufferClass();
 
     const std::string &GetModelName() const
@@ -12,18 +12,89 @@
 #include "RenderCommandEvent.h"
 #include <map>
 #include <memory>
+#include <algorithm>
 #include "effects/RenderableEffect.h"
 #include "RenderProgressDialog.h"
 #include "SeqExportDialog.h"
 #include "RenderUtils.h"
+#include "RenderCache.h"
+#include "xLightsVersion.h"
+#include "models/ModelGroup.h"
+#include <wx/filename.h>
+#include <wx/xml/xml.h>
 
 #define END_OF_RENDER_FRAME INT_MAX
+//number of frames a RenderJob renders before giving up its pool thread
+#define RENDER_SLICE_FRAMES 40
 
 #include <log4cpp/Category.hh>
 
 //other common strings
 static const std::string STR_EMPTY("");
 
+//sorted copy of the effect times on a layer so finding the effect for a frame is
+//just moving a cursor forward and does not need to touch the layer or its lock
+//rebuilt if anything on the owning element changes while rendering
+class EffectLayerSnapshot {
+public:
+    EffectLayerSnapshot() : layer(nullptr), element(nullptr), changeCount(-1), cursor(0), lastTime(-1) {
+    }
+
+    void Build(EffectLayer *l) {
+        layer = l;
+        intervals.clear();
+        cursor = 0;
+        lastTime = -1;
+        if (l == nullptr) {
+            element = nullptr;
+            return;
+        }
+        element = l->GetParentElement();
+        std::unique_lock<std::recursive_mutex> lock(l->GetLock());
+        changeCount = element == nullptr ? -1 : element->getChangeCount();
+        intervals.reserve(l->GetEffectCount());
+        for (int e = 0; e < l->GetEffectCount(); e++) {
+            Effect *effect = l->GetEffect(e);
+            intervals.push_back(EffectInterval(effect->GetStartTimeMS(), effect->GetEndTimeMS(), effect));
+        }
+        //the layer keeps them sorted by start but dont rely on it
+        std::stable_sort(intervals.begin(), intervals.end(),
+                         [](const EffectInterval &a, const EffectInterval &b) { return a.startMS < b.startMS; });
+    }
+    bool IsStale(EffectLayer *l) const {
+        return l != layer || (element != nullptr && element->getChangeCount() != changeCount);
+    }
+
+    //same answer as scanning the layer for the first effect covering time
+    Effect *Find(int time) {
+        if (time < lastTime) {
+            cursor = 0;
+        }
+        lastTime = time;
+        while (cursor < intervals.size() && intervals[cursor].endMS <= time) {
+            cursor++;
+        }
+        if (cursor < intervals.size() && intervals[cursor].startMS <= time) {
+            return intervals[cursor].effect;
+        }
+        return nullptr;
+    }
+
+    EffectLayer *layer;
+private:
+    struct EffectInterval {
+        EffectInterval(int s, int e, Effect *ef) : startMS(s), endMS(e), effect(ef) {}
+        int startMS;
+        int endMS;
+        Effect *effect;
+    };
+    Element *element;
+    int changeCount;
+    size_t cursor;
+    int lastTime;
+    std::vector<EffectInterval> intervals;
+};
+
 class EffectLayerInfo {
 public:
     EffectLayerInfo() {
@@ -39,7 +110,7 @@ public:
     void resize(int l) {
         numLayers = l;
         currentEffects.resize(l);
-        currentEffectIdxs.resize(l);
+        snapshots.resize(l);
         settingsMaps.resize(l);
         effectStates.resize(l);
         validLayers.resize(l + 1); //extra one for the blending layer
@@ -49,12 +120,26 @@ public:
     Element *element;
     PixelBufferClassPtr buffer;
     std::vector<Effect*> currentEffects;
-    std::vector<int> currentEffectIdxs;
+    std::vector<EffectLayerSnapshot> snapshots;
     std::vector<SettingsMap> settingsMaps;
     std::vector<bool> effectStates;
     std::vector<bool> validLayers;
 };
 
+//everything needed to render one node layer ... kept in a flat list sorted by strand then node
+class NodeLayerInfo {
+public:
+    NodeLayerInfo(int s, int n) : strand(s), node(n), currentEffect(nullptr), effectState(true) {
+    }
+    int strand;
+    int node;
+    PixelBufferClassPtr buffer;
+    EffectLayerSnapshot snapshot;
+    Effect *currentEffect;
+    SettingsMap settingsMap;
+    bool effectState;
+};
+
 class RenderEvent {
 public:
     RenderEvent() : mutex(), signal() {
@@ -167,40 +252,18 @@ private:
     const int finalFrame;
 };
 
-class SNPair {
-public:
-    SNPair(int s, int n) : strand(s), node(n) {
-    }
-    SNPair(const SNPair &p) : strand(p.strand), node(p.node) {
-    }
-
-    bool operator>(const SNPair &p) const {
-        return strand > p.strand
-               || (strand == p.strand && node > p.node);
-    }
-    bool operator<(const SNPair &p) const {
-        return strand < p.strand
-               || (strand == p.strand && node < p.node);
-    }
-    bool operator==(const SNPair &p) const {
-        return strand == p.strand && node == p.node;
-    }
-
-    const int strand;
-    const int node;
-};
-
-
 class RenderJob: public Job, public NextRenderer {
 public:
     RenderJob(ModelElement *row, SequenceData &data, xLightsFrame *xframe, bool zeroBased = false)
-        : Job(), NextRenderer(), rowToRender(row), seqData(&data), xLights(xframe), deleteWhenComplete(false),
+        : Job(), NextRenderer(), rowToRender(row), seqData(&data), xLights(xframe),
             gauge(nullptr), currentFrame(0), renderLog(log4cpp::Category::getInstance(std::string("log_render"))),
-            clearAllFrames(false), supportsModelBlending(false), abort(false)
+            clearAllFrames(false), supportsModelBlending(false), abort(false), jobPool(nullptr),
+            renderFrame(-1), maxFrameBeforeCheck(-1), origChangeCount(0), parkedFrame(-1),
+            framesDone(false), waitingOnRow(false)
     {
         if (row != NULL) {
             name = row->GetModelName();
-            mainBuffer = new PixelBufferClass(xframe, false);
+            mainBuffer = new PixelBufferClass(xframe, false, &xframe->GetRenderProfiler());
             Model *model = xframe->GetModel(name);
             numLayers = rowToRender->GetEffectLayerCount();
 
@@ -212,18 +275,18 @@ public:
                         if (se->GetType() == ELEMENT_TYPE_STRAND) {
                             StrandElement *ste = (StrandElement*)se;
                             if (ste->GetStrand() < model->GetNumStrands()) {
-                                subModelInfos.push_back(new EffectLayerInfo(se->GetEffectLayerCount() + 1));
+                                subModelInfos.push_back(new EffectLayerInfo(se->GetEffectLayerCount()));
                                 subModelInfos.back()->element = se;
-                                subModelInfos.back()->buffer.reset(new PixelBufferClass(xframe, false));
+                                subModelInfos.back()->buffer.reset(new PixelBufferClass(xframe, false, &xframe->GetRenderProfiler()));
                                 subModelInfos.back()->strand = ste->GetStrand();
                                 subModelInfos.back()->buffer->InitStrandBuffer(*model, ste->GetStrand(), data.FrameTime(), se->GetEffectLayerCount());
                             }
                         } else {
                             Model *subModel = model->GetSubModel(se->GetName());
                             if (subModel != nullptr) {
-                                subModelInfos.push_back(new EffectLayerInfo(se->GetEffectLayerCount() + 1));
+                                subModelInfos.push_back(new EffectLayerInfo(se->GetEffectLayerCount()));
                                 subModelInfos.back()->element = se;
-                                subModelInfos.back()->buffer.reset(new PixelBufferClass(xframe, false));
+                                subModelInfos.back()->buffer.reset(new PixelBufferClass(xframe, false, &xframe->GetRenderProfiler()));
                                 subModelInfos.back()->buffer->InitBuffer(*subModel, se->GetEffectLayerCount() + 1, data.FrameTime(), false);
                             }
                         }
@@ -235,14 +298,19 @@ public:
                                 if (n < model->GetStrandLength(ste->GetStrand())) {
                                     EffectLayer *nl = ste->GetNodeLayer(n);
                                     if (nl -> GetEffectCount() > 0) {
-                                        nodeBuffers[SNPair(ste->GetStrand(), n)].reset(new PixelBufferClass(xframe, false));
-                                        nodeBuffers[SNPair(ste->GetStrand(), n)]->InitNodeBuffer(*model, ste->GetStrand(), n, data.FrameTime());
+                                        NodeLayerInfo *ni = new NodeLayerInfo(ste->GetStrand(), n);
+                                        ni->buffer.reset(new PixelBufferClass(xframe, false, &xframe->GetRenderProfiler()));
+                                        ni->buffer->InitNodeBuffer(*model, ste->GetStrand(), n, data.FrameTime());
+                                        nodeInfos.push_back(ni);
                                     }
                                 }
                             }
                         }
                     }
                 }
+                std::sort(nodeInfos.begin(), nodeInfos.end(), [](const NodeLayerInfo *a, const NodeLayerInfo *b) {
+                    return a->strand < b->strand || (a->strand == b->strand && a->node < b->node);
+                });
             } else {
                 delete mainBuffer;
                 mainBuffer = nullptr;
@@ -263,6 +331,9 @@ public:
             EffectLayerInfo *info = *a;
             delete info;
         }
+        for (auto a = nodeInfos.begin(); a != nodeInfos.end(); a++) {
+            delete *a;
+        }
     }
 
     wxGauge *GetGauge() const { return gauge;}
@@ -273,11 +344,10 @@ public:
         return name;
     }
 
+    //the job requeues itself between slices so the pool must never delete it, the main
+    //thread deletes it once currentFrame is END_OF_RENDER_FRAME
     virtual bool DeleteWhenComplete() override {
-        return deleteWhenComplete;
-    }
-    void SetDeleteWhenComplete() {
-        deleteWhenComplete = true;
+        return false;
     }
     void LogToLogger(int logLevel) {
         // these can only be set at start time
@@ -419,13 +489,14 @@ public:
     bool ProcessFrame(int frame, Element *el, EffectLayerInfo &info, PixelBufferClass *buffer, int strand = -1, bool blend = false) {
         wxStopWatch sw;
         bool effectsToUpdate = false;
-        int numLayers = el->GetEffectLayerCount();
+        //the layer vectors were sized when the render started, layers added since are picked
+        //up by the rerender the change count check asks for
+        int numLayers = info.numLayers;
         for (int layer = 0; layer < info.validLayers.size(); layer++) {
             info.validLayers[layer] = false;
         }
         for (int layer = 0; layer < numLayers; layer++) {
-            EffectLayer *elayer = el->GetEffectLayer(layer);
-            Effect *ef = findEffectForFrame(elayer, frame, info.currentEffectIdxs[layer]);
+            Effect *ef = findEffectForFrame(info.snapshots[layer], el->GetEffectLayer(layer), frame);
             if (ef != info.currentEffects[layer]) {
                 info.currentEffects[layer] = ef;
                 SetInializingStatus(frame, layer, strand);
@@ -460,17 +531,136 @@ public:
         return effectsToUpdate;
     }
     
+    virtual void setPreviousFrameDone(int frame) override {
+        bool wake = false;
+        {
+            std::unique_lock<std::mutex> lock(nextLock);
+            previousFrameDone = frame;
+            if (parkedFrame != -1 && previousFrameDone >= parkedFrame) {
+                parkedFrame = -1;
+                wake = true;
+            }
+            nextSignal.notify_all();
+        }
+        if (wake) {
+            //the frame we were waiting on is available, put us back in the queue
+            jobPool->PushJob(this);
+        }
+    }
+
+    void Queue(JobPool *pool) {
+        jobPool = pool;
+        pool->PushJob(this);
+    }
+
+    // Each call to Process renders one slice of the model's frames.  If the models we depend on
+    // have not finished the next frame yet, the job parks itself and is requeued by
+    // setPreviousFrameDone instead of blocking a pool thread.  After RENDER_SLICE_FRAMES frames
+    // it requeues itself so the other models get a turn on the (core sized) pool.
     virtual void Process() override {
-        SetGenericStatus("Initializing rendering thread for %s", 0);
-        int maxFrameBeforeCheck = -1;
-        int origChangeCount;
-        int ss, es;
+        std::unique_lock<std::mutex> sliceLocker(sliceLock);
+        if (renderFrame == -1 && !waitingOnRow) {
+            SetGenericStatus("Initializing rendering thread for %s", 0);
+        }
+        if (!waitingOnRow) {
+            //if another render of this model is still running, let it know we are waiting so it
+            //can bail out
+            waitingOnRow = true;
+            rowToRender->IncWaitCount();
+        }
+        if (!rowToRender->StartRender(this, [this]() { jobPool->PushJob(this); })) {
+            //parked, EndRender of the other render requeues us
+            SetGenericStatus("%s: Waiting on previous render of the model", 0, true);
+            return;
+        }
+        if (waitingOnRow) {
+            waitingOnRow = false;
+            rowToRender->DecWaitCount();
+        }
 
-        rowToRender->IncWaitCount();
         std::unique_lock<std::recursive_mutex> lock(rowToRender->GetRenderLock());
-        rowToRender->DecWaitCount();
-        SetGenericStatus("Got lock on rendering thread for %s", 0);
+        SliceResult result = SLICE_DONE;
+        try {
+            if (renderFrame == -1) {
+                SetGenericStatus("Got lock on rendering thread for %s", 0);
+                InitializeRender();
+            }
+            if (!framesDone) {
+                result = RenderSlice();
+            }
+        } catch ( std::exception &ex) {
+            printf("Caught an exception %s", ex.what());
+            renderLog.error("Caught an exception on rendering thread: " + std::string(ex.what()));
+            framesDone = true;
+            result = SLICE_DONE;
+        } catch ( ... ) {
+            printf("Caught an unknown exception");
+            renderLog.error("Caught an unknown exception on rendering thread.");
+            framesDone = true;
+            result = SLICE_DONE;
+        }
+        if (result == SLICE_DONE && HasNext()) {
+            //make sure the previous has told us we're at the end.  If we return before waiting, the previous
+            //may try sending the END_OF_RENDER_FRAME to us and we'll have been deleted
+            SetGenericStatus("%s: Waiting on previous renderer for final frame", 0);
+            if (ParkUntil(END_OF_RENDER_FRAME) != END_OF_RENDER_FRAME) {
+                result = SLICE_PARKED;
+            }
+        }
+        lock.unlock();
+
+        if (result == SLICE_YIELD) {
+            jobPool->PushJob(this);
+            return;
+        } else if (result == SLICE_PARKED) {
+            return;
+        }
+
+        sliceLocker.unlock();
+        rowToRender->EndRender(this);
+        if (HasNext()) {
+            //let the next know we're done
+            SetGenericStatus("%s: Notifying next renderer of final frame", 0);
+            FrameDone(END_OF_RENDER_FRAME);
+            xLights->CallAfter(&xLightsFrame::SetStatusText, wxString("Done Rendering " + rowToRender->GetModelName()), 0);
+        } else {
+            xLights->CallAfter(&xLightsFrame::RenderDone);
+        }
+        renderLog.debug("Rendering thread exiting.");
+        //once this is set the main thread may delete us
+        currentFrame = END_OF_RENDER_FRAME;
+    }
+    void AbortRender() {
+        std::unique_lock<std::mutex> lock(nextLock);
+        abort = true;
+    }
+    bool WasAborted() {
+        std::unique_lock<std::mutex> lock(nextLock);
+        return abort;
+    }
+    
+
+private:
+
+    enum SliceResult {
+        SLICE_DONE,
+        SLICE_PARKED,
+        SLICE_YIELD
+    };
+
+    //returns the last frame the previous renderers have completed if it covers
+    //frame, otherwise parks the job until setPreviousFrameDone gets there
+    int ParkUntil(int frame) {
+        std::unique_lock<std::mutex> lock(nextLock);
+        if (frame > previousFrameDone) {
+            parkedFrame = frame;
+            return -1;
+        }
+        return previousFrameDone;
+    }
 
+    void InitializeRender() {
+        int ss, es;
         rowToRender->GetAndResetDirtyRange(origChangeCount, ss, es);
         if (ss != -1) {
             //expand to cover the whole dirty range
@@ -491,134 +681,137 @@ public:
         }
         if (startFrame < 0) startFrame = 0;
         if (endFrame > seqData->NumFrames()) endFrame = seqData->NumFrames();
+        renderFrame = startFrame;
 
-        EffectLayerInfo mainModelInfo(numLayers);
-        std::map<SNPair, Effect*> nodeEffects;
-        std::map<SNPair, SettingsMap> nodeSettingsMaps;
-        std::map<SNPair, bool> nodeEffectStates;
-        std::map<SNPair, int> nodeEffectIdxs;
+        mainModelInfo.resize(numLayers);
+        for (int layer = 0; layer < numLayers; layer++) {
+            wxString msg = wxString::Format("Finding starting effect for %s, layer %d and startFrame %d", name, layer, startFrame);
+            SetStatus(msg);
+            mainModelInfo.snapshots[layer].Build(rowToRender->GetEffectLayer(layer));
+            mainModelInfo.currentEffects[layer] = findEffectForFrame(mainModelInfo.snapshots[layer], rowToRender->GetEffectLayer(layer), startFrame);
+            msg = wxString::Format("Initializing starting effect for %s, layer %d and startFrame %d", name, layer, startFrame);
+            SetStatus(msg);
+            initialize(layer, startFrame, mainModelInfo.currentEffects[layer], mainModelInfo.settingsMaps[layer], mainBuffer);
+            mainModelInfo.effectStates[layer] = true;
+        }
+        for (auto a = subModelInfos.begin(); a != subModelInfos.end(); a++) {
+            EffectLayerInfo *info = *a;
+            for (int layer = 0; layer < info->element->GetEffectLayerCount() && layer < info->numLayers; layer++) {
+                info->snapshots[layer].Build(info->element->GetEffectLayer(layer));
+            }
+        }
+        SetGenericStatus("%s: Indexing node effects", 0);
+        for (auto a = nodeInfos.begin(); a != nodeInfos.end(); a++) {
+            NodeLayerInfo *ni = *a;
+            StrandElement *slayer = rowToRender->GetStrand(ni->strand);
+            ni->snapshot.Build(slayer == nullptr ? nullptr : slayer->GetNodeLayer(ni->node, false));
+        }
+    }
 
-        try {
-            for (int layer = 0; layer < numLayers; layer++) {
-                wxString msg = wxString::Format("Finding starting effect for %s, layer %d and startFrame %d", name, layer, startFrame);
-                SetStatus(msg);
-                mainModelInfo.currentEffects[layer] = findEffectForFrame(layer, startFrame, mainModelInfo.currentEffectIdxs[layer]);
-                msg = wxString::Format("Initializing starting effect for %s, layer %d and startFrame %d", name, layer, startFrame);
-                SetStatus(msg);
-                initialize(layer, startFrame, mainModelInfo.currentEffects[layer], mainModelInfo.settingsMaps[layer], mainBuffer);
-                mainModelInfo.effectStates[layer] = true;
+    SliceResult RenderSlice() {
+        int framesThisSlice = 0;
+        //the render lock is released between slices so the model may have been edited since the
+        //last one, give up and have the range rendered again ... unless models above us are waiting
+        //on our frames, then carry on as deleted layers just render nothing
+        if (!HasNext() && renderFrame < endFrame && origChangeCount != rowToRender->getChangeCount()) {
+            rowToRender->SetDirtyRange(renderFrame * seqData->FrameTime(), endFrame * seqData->FrameTime());
+            framesDone = true;
+            return SLICE_DONE;
+        }
+        while (renderFrame < endFrame) {
+            int frame = renderFrame;
+            currentFrame = frame;
+            SetGenericStatus("%s: Starting frame %d", frame, true);
+            if (abort) {
+                break;
             }
 
-            for (int frame = startFrame; frame < endFrame; frame++) {
-                currentFrame = frame;
-                SetGenericStatus("%s: Starting frame %d", frame, true);
-                if (clearAllFrames) {
-                    for (auto it = rangeRestriction.begin(); it != rangeRestriction.end(); it++) {
-                        FrameData fd = (*seqData)[frame];
-                        for (int x = it->start; x <= it->end; x++) {
-                            fd[x] = (unsigned char)0;
-                        }
+            if (!HasNext() &&
+                    (origChangeCount != rowToRender->getChangeCount()
+                     || rowToRender->GetWaitCount())) {
+                //we're bailing out but make sure this range is reconsidered
+                rowToRender->SetDirtyRange(frame * seqData->FrameTime(), endFrame * seqData->FrameTime());
+                break;
+            }
+            //make sure we can do this frame
+            if (frame >= maxFrameBeforeCheck) {
+                maxFrameBeforeCheck = ParkUntil(frame);
+                if (maxFrameBeforeCheck == -1) {
+                    SetGenericStatus("%s: Waiting on previous renderer for frame %d", frame, true);
+                    return SLICE_PARKED;
+                }
+            }
+            long long frameStartUS = RenderProfiler::NowUS();
+            if (clearAllFrames) {
+                for (auto it = rangeRestriction.begin(); it != rangeRestriction.end(); it++) {
+                    FrameData fd = (*seqData)[frame];
+                    for (int x = it->start; x <= it->end; x++) {
+                        fd[x] = (unsigned char)0;
                     }
                 }
-                if (abort) {
-                    break;
+            }
+            bool cleared = ProcessFrame(frame, rowToRender, mainModelInfo, mainBuffer, -1, supportsModelBlending);
+            if (!subModelInfos.empty()) {
+                for (auto a = subModelInfos.begin(); a != subModelInfos.end(); a++) {
+                    EffectLayerInfo *info = *a;
+                    cleared |= ProcessFrame(frame, info->element, *info, info->buffer.get(), info->strand, supportsModelBlending ? true : cleared);
                 }
+            }
+            if (!nodeInfos.empty()) {
+                for (auto it = nodeInfos.begin(); it != nodeInfos.end(); it++) {
+                    NodeLayerInfo *ni = *it;
+                    PixelBufferClass *buffer = ni->buffer.get();
+                    int strand = ni->strand;
+                    int inode = ni->node;
+                    StrandElement *slayer = rowToRender->GetStrand(strand);
+                    if (slayer == nullptr) {
+                        //deleted strand
+                        continue;
+                    }
+                    EffectLayer *nlayer = slayer->GetNodeLayer(inode, false);
+                    if (nlayer == nullptr) {
+                        //deleted node
+                        continue;
+                    }
 
-                if (!HasNext() &&
-                        (origChangeCount != rowToRender->getChangeCount()
-                         || rowToRender->GetWaitCount())) {
-                    //we're bailing out but make sure this range is reconsidered
-                    rowToRender->SetDirtyRange(frame * seqData->FrameTime(), endFrame * seqData->FrameTime());
-                    break;
-                }
-                //make sure we can do this frame
-                if (frame >= maxFrameBeforeCheck) {
-                    maxFrameBeforeCheck = waitForFrame(frame);
-                }
-                bool cleared = ProcessFrame(frame, rowToRender, mainModelInfo, mainBuffer, -1, supportsModelBlending);
-                if (!subModelInfos.empty()) {
-                    for (auto a = subModelInfos.begin(); a != subModelInfos.end(); a++) {
-                        EffectLayerInfo *info = *a;
-                        cleared |= ProcessFrame(frame, info->element, *info, info->buffer.get(), info->strand, supportsModelBlending ? true : cleared);
+                    Effect *el = findEffectForFrame(ni->snapshot, nlayer, frame);
+                    if (el != ni->currentEffect || frame == startFrame) {
+                        ni->currentEffect = el;
+                        SetInializingStatus(frame, -1, strand, inode);
+                        initialize(0, frame, el, ni->settingsMap, buffer);
+                        ni->effectState = true;
+                    }
+                    bool persist=buffer->IsPersistent(0);
+                    if (!persist || ni->currentEffect == nullptr || ni->currentEffect->GetEffectIndex() == -1) {
+                        buffer->Clear(0);
                     }
-                }
-                if (!nodeBuffers.empty()) {
-                    for (std::map<SNPair, PixelBufferClassPtr>::iterator it = nodeBuffers.begin(); it != nodeBuffers.end(); it++) {
-                        SNPair node = it->first;
-                        PixelBufferClass *buffer = it->second.get();
-                        int strand = node.strand;
-                        int inode = node.node;
-                        StrandElement *slayer = rowToRender->GetStrand(strand);
-                        if (slayer == nullptr) {
-                            //deleted strand
-                            continue;
-                        }
-                        EffectLayer *nlayer = slayer->GetNodeLayer(inode, false);
-                        if (nlayer == nullptr) {
-                            //deleted node
-                            continue;
-                        }
-                        
-                        Effect *el = findEffectForFrame(nlayer, frame, nodeEffectIdxs[node]);
-                        if (el != nodeEffects[node] || frame == startFrame) {
-                            nodeEffects[node] = el;
-                            SetInializingStatus(frame, -1, strand, inode);
-                            initialize(0, frame, el, nodeSettingsMaps[node], buffer);
-                            nodeEffectStates[node] = true;
-                        }
-                        bool persist=buffer->IsPersistent(0);
-                        if (!persist || nodeEffects[node] == nullptr || nodeEffects[node]->GetEffectIndex() == -1) {
-                            buffer->Clear(0);
-                        }
 
-                        SetRenderingStatus(frame, &nodeSettingsMaps[node], -1, strand, inode, cleared);
-                        if (xLights->RenderEffectFromMap(el, 0, frame, nodeSettingsMaps[node], *buffer, nodeEffectStates[node], true, &renderEvent)) {
-                            SetCalOutputStatus(frame, strand, inode);
-                            //copy to output
-                            std::vector<bool> valid(2, true);
-                            buffer->SetColors(1, &((*seqData)[frame][0]));
-                            buffer->CalcOutput(frame, valid);
-                            buffer->GetColors(&((*seqData)[frame][0]), rangeRestriction);
-                        }
+                    SetRenderingStatus(frame, &ni->settingsMap, -1, strand, inode, cleared);
+                    if (xLights->RenderEffectFromMap(el, 0, frame, ni->settingsMap, *buffer, ni->effectState, true, &renderEvent)) {
+                        SetCalOutputStatus(frame, strand, inode);
+                        //copy to output
+                        std::vector<bool> valid(2, true);
+                        buffer->SetColors(1, &((*seqData)[frame][0]));
+                        buffer->CalcOutput(frame, valid);
+                        buffer->GetColors(&((*seqData)[frame][0]), rangeRestriction);
                     }
                 }
-                //mainBuffer->ApplyDimmingCurves(&((*seqData)[frame][0]));
-                if (HasNext()) {
-                    SetGenericStatus("%s: Notifying next renderer of frame %d done", frame);
-                    FrameDone(frame);
-                }
             }
-        } catch ( std::exception &ex) {
-            printf("Caught an exception %s", ex.what());
-			renderLog.error("Caught an exception on rendering thread: " + std::string(ex.what()));
-		} catch ( ... ) {
-            printf("Caught an unknown exception");
-			renderLog.error("Caught an unknown exception on rendering thread.");
-		}
-        if (HasNext()) {
-            //make sure the previous has told us we're at the end.  If we return before waiting, the previous
-            //may try sending the END_OF_RENDER_FRAME to us and we'll have been deleted
-            SetGenericStatus("%s: Waiting on previous renderer for final frame", 0);
-            waitForFrame(END_OF_RENDER_FRAME);
-
-            //let the next know we're done
-            SetGenericStatus("%s: Notifying next renderer of final frame", 0);
-            FrameDone(END_OF_RENDER_FRAME);
-            xLights->CallAfter(&xLightsFrame::SetStatusText, wxString("Done Rendering " + rowToRender->GetModelName()), 0);
-        } else {
-            xLights->CallAfter(&xLightsFrame::RenderDone);
+            //mainBuffer->ApplyDimmingCurves(&((*seqData)[frame][0]));
+            xLights->GetRenderProfiler().AddModel(name, 1, RenderProfiler::NowUS() - frameStartUS);
+            if (HasNext()) {
+                SetGenericStatus("%s: Notifying next renderer of frame %d done", frame);
+                FrameDone(frame);
+            }
+            renderFrame++;
+            framesThisSlice++;
+            if (framesThisSlice >= RENDER_SLICE_FRAMES && renderFrame < endFrame) {
+                return SLICE_YIELD;
+            }
         }
-        currentFrame = END_OF_RENDER_FRAME;
-        //printf("Done rendering %lx (next %lx)\n", (unsigned long)this, (unsigned long)next);
-		renderLog.debug("Rendering thread exiting.");
-	}
-    void AbortRender() {
-        std::unique_lock<std::mutex> lock(nextLock);
-        abort = true;
+        framesDone = true;
+        return SLICE_DONE;
     }
-    
-
-private:
 
     void initialize(int layer, int frame, Effect *el, SettingsMap &settingsMap, PixelBufferClass *buffer) {
         if (el == NULL || el->GetEffectIndex() == -1) {
@@ -645,23 +838,15 @@ private:
         buffer->SetPalette(layer, newcolors, newcc);
     }
 
-    Effect *findEffectForFrame(EffectLayer* layer, int frame, int &lastIdx) {
+    //the change count check is a single read so this stays lock free unless the layer was edited
+    Effect *findEffectForFrame(EffectLayerSnapshot &snapshot, EffectLayer* layer, int frame) {
         if (layer == nullptr) {
             return nullptr;
         }
-        int time = frame * seqData->FrameTime();
-        for (int e = lastIdx; e < layer->GetEffectCount(); e++) {
-            Effect *effect = layer->GetEffect(e);
-            int st = effect->GetStartTimeMS();
-            int et = effect->GetEndTimeMS();
-            if (et > time && st <= time) {
-                return effect;
-            }
+        if (snapshot.IsStale(layer)) {
+            snapshot.Build(layer);
         }
-        return nullptr;
-    }
-    Effect *findEffectForFrame(int layer, int frame, int &lastIdx) {
-        return findEffectForFrame(rowToRender->GetEffectLayer(layer), frame, lastIdx);
+        return snapshot.Find(frame * seqData->FrameTime());
     }
     void loadSettingsMap(const std::string &effectName,
                          Effect *effect,
@@ -682,7 +867,6 @@ private:
     std::vector<NodeRange> rangeRestriction;
     bool supportsModelBlending;
     RenderEvent renderEvent;
-    bool deleteWhenComplete;
 
     //stuff for handling the status;
     wxString statusMsg;
@@ -701,7 +885,18 @@ private:
 
     std::vector<EffectLayerInfo *> subModelInfos;
 
-    std::map<SNPair, PixelBufferClassPtr> nodeBuffers;
+    std::vector<NodeLayerInfo *> nodeInfos;
+
+    //state carried between the slices of the render
+    std::mutex sliceLock;
+    JobPool *jobPool;
+    EffectLayerInfo mainModelInfo;
+    int renderFrame;
+    int maxFrameBeforeCheck;
+    int origChangeCount;
+    int parkedFrame;
+    bool framesDone;
+    bool waitingOnRow;
 };
 
 
@@ -735,8 +930,134 @@ public:
     AggregatorRenderer **aggregators;
     RenderProgressDialog *renderProgressDialog;
     Model *restriction;
+
+    //rows to write to the render cache once everything is done
+    std::vector<RenderCache::Entry> cacheEntries;
+    std::vector<std::string> cacheModels; //every model in the render ... anything else in the cache is stale
+    unsigned int cacheChangeCount;
 };
 
+#pragma region Render Cache
+static void HashEffectLayer(RenderCache::Hasher &hash, EffectLayer *layer) {
+    std::unique_lock<std::recursive_mutex> lock(layer->GetLock());
+    hash.Add((long long)layer->GetEffectCount());
+    for (int e = 0; e < layer->GetEffectCount(); e++) {
+        Effect *effect = layer->GetEffect(e);
+        hash.Add(effect->GetEffectName());
+        hash.Add((long long)effect->GetStartTimeMS());
+        hash.Add((long long)effect->GetEndTimeMS());
+        hash.Add(effect->GetSettingsAsString());
+        hash.Add(effect->GetPaletteAsString());
+    }
+}
+
+//files are identified by name and when they last changed ... reading them all would cost more than the render
+static void HashFile(RenderCache::Hasher &hash, const std::string &file) {
+    hash.Add(file);
+    wxFileName fn(file);
+    if (fn.FileExists()) {
+        hash.Add((long long)fn.GetModificationTime().GetValue().GetValue());
+        hash.Add((long long)fn.GetSize().GetValue());
+    }
+}
+
+static void HashElement(RenderCache::Hasher &hash, Element *el, EffectManager *em) {
+    hash.Add(el->GetName());
+    hash.Add((long long)el->GetEffectLayerCount());
+    for (size_t l = 0; l < el->GetEffectLayerCount(); l++) {
+        HashEffectLayer(hash, el->GetEffectLayer(l));
+    }
+    if (em != nullptr) {
+        std::list<std::string> files = el->GetFileReferences(*em);
+        for (auto it = files.begin(); it != files.end(); it++) {
+            HashFile(hash, *it);
+        }
+    }
+}
+
+static void HashXml(RenderCache::Hasher &hash, wxXmlNode *node) {
+    for (; node != nullptr; node = node->GetNext()) {
+        hash.Add(node->GetName().ToStdString());
+        for (wxXmlAttribute *a = node->GetAttributes(); a != nullptr; a = a->GetNext()) {
+            hash.Add(a->GetName().ToStdString());
+            hash.Add(a->GetValue().ToStdString());
+        }
+        HashXml(hash, node->GetChildren());
+    }
+}
+
+static void HashModel(RenderCache::Hasher &hash, const Model *model) {
+    wxXmlNode *xml = model->GetModelXml();
+    if (xml != nullptr) {
+        hash.Add(xml->GetName().ToStdString());
+        for (wxXmlAttribute *a = xml->GetAttributes(); a != nullptr; a = a->GetNext()) {
+            hash.Add(a->GetName().ToStdString());
+            hash.Add(a->GetValue().ToStdString());
+        }
+        HashXml(hash, xml->GetChildren());
+    }
+    //a group's buffer is laid out from its members
+    const ModelGroup *group = dynamic_cast<const ModelGroup*>(model);
+    if (group != nullptr) {
+        for (auto it = group->Models().begin(); it != group->Models().end(); it++) {
+            HashModel(hash, *it);
+        }
+    }
+}
+
+//everything outside a model that changes how it renders
+static uint64_t RenderCacheSequenceKey(SequenceElements &elements, SequenceData &seqData, xLightsXmlFile *xmlFile) {
+    RenderCache::Hasher hash;
+    //effects change between versions
+    hash.Add(xlights_version_string.ToStdString());
+    hash.Add((long long)seqData.NumFrames());
+    hash.Add((long long)seqData.FrameTime());
+    hash.Add((long long)seqData.NumChannels());
+    hash.Add((long long)elements.SupportsModelBlending());
+    HashFile(hash, xmlFile->GetMediaFile().ToStdString());
+    DataLayerSet &layers = xmlFile->GetDataLayers();
+    for (int i = 0; i < layers.GetNumLayers(); i++) {
+        DataLayer *layer = layers.GetDataLayer(i);
+        hash.Add(layer->GetName().ToStdString());
+        HashFile(hash, layer->GetDataSource().ToStdString());
+        hash.Add((long long)layer->GetChannelOffset());
+        hash.Add((long long)layer->GetNumChannels());
+    }
+    //lyric and face effects read the timing tracks
+    for (size_t i = 0; i < elements.GetElementCount(); i++) {
+        Element *el = elements.GetElement(i);
+        if (el->GetType() == ELEMENT_TYPE_TIMING) {
+            HashElement(hash, el, nullptr);
+        }
+    }
+    return hash.Get();
+}
+
+static uint64_t RenderCacheModelKey(uint64_t sequenceKey, ModelElement *me, const Model *model, EffectManager &em,
+                                    const std::vector<std::string> &below) {
+    RenderCache::Hasher hash;
+    hash.Add((long long)sequenceKey);
+    HashModel(hash, model);
+    HashElement(hash, me, &em);
+    for (int x = 0; x < me->GetSubModelCount(); x++) {
+        SubModelElement *se = me->GetSubModel(x);
+        HashElement(hash, se, &em);
+        if (se->GetType() == ELEMENT_TYPE_STRAND) {
+            StrandElement *ste = (StrandElement*)se;
+            hash.Add((long long)ste->GetNodeLayerCount());
+            for (int n = 0; n < ste->GetNodeLayerCount(); n++) {
+                HashEffectLayer(hash, ste->GetNodeLayer(n));
+            }
+        }
+    }
+    //what ends up on shared channels depends on the models rendered first
+    for (auto it = below.begin(); it != below.end(); it++) {
+        hash.Add(*it);
+    }
+    return hash.Get();
+}
+#pragma endregion Render Cache
+
 static bool HasEffects(ModelElement *me) {
     if (me->HasEffects()) {
         return true;
@@ -814,6 +1135,17 @@ void xLightsFrame::UpdateRenderStatus() {
         }
 
         if (done) {
+            //only keep what was rendered if nothing was aborted or changed along the way
+            bool keep = !rpi->cacheEntries.empty() && rpi->cacheChangeCount == mSequenceElements.GetChangeCount();
+            for (size_t row = 0; keep && row < rpi->numRows; row++) {
+                if (rpi->jobs[row] && rpi->jobs[row]->WasAborted()) {
+                    keep = false;
+                }
+            }
+            if (keep) {
+                //the files are written and pruned on a thread of the cache's own
+                _renderCache.Save(rpi->cacheEntries, rpi->cacheModels, SeqData);
+            }
             for (size_t row = 0; row < rpi->numRows; row++) {
                 if (rpi->jobs[row]) {
                     delete rpi->jobs[row];
@@ -839,7 +1171,9 @@ void xLightsFrame::UpdateRenderStatus() {
 
 
 void xLightsFrame::RenderDone() {
-    mainSequencer->PanelEffectGrid->Refresh();
+    if (mainSequencer != nullptr) {
+        mainSequencer->PanelEffectGrid->Refresh();
+    }
 }
 
 class RenderTreeData {
@@ -876,17 +1210,6 @@ public:
         ranges.push_back(NodeRange(start, end));
     }
     
-    bool Overlaps(RenderTreeData &e) {
-        for (auto it = ranges.begin(); it != ranges.end(); it++) {
-            for (auto it2 = e.ranges.begin(); it2 != e.ranges.end(); it2++) {
-                if (it->Overlaps(*it2)) {
-                    return true;
-                }
-            }
-        }
-        return false;
-    }
-    
     void Add(Model *el) {
         renderOrder.push_back(el);
     }
@@ -901,16 +1224,35 @@ void xLightsFrame::RenderTree::Clear() {
     data.clear();
 }
 void xLightsFrame::RenderTree::Add(Model *el) {
-    RenderTreeData *elData = new RenderTreeData(el);
-    for (auto it = data.begin(); it != data.end(); it++) {
-        RenderTreeData *elData2 = *it;
-        if (elData2->Overlaps(*elData)) {
-            elData->Add(elData2->model);
-            elData2->Add(el);
+    data.push_back(new RenderTreeData(el));
+}
+void xLightsFrame::RenderTree::Build() {
+    std::vector<RenderTreeData*> models(data.begin(), data.end());
+    RangeOverlapSweep sweep;
+    for (int x = 0; x < models.size(); x++) {
+        models[x]->renderOrder.clear();
+        for (auto it = models[x]->ranges.begin(); it != models[x]->ranges.end(); it++) {
+            sweep.Add(x, *it);
+        }
+    }
+    std::vector<std::pair<int, int>> overlaps = sweep.FindOverlaps();
+
+    //each model renders after the overlapping models above it and before those below it
+    std::vector<std::vector<int>> above(models.size());
+    std::vector<std::vector<int>> below(models.size());
+    for (auto it = overlaps.begin(); it != overlaps.end(); it++) {
+        above[it->second].push_back(it->first);
+        below[it->first].push_back(it->second);
+    }
+    for (int x = 0; x < models.size(); x++) {
+        for (auto it = above[x].begin(); it != above[x].end(); it++) {
+            models[x]->Add(models[*it]->model);
+        }
+        models[x]->Add(models[x]->model);
+        for (auto it = below[x].begin(); it != below[x].end(); it++) {
+            models[x]->Add(models[*it]->model);
         }
     }
-    elData->Add(el);
-    data.push_back(elData);
 }
 
 void xLightsFrame::RenderTree::Print() {
@@ -938,6 +1280,7 @@ void xLightsFrame::BuildRenderTree() {
                 renderTree.Add(model);
             }
         }
+        renderTree.Build();
         //renderTree.Print();
         renderTree.renderTreeChangeCount = curChangeCount;
     }
@@ -965,7 +1308,8 @@ void xLightsFrame::Render(std::list<Model*> models, Model *restrictToModel,
     int numRows = models.size();
     RenderJob **jobs = new RenderJob*[numRows];
     AggregatorRenderer **aggregators = new AggregatorRenderer*[numRows];
-    std::vector<std::set<int>> channelMaps(SeqData.NumChannels());
+    RangeOverlapSweep channelSweep;
+    std::vector<std::vector<NodeRange>> rowRanges(numRows);
     
     size_t row = 0;
     for (auto it = models.begin(); it != models.end(); it++, row++) {
@@ -990,29 +1334,105 @@ void xLightsFrame::Render(std::list<Model*> models, Model *restrictToModel,
                 }
                 
                 jobs[row] = job;
-                aggregators[row]->addNext(job);
-                size_t cn = buffer->GetChanCountPerNode();
+                //nodes are usually contiguous so merge them into as few ranges as we can
+                int cn = buffer->GetChanCountPerNode();
+                int rangeStart = -1;
+                int rangeEnd = -1;
                 for (int node = 0; node < buffer->GetNodeCount(); node++) {
                     int start = buffer->NodeStartChannel(node);
-                    for (int c = 0; c < cn; c++) {
-                        int cnum = start + c;
-                        if (cnum < SeqData.NumChannels()) {
-                            for (auto i = channelMaps[cnum].begin(); i != channelMaps[cnum].end(); i++) {
-                                int idx = *i;
-                                if (idx != row) {
-                                    if (jobs[idx]->addNext(aggregators[row])) {
-                                        aggregators[row]->incNumAggregated();
-                                    }
-                                }
-                            }
-                            channelMaps[cnum].insert(row);
+                    int end = std::min(start + cn, (int)SeqData.NumChannels()) - 1;
+                    if (start >= SeqData.NumChannels() || end < start) {
+                        continue;
+                    }
+                    if (rangeStart != -1 && start == rangeEnd + 1) {
+                        rangeEnd = end;
+                    } else {
+                        if (rangeStart != -1) {
+                            rowRanges[row].push_back(NodeRange(rangeStart, rangeEnd));
                         }
+                        rangeStart = start;
+                        rangeEnd = end;
                     }
                 }
+                if (rangeStart != -1) {
+                    rowRanges[row].push_back(NodeRange(rangeStart, rangeEnd));
+                }
+                for (auto r = rowRanges[row].begin(); r != rowRanges[row].end(); r++) {
+                    channelSweep.Add(row, *r);
+                }
+            }
+        }
+    }
+    //a model waits on every model above it that shares a channel
+    std::vector<std::pair<int, int>> overlaps = channelSweep.FindOverlaps();
+
+    //a full render copies models that have not changed since they were last rendered straight from the render cache
+    std::vector<RenderCache::Entry> cacheEntries;
+    std::vector<std::string> cacheModels;
+    unsigned int cacheChangeCount = mSequenceElements.GetChangeCount();
+    bool useCache = _renderCacheEnabled && restrictToModel == nullptr && startFrame == 0 && endFrame == SeqData.NumFrames() - 1 && CurrentSeqXmlFile != nullptr;
+    if (useCache) {
+        _renderCache.SetSequence(CurrentSeqXmlFile->GetFullPath().ToStdString());
+        useCache = _renderCache.IsEnabled();
+    }
+    if (useCache) {
+        uint64_t sequenceKey = RenderCacheSequenceKey(mSequenceElements, SeqData, CurrentSeqXmlFile);
+
+        std::vector<std::vector<std::string>> below(numRows);
+        for (auto it = overlaps.begin(); it != overlaps.end(); it++) {
+            below[it->second].push_back(jobs[it->first]->GetName());
+        }
+
+        //only rows with a job go to the cache
+        std::vector<RenderCache::Entry> entries;
+        std::vector<int> entryRow;
+        std::vector<int> rowEntry(numRows, -1);
+        row = 0;
+        for (auto it = models.begin(); it != models.end(); it++, row++) {
+            if (jobs[row] != nullptr) {
+                ModelElement *me = dynamic_cast<ModelElement *>(mSequenceElements.GetElement((*it)->GetName()));
+                RenderCache::Entry entry;
+                entry.model = jobs[row]->GetName();
+                entry.key = RenderCacheModelKey(sequenceKey, me, *it, effectManager, below[row]);
+                entry.ranges = rowRanges[row];
+                rowEntry[row] = entries.size();
+                entryRow.push_back(row);
+                entries.push_back(entry);
+            }
+        }
+        std::vector<std::pair<int, int>> entryOverlaps;
+        entryOverlaps.reserve(overlaps.size());
+        for (auto it = overlaps.begin(); it != overlaps.end(); it++) {
+            entryOverlaps.push_back(std::pair<int, int>(rowEntry[it->first], rowEntry[it->second]));
+        }
+
+        //any clearing is done before the cached models are loaded so the jobs must not clear again
+        std::vector<bool> loaded = _renderCache.Restore(entries, entryOverlaps, clear ? ranges : std::vector<NodeRange>(), SeqData);
+        clear = false;
+        for (size_t e = 0; e < entries.size(); e++) {
+            cacheModels.push_back(entries[e].model);
+            if (loaded[e]) {
+                delete jobs[entryRow[e]];
+                jobs[entryRow[e]] = nullptr;
+            } else {
+                cacheEntries.push_back(entries[e]);
             }
         }
     }
-    channelMaps.clear();
+
+    for (row = 0; row < numRows; row++) {
+        if (jobs[row] != nullptr) {
+            aggregators[row]->addNext(jobs[row]);
+        }
+    }
+    for (auto it = overlaps.begin(); it != overlaps.end(); it++) {
+        if (jobs[it->first] == nullptr || jobs[it->second] == nullptr) {
+            continue;
+        }
+        if (jobs[it->first]->addNext(aggregators[it->second])) {
+            aggregators[it->second]->incNumAggregated();
+        }
+    }
     RenderProgressDialog *renderProgressDialog = nullptr;
     if (progressDialog) {
         renderProgressDialog = new RenderProgressDialog(this);
@@ -1029,7 +1449,7 @@ void xLightsFrame::Render(std::list<Model*> models, Model *restrictToModel,
                     jobs[row]->SetRangeRestriction(ranges, clear);
                     first = false;
                 }
-                jobPool.PushJob(jobs[row]);
+                jobs[row]->Queue(&jobPool);
                 count++;
             }
             if (progressDialog) {
@@ -1046,7 +1466,7 @@ void xLightsFrame::Render(std::list<Model*> models, Model *restrictToModel,
     for (size_t row = 0; row < numRows; row++) {
         if (jobs[row] && aggregators[row]->getNumAggregated() != 0) {
             //now start the rest
-            jobPool.PushJob(jobs[row]);
+            jobs[row]->Queue(&jobPool);
             count++;
         }
     }
@@ -1066,6 +1486,9 @@ void xLightsFrame::Render(std::list<Model*> models, Model *restrictToModel,
         pi->renderProgressDialog = renderProgressDialog;
         pi->restriction = restrictToModel;
         pi->aggregators = aggregators;
+        pi->cacheEntries.swap(cacheEntries);
+        pi->cacheModels.swap(cacheModels);
+        pi->cacheChangeCount = cacheChangeCount;
         renderProgressInfo.push_back(pi);
     } else {
         callback();
@@ -1186,7 +1609,7 @@ void xLightsFrame::ExportModel(wxCommandEvent &command) {
             job->setRenderRange(0, SeqData.NumFrames());
             job->setPreviousFrameDone(END_OF_RENDER_FRAME);
             job->addNext(&wait);
-            jobPool.PushJob(job);
+            job->Queue(&jobPool);
             //wait to complete
             while (!wait.checkIfDone(SeqData.NumFrames())) {
                 wxYield();
@@ -1277,7 +1700,9 @@ bool xLightsFrame::RenderEffectFromMap(Effect *effectObj, int layer, int period,
             retval= false;
         } else if (!bgThread || reff->CanRenderOnBackgroundThread(effectObj, SettingsMap, buffer.BufferForLayer(layer))) {
             wxStopWatch sw;
+            long long startUS = RenderProfiler::NowUS();
             reff->Render(effectObj, SettingsMap, buffer.BufferForLayer(layer));
+            _renderProfiler.AddEffect(reff->Name(), RenderProfiler::NowUS() - startUS);
             // Log slow render frames ... this takes time but at this point it is already slow
             if (sw.Time() > 150)
             {
@@ -21,6 +21,7 @@
     along with xLights.  If not, see <http://www.gnu.org/licenses/>.
 **************************************************************/
 #include <cmath>
+#include <typeinfo>
 #ifdef _MSC_VER
 	// required so M_PI will be defined by MSC
 	#define _USE_MATH_DEFINES
@@ -411,6 +412,154 @@ void RenderBuffer::InitBuffer(int newBufferHt, int newBufferWi, const std::strin
     pixels.resize(NumPixels);
     tempbuf.resize(NumPixels);
     isTransformed = (bufferTransform != "None");
+    packedNodes.Build(Nodes);
+}
+
+void PackedNodeTable::Build(const std::vector<NodeBaseClassPtr> &nodes)
+{
+    size_t count = nodes.size();
+    size_t coords = 0;
+    for (auto it = nodes.begin(); it != nodes.end(); it++) {
+        coords += (*it)->Coords.size();
+    }
+    bufX.resize(count);
+    bufY.resize(count);
+    coordStart.resize(count + 1);
+    coordX.resize(coords);
+    coordY.resize(coords);
+    startChannel.resize(count);
+    offsets.resize(count * 3);
+    kind.resize(count);
+    colors.resize(count * 3);
+    sparkle.resize(count);
+    models.resize(count);
+    others.assign(count, nullptr);
+    chanCountPerNode = count == 0 ? 0 : nodes[0]->GetChanCount();
+
+    uint32_t coord = 0;
+    for (size_t n = 0; n < count; n++) {
+        NodeBaseClass *node = nodes[n].get();
+        coordStart[n] = coord;
+        for (auto c = node->Coords.begin(); c != node->Coords.end(); c++, coord++) {
+            coordX[coord] = c->bufX;
+            coordY[coord] = c->bufY;
+        }
+        bufX[n] = node->Coords.empty() ? 0 : node->Coords[0].bufX;
+        bufY[n] = node->Coords.empty() ? 0 : node->Coords[0].bufY;
+        startChannel[n] = node->ActChan;
+        sparkle[n] = node->sparkle;
+        models[n] = node->model;
+        for (int x = 0; x < 3; x++) {
+            offsets[n * 3 + x] = node->offsets[x];
+            colors[n * 3 + x] = node->c[x];
+        }
+
+        if (dynamic_cast<NodeClassCustom*>(node) != nullptr) {
+            kind[n] = NODE_OTHER;
+            others[n] = node;
+        } else if (dynamic_cast<NodeClassRGBW*>(node) != nullptr) {
+            kind[n] = NODE_RGBW;
+        } else if (dynamic_cast<NodeClassWhite*>(node) != nullptr) {
+            kind[n] = NODE_WHITE;
+        } else if (dynamic_cast<NodeClassRed*>(node) != nullptr) {
+            kind[n] = NODE_RED;
+        } else if (dynamic_cast<NodeClassGreen*>(node) != nullptr) {
+            kind[n] = NODE_GREEN;
+        } else if (dynamic_cast<NodeClassBlue*>(node) != nullptr) {
+            kind[n] = NODE_BLUE;
+        } else if (typeid(*node) == typeid(NodeBaseClass)) {
+            kind[n] = NODE_RGB;
+        } else {
+            kind[n] = NODE_OTHER;
+            others[n] = node;
+        }
+    }
+    coordStart[count] = coord;
+}
+
+void PackedNodeTable::GetColor(size_t n, xlColor &color) const
+{
+    const uint8_t *c = &colors[n * 3];
+    switch (kind[n]) {
+        case NODE_RGB:
+        case NODE_RGBW:
+            color.Set(c[0], c[1], c[2]);
+            break;
+        case NODE_RED:
+            color.Set(c[0], 0, 0);
+            break;
+        case NODE_GREEN:
+            color.Set(0, c[1], 0);
+            break;
+        case NODE_BLUE:
+            color.Set(0, 0, c[2]);
+            break;
+        case NODE_WHITE:
+            {
+                uint8_t cmin = std::min(c[0], std::min(c[1], c[2]));
+                color.Set(cmin, cmin, cmin);
+            }
+            break;
+        default:
+            others[n]->GetColor(color);
+            break;
+    }
+}
+
+void PackedNodeTable::SetFromChannels(size_t n, const unsigned char *buf)
+{
+    uint8_t *c = &colors[n * 3];
+    const uint8_t *off = &offsets[n * 3];
+    switch (kind[n]) {
+        case NODE_WHITE:
+            c[0] = c[1] = c[2] = buf[0];
+            return;
+        case NODE_RGBW:
+            if (buf[3] != 0) {
+                c[0] = c[1] = c[2] = buf[3];
+                return;
+            }
+            break;
+        case NODE_OTHER:
+            others[n]->SetFromChannels(buf);
+            return;
+        default:
+            break;
+    }
+    for (int x = 0; x < 3; x++) {
+        if (off[x] != 255) {
+            c[x] = buf[off[x]];
+        }
+    }
+}
+
+void PackedNodeTable::GetForChannels(size_t n, unsigned char *buf) const
+{
+    const uint8_t *c = &colors[n * 3];
+    const uint8_t *off = &offsets[n * 3];
+    switch (kind[n]) {
+        case NODE_WHITE:
+            buf[0] = std::min(c[0], std::min(c[1], c[2]));
+            return;
+        case NODE_RGBW:
+            if (c[0] == c[1] && c[1] == c[2]) {
+                buf[0] = buf[1] = buf[2] = 0;
+                buf[3] = c[0];
+                return;
+            }
+            buf[3] = 0;
+            break;
+        case NODE_OTHER:
+            others[n]->GetForChannels(buf);
+            return;
+        default:
+            break;
+    }
+    for (int x = 0; x < 3; x++) {
+        if (off[x] != 255) {
+            buf[off[x]] = c[x];
+        }
+    }
 }
 
 void RenderBuffer::Clear()
@@ -439,7 +588,7 @@ size_t RenderBuffer::GetColorCount()
 // return a random number between 0 and 1 inclusive
 double RenderBuffer::rand01()
 {
-    return (double)rand()/(double)RAND_MAX;
+    return rng.Next01();
 }
 
 
@@ -875,11 +1024,23 @@ const xlColor& RenderBuffer::GetTempPixelRGB(int x, int y)
     return xlBLACK;
 }
 
-void RenderBuffer::SetState(int period, bool ResetState, const std::string& model_name)
+void RenderBuffer::SetState(int period, bool ResetState, const std::string& model_name, int layer, const std::string& seed_name, int strand, int node)
 {
     if (ResetState)
     {
         needToInit = true;
+
+        // same model, strand, node, layer and effect start always gives the same random sequence,
+        // FNV-1a rather than std::hash so the seed is the same on every platform
+        uint64_t seed = 0xcbf29ce484222325ULL;
+        for (auto c : seed_name) {
+            seed = (seed ^ (uint8_t)c) * 0x100000001b3ULL;
+        }
+        seed = seed * 31 + (strand + 1);
+        seed = seed * 31 + (node + 1);
+        seed = seed * 31 + layer;
+        seed = seed * 31 + curEffStartPer;
+        rng.Seed(seed);
     }
     curPeriod = period;
     cur_model = model_name;
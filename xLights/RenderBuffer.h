@@ -78,6 +78,7 @@ class xLightsFrame;
 class Effect;
 class SettingsMap;
 class SequenceElements;
+class Model;
 
 
 class DrawingContext {
@@ -164,6 +165,11 @@ public:
         wxASSERT(newcolors.size() == newcc.size());
 
         cc = newcc;
+        // colour curves get read per pixel by some effects
+        for (auto it = cc.begin(); it != cc.end(); ++it)
+        {
+            if (it->IsActive()) it->SetBaked(true);
+        }
         color=newcolors;
         hsv.clear();
         for(size_t i=0; i<newcolors.size(); i++)
@@ -376,6 +382,93 @@ public:
 	virtual ~EffectRenderCache();
 };
 
+// Small fast random number generator (xorshift128+).  Every RenderBuffer has its own, seeded
+// from the model, layer and effect start, so render threads don't contend on the C library's
+// rand() state and rendering the same sequence twice gives the same output.
+class RenderRandom {
+public:
+    static const int MAX_VALUE = 0x7FFFFFFF;   // Next() returns 0 .. MAX_VALUE, like rand()
+
+    RenderRandom() { Seed(0); }
+
+    void Seed(uint64_t seed) {
+        // splitmix64 to spread the seed over the state, also guarantees it is never all zero
+        for (int x = 0; x < 2; x++) {
+            seed += 0x9E3779B97F4A7C15ULL;
+            uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            state[x] = z ^ (z >> 31);
+        }
+    }
+    uint64_t Next64() {
+        uint64_t s1 = state[0];
+        const uint64_t s0 = state[1];
+        state[0] = s0;
+        s1 ^= s1 << 23;
+        state[1] = s1 ^ s0 ^ (s1 >> 17) ^ (s0 >> 26);
+        return state[1] + s0;
+    }
+    int Next() {
+        return (int)(Next64() >> 33);
+    }
+    double Next01() {
+        return (double)Next() / (double)MAX_VALUE;
+    }
+private:
+    uint64_t state[2];
+};
+
+// Structure of arrays copy of a buffer's Nodes.  The per frame loops in PixelBufferClass
+// (CalcOutput, GetColors, SetColors) stream through these contiguous arrays instead of
+// calling the virtual NodeBaseClass methods on separately allocated nodes.  Rebuilt by
+// RenderBuffer::InitBuffer whenever the Nodes change.
+class PackedNodeTable {
+public:
+    enum NodeKind {
+        NODE_RGB,
+        NODE_RED,
+        NODE_GREEN,
+        NODE_BLUE,
+        NODE_WHITE,
+        NODE_RGBW,
+        NODE_OTHER  // anything else goes through the node object
+    };
+
+    void Build(const std::vector<NodeBaseClassPtr> &nodes);
+    size_t size() const { return startChannel.size(); }
+    bool IsVisible(size_t n) const { return coordStart[n] != coordStart[n + 1]; }
+
+    void SetColor(size_t n, const xlColor &color) {
+        if (kind[n] == NODE_OTHER) {
+            others[n]->SetColor(color);
+        } else {
+            uint8_t *c = &colors[n * 3];
+            c[0] = color.red;
+            c[1] = color.green;
+            c[2] = color.blue;
+        }
+    }
+    void GetColor(size_t n, xlColor &color) const;
+    void SetFromChannels(size_t n, const unsigned char *buf);
+    void GetForChannels(size_t n, unsigned char *buf) const;
+
+    std::vector<unsigned short> bufX;       // first buffer coordinate of each node
+    std::vector<unsigned short> bufY;
+    std::vector<uint32_t> coordStart;       // node n owns coordX/coordY[coordStart[n] .. coordStart[n + 1])
+    std::vector<unsigned short> coordX;
+    std::vector<unsigned short> coordY;
+    std::vector<unsigned int> startChannel;
+    std::vector<uint8_t> offsets;           // 3 per node, rgb channel offsets, 255 if not output
+    std::vector<uint8_t> kind;
+    std::vector<uint8_t> colors;            // 3 per node, rgb
+    std::vector<unsigned short> sparkle;
+    std::vector<const Model *> models;
+    unsigned int chanCountPerNode = 0;
+private:
+    std::vector<NodeBaseClass *> others;    // only set for NODE_OTHER
+};
+
 class /*NCCDLLEXPORT*/ RenderBuffer {
 public:
     RenderBuffer(xLightsFrame *frame, bool onlyOnMain);
@@ -389,7 +482,9 @@ public:
     size_t GetColorCount();
 	void SetAllowAlphaChannel(bool a);
 
-    void SetState(int period, bool reset, const std::string& model_name);
+    // the random numbers are seeded from seed_name, strand, node, layer and effect start,
+    // strand and node are -1 unless the buffer renders a single strand or node of the model
+    void SetState(int period, bool reset, const std::string& model_name, int layer, const std::string& seed_name, int strand = -1, int node = -1);
 
     void SetEffectDuration(int startMsec, int endMsec);
     void GetEffectPeriods( int& curEffStartPer, int& curEffEndPer);  // nobody wants endPer?
@@ -421,6 +516,7 @@ public:
     static float sin(float rad);
     static float cos(float rad);
 
+    int rand() { return rng.Next(); }
     double rand01();
     double calcAccel(double ratio, double accel);
 
@@ -473,6 +569,7 @@ public:
 
     bool needToInit;
     bool allowAlpha;
+    RenderRandom rng;
 
     /* Places to store and data that is needed from one frame to another */
     std::map<int, EffectRenderCache*> infoCache;
@@ -480,6 +577,7 @@ public:
     int tempInt2;
 
     std::vector<NodeBaseClassPtr> Nodes;
+    PackedNodeTable packedNodes;
 
 private:
     bool onlyOnMain;
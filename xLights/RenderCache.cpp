@@ -0,0 +1,425 @@
+#include <cstring>
+#include <set>
+#include <algorithm>
+
+#include "RenderCache.h"
+#include "SequenceData.h"
+
+#include <wx/filename.h>
+#include <wx/file.h>
+#include <wx/dir.h>
+#include <wx/thread.h>
+#include <wx/stopwatch.h>
+#include <log4cpp/Category.hh>
+
+// bump when the file layout changes
+#define RENDERCACHE_VERSION 1
+#define RENDERCACHE_MAGIC "XLRC"
+
+struct RenderCacheHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint64_t key;
+    uint32_t frames;
+    uint32_t ranges;
+    uint32_t nameLength;
+};
+
+struct RenderCacheFile
+{
+    std::string model;
+    std::string filename;
+    std::vector<unsigned char> data;
+};
+
+static size_t ChannelCount(const std::vector<NodeRange>& ranges)
+{
+    size_t count = 0;
+    for (auto it = ranges.begin(); it != ranges.end(); ++it)
+    {
+        count += it->end - it->start + 1;
+    }
+    return count;
+}
+
+// reads the header and checks it is for this model and layout ... leaves the file at the data
+static bool ReadHeader(wxFile& f, const std::string& model, uint64_t key, const std::vector<NodeRange>& ranges, RenderCacheHeader& header)
+{
+    if (f.Read(&header, sizeof(header)) != sizeof(header)) return false;
+    if (memcmp(header.magic, RENDERCACHE_MAGIC, 4) != 0 || header.version != RENDERCACHE_VERSION) return false;
+    if (header.key != key || header.ranges != ranges.size() || header.nameLength != model.size()) return false;
+
+    std::string name(header.nameLength, ' ');
+    if (header.nameLength > 0 && f.Read(&name[0], header.nameLength) != (ssize_t)header.nameLength) return false;
+    if (name != model) return false;
+
+    for (auto it = ranges.begin(); it != ranges.end(); ++it)
+    {
+        uint32_t r[2];
+        if (f.Read(r, sizeof(r)) != sizeof(r)) return false;
+        if (r[0] != it->start || r[1] != it->end) return false;
+    }
+    return true;
+}
+
+static int FindGroup(std::vector<int>& groups, int model)
+{
+    while (groups[model] != model)
+    {
+        groups[model] = groups[groups[model]];
+        model = groups[model];
+    }
+    return model;
+}
+
+// the whole file for a model ... header, name, ranges then each frame's channels
+static void BuildFile(const RenderCache::Entry& model, const SequenceData& seqData, std::vector<unsigned char>& data)
+{
+    RenderCacheHeader header;
+    memset(&header, 0x00, sizeof(header));
+    memcpy(header.magic, RENDERCACHE_MAGIC, 4);
+    header.version = RENDERCACHE_VERSION;
+    header.key = model.key;
+    header.frames = seqData.NumFrames();
+    header.ranges = model.ranges.size();
+    header.nameLength = model.model.size();
+
+    size_t frameSize = ChannelCount(model.ranges);
+    data.resize(sizeof(header) + model.model.size() + model.ranges.size() * 2 * sizeof(uint32_t) + frameSize * header.frames);
+    unsigned char* p = &data[0];
+    memcpy(p, &header, sizeof(header));
+    p += sizeof(header);
+    memcpy(p, model.model.c_str(), model.model.size());
+    p += model.model.size();
+    for (auto it = model.ranges.begin(); it != model.ranges.end(); ++it)
+    {
+        uint32_t r[2] = { it->start, it->end };
+        memcpy(p, r, sizeof(r));
+        p += sizeof(r);
+    }
+
+    for (unsigned int frame = 0; frame < header.frames; frame++)
+    {
+        const FrameData fd = seqData[frame];
+        for (auto it = model.ranges.begin(); it != model.ranges.end(); ++it)
+        {
+            // ranges come from the model's nodes which always fit in the sequence
+            size_t count = it->end - it->start + 1;
+            memcpy(p, fd[it->start], count);
+            p += count;
+        }
+    }
+}
+
+static void WriteFile(const RenderCacheFile& file)
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    // written to a temporary file first so a failed write never looks like a good cache
+    std::string tempname = file.filename + ".tmp";
+    wxFile f;
+    if (!f.Create(tempname, true))
+    {
+        logger_base.warn("RenderCache: Unable to create %s.", (const char *)tempname.c_str());
+        return;
+    }
+    bool ok = f.Write(&file.data[0], file.data.size()) == file.data.size();
+    f.Close();
+
+    if (!ok || !wxRenameFile(tempname, file.filename, true))
+    {
+        logger_base.warn("RenderCache: Unable to write render cache for model '%s'.", (const char *)file.model.c_str());
+        wxRemoveFile(tempname);
+    }
+}
+
+// removes every file in the folder not in keep
+static void PruneFolder(const std::string& folder, const std::set<std::string>& keep)
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (!wxDirExists(folder)) return;
+
+    // collect first as removing files while wxDir is walking the folder is not safe everywhere
+    std::vector<std::string> remove;
+    wxDir dir(folder);
+    wxString filename;
+    bool cont = dir.IsOpened() && dir.GetFirst(&filename, "*.xrc*", wxDIR_FILES);
+    while (cont)
+    {
+        std::string file = (dir.GetNameWithSep() + filename).ToStdString();
+        // anything still .tmp is left over from a write that never finished
+        if (keep.find(file) == keep.end())
+        {
+            remove.push_back(file);
+        }
+        cont = dir.GetNext(&filename);
+    }
+
+    for (auto it = remove.begin(); it != remove.end(); ++it)
+    {
+        if (!wxRemoveFile(*it))
+        {
+            logger_base.warn("RenderCache: Unable to remove %s.", (const char *)it->c_str());
+        }
+    }
+
+    if (remove.size() > 0)
+    {
+        logger_base.debug("RenderCache: Removed %d files for models no longer in the sequence.", (int)remove.size());
+    }
+}
+
+// writes the files a save put together then prunes the folder
+class RenderCacheWriter : public wxThread
+{
+    std::string _folder;
+    std::vector<RenderCacheFile> _files;
+    std::set<std::string> _keep;
+
+public:
+    RenderCacheWriter(const std::string& folder, std::vector<RenderCacheFile>& files, std::set<std::string>& keep) : wxThread(wxTHREAD_JOINABLE), _folder(folder)
+    {
+        _files.swap(files);
+        _keep.swap(keep);
+    }
+
+    virtual ExitCode Entry() override
+    {
+        static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+        wxStopWatch sw;
+        for (auto it = _files.begin(); it != _files.end(); ++it)
+        {
+            WriteFile(*it);
+        }
+        PruneFolder(_folder, _keep);
+        logger_base.debug("RenderCache: Wrote %d models in %ldms.", (int)_files.size(), sw.Time());
+        return nullptr;
+    }
+};
+
+#pragma region Hasher
+void RenderCache::Hasher::Add(const void* data, size_t len)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    for (size_t i = 0; i < len; i++)
+    {
+        _hash ^= p[i];
+        _hash *= 1099511628211ULL;
+    }
+}
+
+void RenderCache::Hasher::Add(const std::string& s)
+{
+    Add((long long)s.size());
+    Add(s.c_str(), s.size());
+}
+#pragma endregion Hasher
+
+RenderCache::~RenderCache()
+{
+    Wait();
+}
+
+void RenderCache::SetSequence(const std::string& sequenceFile)
+{
+    if (sequenceFile == "")
+    {
+        _folder = "";
+        return;
+    }
+
+    wxFileName fn(sequenceFile);
+    _folder = (fn.GetPath() + wxFileName::GetPathSeparator() + fn.GetName() + "_RenderCache").ToStdString();
+}
+
+std::string RenderCache::GetFileName(const std::string& model) const
+{
+    // model names can hold anything so the file is named by a hash ... the name is checked when reading
+    Hasher h;
+    h.Add(model);
+    return _folder + wxString(wxFileName::GetPathSeparator()).ToStdString() + wxString::Format("%016llx.xrc", (unsigned long long)h.Get()).ToStdString();
+}
+
+bool RenderCache::Matches(const std::string& model, uint64_t key, unsigned int frames, const std::vector<NodeRange>& ranges) const
+{
+    if (!IsEnabled()) return false;
+
+    std::string filename = GetFileName(model);
+    if (!wxFile::Exists(filename)) return false;
+
+    wxFile f;
+    if (!f.Open(filename)) return false;
+
+    RenderCacheHeader header;
+    if (!ReadHeader(f, model, key, ranges, header) || header.frames != frames) return false;
+
+    // a partly written file is treated as missing
+    return f.Length() - f.Tell() == (wxFileOffset)(ChannelCount(ranges) * frames);
+}
+
+bool RenderCache::Load(const std::string& model, uint64_t key, const std::vector<NodeRange>& ranges, SequenceData& seqData) const
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (!IsEnabled()) return false;
+
+    wxFile f;
+    if (!f.Open(GetFileName(model))) return false;
+
+    RenderCacheHeader header;
+    if (!ReadHeader(f, model, key, ranges, header) || header.frames != seqData.NumFrames()) return false;
+
+    size_t frameSize = ChannelCount(ranges);
+    std::vector<unsigned char> buffer(frameSize);
+    for (unsigned int frame = 0; frame < header.frames; frame++)
+    {
+        if (frameSize > 0 && f.Read(&buffer[0], frameSize) != (ssize_t)frameSize)
+        {
+            logger_base.warn("RenderCache: Cache for model '%s' is truncated.", (const char *)model.c_str());
+            return false;
+        }
+
+        FrameData fd = seqData[frame];
+        size_t i = 0;
+        for (auto it = ranges.begin(); it != ranges.end(); ++it)
+        {
+            for (unsigned int ch = it->start; ch <= it->end; ch++)
+            {
+                fd[ch] = buffer[i++];
+            }
+        }
+    }
+
+    return true;
+}
+
+std::vector<bool> RenderCache::Restore(const std::vector<Entry>& models, const std::vector<std::pair<int, int>>& overlaps,
+                                       const std::vector<NodeRange>& clearRanges, SequenceData& seqData) const
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    // a job asked to clear zeroes each frame as it gets to it which would wipe out whatever is loaded ... so
+    // it is all done here first
+    for (unsigned int frame = 0; frame < seqData.NumFrames() && seqData.NumChannels() > 0; frame++)
+    {
+        FrameData fd = seqData[frame];
+        for (auto it = clearRanges.begin(); it != clearRanges.end(); ++it)
+        {
+            unsigned int end = std::min(it->end, seqData.NumChannels() - 1);
+            if (it->start <= end)
+            {
+                memset(&fd[it->start], 0x00, end - it->start + 1);
+            }
+        }
+    }
+
+    std::vector<bool> loaded(models.size(), false);
+    if (!IsEnabled()) return loaded;
+
+    // each model's cached data includes whatever the models it shares channels with left there
+    std::vector<int> groups(models.size());
+    for (size_t m = 0; m < models.size(); m++)
+    {
+        groups[m] = m;
+    }
+    for (auto it = overlaps.begin(); it != overlaps.end(); ++it)
+    {
+        groups[FindGroup(groups, it->first)] = FindGroup(groups, it->second);
+    }
+
+    std::vector<bool> groupCached(models.size(), true);
+    for (size_t m = 0; m < models.size(); m++)
+    {
+        if (!Matches(models[m].model, models[m].key, seqData.NumFrames(), models[m].ranges))
+        {
+            groupCached[FindGroup(groups, m)] = false;
+        }
+    }
+    for (size_t m = 0; m < models.size(); m++)
+    {
+        int group = FindGroup(groups, m);
+        if (groupCached[group] && !Load(models[m].model, models[m].key, models[m].ranges, seqData))
+        {
+            // anything already loaded for the group is simply rendered over
+            groupCached[group] = false;
+        }
+    }
+
+    int reused = 0;
+    for (size_t m = 0; m < models.size(); m++)
+    {
+        loaded[m] = groupCached[FindGroup(groups, m)];
+        if (loaded[m]) reused++;
+    }
+    logger_base.debug("Render cache: %d models unchanged, %d models to render.", reused, (int)models.size() - reused);
+
+    return loaded;
+}
+
+void RenderCache::Save(const std::vector<Entry>& models, const std::vector<std::string>& keep, const SequenceData& seqData)
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (!IsEnabled()) return;
+
+    // only one writer at a time so two of them never share a .tmp file or prune each other's
+    Wait();
+
+    if (!wxDirExists(_folder) && !wxFileName::Mkdir(_folder, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL))
+    {
+        logger_base.warn("RenderCache: Unable to create render cache folder %s.", (const char *)_folder.c_str());
+        _folder = "";
+        return;
+    }
+
+    // the next render can change the sequence data as soon as we return so the files are put together now
+    std::vector<RenderCacheFile> files(models.size());
+    for (size_t m = 0; m < models.size(); m++)
+    {
+        files[m].model = models[m].model;
+        files[m].filename = GetFileName(models[m].model);
+        BuildFile(models[m], seqData, files[m].data);
+    }
+    std::set<std::string> keepFiles;
+    for (auto it = keep.begin(); it != keep.end(); ++it)
+    {
+        keepFiles.insert(GetFileName(*it));
+    }
+
+    _writer = new RenderCacheWriter(_folder, files, keepFiles);
+    if (_writer->Create() != wxTHREAD_NO_ERROR)
+    {
+        logger_base.warn("RenderCache: Unable to create the writer thread, writing the cache on this one.");
+        _writer->Entry();
+        delete _writer;
+        _writer = nullptr;
+        return;
+    }
+    _writer->Run();
+}
+
+void RenderCache::Wait()
+{
+    if (_writer == nullptr) return;
+
+    _writer->Wait();
+    delete _writer;
+    _writer = nullptr;
+}
+
+void RenderCache::Prune(const std::vector<std::string>& models)
+{
+    if (!IsEnabled()) return;
+
+    Wait();
+
+    std::set<std::string> keep;
+    for (auto it = models.begin(); it != models.end(); ++it)
+    {
+        keep.insert(GetFileName(*it));
+    }
+    PruneFolder(_folder, keep);
+}
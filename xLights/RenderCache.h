@@ -0,0 +1,88 @@
+#ifndef RENDERCACHE_H
+#define RENDERCACHE_H
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "RenderUtils.h"
+
+class SequenceData;
+class RenderCacheWriter;
+
+// ******************************************************
+// * Keeps the rendered channel data for each model in a
+// * folder beside the sequence. Each model is stored with
+// * a key hashed from everything that goes into rendering
+// * it so a full render can copy an unchanged model back
+// * into the sequence data rather than rendering it again.
+// ******************************************************
+
+class RenderCache
+{
+public:
+
+    // 64 bit FNV-1a ... the same on every platform and every run
+    class Hasher
+    {
+        uint64_t _hash;
+
+    public:
+        Hasher() : _hash(14695981039346656037ULL) {}
+        void Add(const void* data, size_t len);
+        void Add(const std::string& s);
+        void Add(long long v) { Add(&v, sizeof(v)); }
+        uint64_t Get() const { return _hash; }
+    };
+
+    // a model in a full render
+    struct Entry
+    {
+        std::string model;
+        uint64_t key;
+        std::vector<NodeRange> ranges;
+    };
+
+private:
+
+    #pragma region Member Variables
+    std::string _folder;
+    RenderCacheWriter* _writer;
+    #pragma endregion Member Variables
+
+    RenderCache(const RenderCache&);  //make sure we cannot "copy" these
+    RenderCache &operator=(const RenderCache&);
+
+    std::string GetFileName(const std::string& model) const;
+
+public:
+
+    #pragma region Constructors and Destructors
+    RenderCache() : _writer(nullptr) {}
+    virtual ~RenderCache();
+    #pragma endregion Constructors and Destructors
+
+    // the sequence the cache belongs to ... blank turns the cache off
+    void SetSequence(const std::string& sequenceFile);
+    bool IsEnabled() const { return _folder != ""; }
+
+    // only reads the header
+    bool Matches(const std::string& model, uint64_t key, unsigned int frames, const std::vector<NodeRange>& ranges) const;
+    // copies the cached channels into the sequence data
+    bool Load(const std::string& model, uint64_t key, const std::vector<NodeRange>& ranges, SequenceData& seqData) const;
+    // readies the sequence data for a full render ... zeroes clearRanges in every frame then copies in
+    // the models whose cache is current. Models sharing channels, given as pairs of indexes into models,
+    // are only reused together. Returns true for each model loaded, the rest must be rendered without
+    // clearing anything
+    std::vector<bool> Restore(const std::vector<Entry>& models, const std::vector<std::pair<int, int>>& overlaps,
+                              const std::vector<NodeRange>& clearRanges, SequenceData& seqData) const;
+    // copies the models' channels out of the sequence data then writes them, and removes the files
+    // of every model not in keep, on a thread of its own. A save still writing is waited for first
+    void Save(const std::vector<Entry>& models, const std::vector<std::string>& keep, const SequenceData& seqData);
+    // waits for a save to finish writing
+    void Wait();
+    // removes the files for models not in the list so deleted and renamed models do not pile up
+    void Prune(const std::vector<std::string>& models);
+};
+
+#endif
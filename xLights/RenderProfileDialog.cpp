@@ -0,0 +1,209 @@
+#include "RenderProfileDialog.h"
+
+//(*InternalHeaders(RenderProfileDialog)
+#include <wx/intl.h>
+#include <wx/string.h>
+//*)
+
+#include <wx/filedlg.h>
+#include <wx/file.h>
+#include <wx/msgdlg.h>
+#include <algorithm>
+#include <log4cpp/Category.hh>
+
+#define COLUMN_CATEGORY 0
+#define COLUMN_NAME 1
+#define COLUMN_FRAMES 2
+#define COLUMN_TOTAL 3
+#define COLUMN_AVERAGE 4
+#define COLUMN_P50 5
+#define COLUMN_P90 6
+#define COLUMN_P99 7
+#define COLUMN_MAX 8
+
+//(*IdInit(RenderProfileDialog)
+const long RenderProfileDialog::ID_LISTCTRL_TIMINGS = wxNewId();
+const long RenderProfileDialog::ID_STATICTEXT_SUMMARY = wxNewId();
+const long RenderProfileDialog::ID_BUTTON_EXPORT = wxNewId();
+const long RenderProfileDialog::ID_BUTTON_CLOSE = wxNewId();
+//*)
+
+BEGIN_EVENT_TABLE(RenderProfileDialog,wxDialog)
+	//(*EventTable(RenderProfileDialog)
+	//*)
+END_EVENT_TABLE()
+
+RenderProfileDialog::RenderProfileDialog(wxWindow* parent, const RenderProfiler::Results& results, wxWindowID id, const wxPoint& pos, const wxSize& size) : _results(results)
+{
+	//(*Initialize(RenderProfileDialog)
+	wxFlexGridSizer* FlexGridSizer1;
+	wxFlexGridSizer* FlexGridSizer2;
+
+	Create(parent, id, _("Render Profile"), wxDefaultPosition, wxDefaultSize, wxDEFAULT_DIALOG_STYLE|wxRESIZE_BORDER|wxMAXIMIZE_BOX, _T("id"));
+	SetClientSize(wxDefaultSize);
+	Move(wxDefaultPosition);
+	FlexGridSizer1 = new wxFlexGridSizer(0, 1, 0, 0);
+	FlexGridSizer1->AddGrowableCol(0);
+	FlexGridSizer1->AddGrowableRow(0);
+	ListCtrl_Timings = new wxListCtrl(this, ID_LISTCTRL_TIMINGS, wxDefaultPosition, wxSize(800,400), wxLC_REPORT|wxLC_SINGLE_SEL, wxDefaultValidator, _T("ID_LISTCTRL_TIMINGS"));
+	FlexGridSizer1->Add(ListCtrl_Timings, 1, wxALL|wxEXPAND, 2);
+	FlexGridSizer2 = new wxFlexGridSizer(0, 3, 0, 0);
+	FlexGridSizer2->AddGrowableCol(0);
+	StaticText_Summary = new wxStaticText(this, ID_STATICTEXT_SUMMARY, wxEmptyString, wxDefaultPosition, wxDefaultSize, 0, _T("ID_STATICTEXT_SUMMARY"));
+	FlexGridSizer2->Add(StaticText_Summary, 1, wxALL|wxALIGN_LEFT|wxALIGN_CENTER_VERTICAL, 5);
+	Button_Export = new wxButton(this, ID_BUTTON_EXPORT, _("Export CSV"), wxDefaultPosition, wxDefaultSize, 0, wxDefaultValidator, _T("ID_BUTTON_EXPORT"));
+	FlexGridSizer2->Add(Button_Export, 1, wxALL|wxALIGN_CENTER_HORIZONTAL|wxALIGN_CENTER_VERTICAL, 5);
+	Button_Close = new wxButton(this, ID_BUTTON_CLOSE, _("Close"), wxDefaultPosition, wxDefaultSize, 0, wxDefaultValidator, _T("ID_BUTTON_CLOSE"));
+	FlexGridSizer2->Add(Button_Close, 1, wxALL|wxALIGN_CENTER_HORIZONTAL|wxALIGN_CENTER_VERTICAL, 5);
+	FlexGridSizer1->Add(FlexGridSizer2, 1, wxALL|wxEXPAND, 0);
+	SetSizer(FlexGridSizer1);
+	FlexGridSizer1->Fit(this);
+	FlexGridSizer1->SetSizeHints(this);
+
+	Connect(ID_LISTCTRL_TIMINGS,wxEVT_COMMAND_LIST_COL_CLICK,(wxObjectEventFunction)&RenderProfileDialog::OnListCtrl_TimingsColumnClick);
+	Connect(ID_BUTTON_EXPORT,wxEVT_COMMAND_BUTTON_CLICKED,(wxObjectEventFunction)&RenderProfileDialog::OnButton_ExportClick);
+	Connect(ID_BUTTON_CLOSE,wxEVT_COMMAND_BUTTON_CLICKED,(wxObjectEventFunction)&RenderProfileDialog::OnButton_CloseClick);
+	//*)
+
+    ListCtrl_Timings->InsertColumn(COLUMN_CATEGORY, "Category");
+    ListCtrl_Timings->InsertColumn(COLUMN_NAME, "Name");
+    ListCtrl_Timings->InsertColumn(COLUMN_FRAMES, "Frames", wxLIST_FORMAT_RIGHT);
+    ListCtrl_Timings->InsertColumn(COLUMN_TOTAL, "Total ms", wxLIST_FORMAT_RIGHT);
+    ListCtrl_Timings->InsertColumn(COLUMN_AVERAGE, "Average ms", wxLIST_FORMAT_RIGHT);
+    ListCtrl_Timings->InsertColumn(COLUMN_P50, "P50 ms", wxLIST_FORMAT_RIGHT);
+    ListCtrl_Timings->InsertColumn(COLUMN_P90, "P90 ms", wxLIST_FORMAT_RIGHT);
+    ListCtrl_Timings->InsertColumn(COLUMN_P99, "P99 ms", wxLIST_FORMAT_RIGHT);
+    ListCtrl_Timings->InsertColumn(COLUMN_MAX, "Max ms", wxLIST_FORMAT_RIGHT);
+
+    for (int c = 0; c < RenderProfiler::CATEGORY_COUNT; c++)
+    {
+        for (auto it = _results.timings[c].begin(); it != _results.timings[c].end(); ++it)
+        {
+            Row row;
+            row.category = c;
+            row.name = it->first;
+            row.timing = it->second;
+            _rows.push_back(row);
+        }
+    }
+
+    StaticText_Summary->SetLabel(wxString::Format("Last render took %.3f seconds.", (double)_results.renderUS / 1000000.0));
+
+    // slowest first is usually what you want to see
+    _sortColumn = COLUMN_TOTAL;
+    _sortAscending = false;
+    SortRows();
+    PopulateList();
+}
+
+RenderProfileDialog::~RenderProfileDialog()
+{
+	//(*Destroy(RenderProfileDialog)
+	//*)
+}
+
+static double SortValue(const RenderProfiler::Timing& t, int column)
+{
+    switch (column)
+    {
+    case COLUMN_FRAMES: return t.count;
+    case COLUMN_TOTAL: return (double)t.totalUS;
+    case COLUMN_AVERAGE: return t.AverageMS();
+    case COLUMN_P50: return t.PercentileMS(0.5f);
+    case COLUMN_P90: return t.PercentileMS(0.9f);
+    case COLUMN_P99: return t.PercentileMS(0.99f);
+    case COLUMN_MAX: return (double)t.maxUS;
+    default: break;
+    }
+    return 0.0;
+}
+
+void RenderProfileDialog::SortRows()
+{
+    int column = _sortColumn;
+    bool ascending = _sortAscending;
+    std::stable_sort(_rows.begin(), _rows.end(), [column, ascending](const Row& a, const Row& b)
+    {
+        const Row& l = ascending ? a : b;
+        const Row& r = ascending ? b : a;
+        if (column == COLUMN_CATEGORY)
+        {
+            if (l.category != r.category) return l.category < r.category;
+            return l.name < r.name;
+        }
+        if (column == COLUMN_NAME)
+        {
+            return l.name < r.name;
+        }
+        return SortValue(l.timing, column) < SortValue(r.timing, column);
+    });
+}
+
+void RenderProfileDialog::PopulateList()
+{
+    ListCtrl_Timings->Freeze();
+    ListCtrl_Timings->DeleteAllItems();
+    for (size_t i = 0; i < _rows.size(); i++)
+    {
+        const Row& row = _rows[i];
+        const RenderProfiler::Timing& t = row.timing;
+        long item = ListCtrl_Timings->InsertItem(i, RenderProfiler::CategoryName(row.category));
+        ListCtrl_Timings->SetItem(item, COLUMN_NAME, row.name);
+        ListCtrl_Timings->SetItem(item, COLUMN_FRAMES, wxString::Format("%ld", t.count));
+        ListCtrl_Timings->SetItem(item, COLUMN_TOTAL, wxString::Format("%.1f", (double)t.totalUS / 1000.0));
+        ListCtrl_Timings->SetItem(item, COLUMN_AVERAGE, wxString::Format("%.3f", t.AverageMS()));
+        ListCtrl_Timings->SetItem(item, COLUMN_P50, wxString::Format("%.3f", t.PercentileMS(0.5f)));
+        ListCtrl_Timings->SetItem(item, COLUMN_P90, wxString::Format("%.3f", t.PercentileMS(0.9f)));
+        ListCtrl_Timings->SetItem(item, COLUMN_P99, wxString::Format("%.3f", t.PercentileMS(0.99f)));
+        ListCtrl_Timings->SetItem(item, COLUMN_MAX, wxString::Format("%.3f", (double)t.maxUS / 1000.0));
+    }
+    for (int c = COLUMN_CATEGORY; c <= COLUMN_MAX; c++)
+    {
+        ListCtrl_Timings->SetColumnWidth(c, wxLIST_AUTOSIZE_USEHEADER);
+    }
+    ListCtrl_Timings->Thaw();
+}
+
+void RenderProfileDialog::OnListCtrl_TimingsColumnClick(wxListEvent& event)
+{
+    int column = event.GetColumn();
+    if (column < 0) return;
+
+    if (column == _sortColumn)
+    {
+        _sortAscending = !_sortAscending;
+    }
+    else
+    {
+        _sortColumn = column;
+        // text reads best a-z, timings slowest first
+        _sortAscending = (column == COLUMN_CATEGORY || column == COLUMN_NAME);
+    }
+    SortRows();
+    PopulateList();
+}
+
+void RenderProfileDialog::OnButton_ExportClick(wxCommandEvent& event)
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    wxFileDialog dlg(this, "Export render profile", wxEmptyString, "RenderProfile", "CSV Files (*.csv)|*.csv|All Files (*.)|*.*", wxFD_SAVE | wxFD_OVERWRITE_PROMPT);
+    if (dlg.ShowModal() == wxID_OK)
+    {
+        wxFile f;
+        if (!f.Create(dlg.GetPath(), true) || !f.IsOpened())
+        {
+            logger_base.error("Unable to create render profile file %s.", (const char *)dlg.GetPath().c_str());
+            wxMessageBox("Unable to create file " + dlg.GetPath(), "Error", wxOK | wxICON_ERROR, this);
+            return;
+        }
+        std::string csv = RenderProfiler::AsCSV(_results);
+        f.Write(csv.c_str(), csv.size());
+        f.Close();
+    }
+}
+
+void RenderProfileDialog::OnButton_CloseClick(wxCommandEvent& event)
+{
+    EndDialog(wxID_CLOSE);
+}
@@ -0,0 +1,64 @@
+#ifndef RENDERPROFILEDIALOG_H
+#define RENDERPROFILEDIALOG_H
+
+//(*Headers(RenderProfileDialog)
+#include <wx/sizer.h>
+#include <wx/stattext.h>
+#include <wx/listctrl.h>
+#include <wx/button.h>
+#include <wx/dialog.h>
+//*)
+
+#include <vector>
+#include "RenderProfiler.h"
+
+class RenderProfileDialog: public wxDialog
+{
+    struct Row
+    {
+        int category;
+        std::string name;
+        RenderProfiler::Timing timing;
+    };
+
+    RenderProfiler::Results _results;
+    std::vector<Row> _rows;
+    int _sortColumn;
+    bool _sortAscending;
+
+    void SortRows();
+    void PopulateList();
+
+	public:
+
+		RenderProfileDialog(wxWindow* parent, const RenderProfiler::Results& results, wxWindowID id=wxID_ANY, const wxPoint& pos=wxDefaultPosition, const wxSize& size=wxDefaultSize);
+		virtual ~RenderProfileDialog();
+
+		//(*Declarations(RenderProfileDialog)
+		wxListCtrl* ListCtrl_Timings;
+		wxStaticText* StaticText_Summary;
+		wxButton* Button_Export;
+		wxButton* Button_Close;
+		//*)
+
+	protected:
+
+		//(*Identifiers(RenderProfileDialog)
+		static const long ID_LISTCTRL_TIMINGS;
+		static const long ID_STATICTEXT_SUMMARY;
+		static const long ID_BUTTON_EXPORT;
+		static const long ID_BUTTON_CLOSE;
+		//*)
+
+	private:
+
+		//(*Handlers(RenderProfileDialog)
+		void OnListCtrl_TimingsColumnClick(wxListEvent& event);
+		void OnButton_ExportClick(wxCommandEvent& event);
+		void OnButton_CloseClick(wxCommandEvent& event);
+		//*)
+
+		DECLARE_EVENT_TABLE()
+};
+
+#endif
@@ -0,0 +1,334 @@
+#include "RenderProfiler.h"
+
+#include <chrono>
+#include <sstream>
+#include <cstdio>
+#include <cstring>
+
+// the buffer this thread records into along with the profiler it belongs to
+static thread_local RenderProfiler* __threadProfiler = nullptr;
+static thread_local void* __threadBuffer = nullptr;
+static thread_local unsigned int __threadGeneration = 0;
+
+static std::string JSONString(const std::string& s)
+{
+    std::string res = "\"";
+    for (auto c = s.begin(); c != s.end(); ++c)
+    {
+        switch (*c)
+        {
+        case '"': res += "\\\""; break;
+        case '\\': res += "\\\\"; break;
+        case '\n': res += "\\n"; break;
+        case '\r': res += "\\r"; break;
+        case '\t': res += "\\t"; break;
+        default:
+            if ((unsigned char)*c < 0x20)
+            {
+                char buf[8];
+                snprintf(buf, sizeof(buf), "\\u%04x", (unsigned char)*c);
+                res += buf;
+            }
+            else
+            {
+                res += *c;
+            }
+            break;
+        }
+    }
+    return res + "\"";
+}
+
+static std::string CSVString(const std::string& s)
+{
+    if (s.find_first_of(",\"\n\r") == std::string::npos) return s;
+
+    std::string res = "\"";
+    for (auto c = s.begin(); c != s.end(); ++c)
+    {
+        if (*c == '"') res += '"';
+        res += *c;
+    }
+    return res + "\"";
+}
+
+static void WriteTimings(std::ostringstream& out, const std::string& name, const std::map<std::string, RenderProfiler::Timing>& timings)
+{
+    out << "  " << JSONString(name) << ": [";
+    bool first = true;
+    for (auto it = timings.begin(); it != timings.end(); ++it)
+    {
+        out << (first ? "\n" : ",\n");
+        out << "    { \"name\": " << JSONString(it->first)
+            << ", \"frames\": " << it->second.count
+            << ", \"ms\": " << (double)it->second.totalUS / 1000.0
+            << ", \"p50ms\": " << it->second.PercentileMS(0.5f)
+            << ", \"p90ms\": " << it->second.PercentileMS(0.9f)
+            << ", \"p99ms\": " << it->second.PercentileMS(0.99f)
+            << ", \"maxms\": " << (double)it->second.maxUS / 1000.0 << " }";
+        first = false;
+    }
+    out << (first ? "]" : "\n  ]");
+}
+
+#pragma region Timing
+RenderProfiler::Timing::Timing() : count(0), totalUS(0), maxUS(0)
+{
+    memset(buckets, 0x00, sizeof(buckets));
+}
+
+int RenderProfiler::Timing::Bucket(long long us)
+{
+    if (us <= 1) return 0;
+
+    int bit = 0;
+    while ((us >> (bit + 1)) != 0) bit++;
+    if (bit >= 31) return RENDERPROFILER_BUCKETS - 1; // us * us would overflow
+    // upper half of the octave starts at 2^bit * sqrt(2)
+    int b = bit * 2 + ((us * us >= (1LL << (bit * 2)) * 2) ? 1 : 0);
+    return b < RENDERPROFILER_BUCKETS ? b : RENDERPROFILER_BUCKETS - 1;
+}
+
+long long RenderProfiler::Timing::BucketLimitUS(int bucket)
+{
+    int bit = bucket / 2;
+    if (bucket % 2 == 0)
+    {
+        return (long long)((double)(1LL << bit) * 1.41421356);
+    }
+    return 1LL << (bit + 1);
+}
+
+void RenderProfiler::Timing::Add(long n, long long us)
+{
+    count += n;
+    totalUS += us;
+    if (n <= 0) return;
+
+    long long frameUS = us / n;
+    buckets[Bucket(frameUS)] += n;
+    if (frameUS > maxUS) maxUS = frameUS;
+}
+
+void RenderProfiler::Timing::Merge(const Timing& t)
+{
+    count += t.count;
+    totalUS += t.totalUS;
+    if (t.maxUS > maxUS) maxUS = t.maxUS;
+    for (int i = 0; i < RENDERPROFILER_BUCKETS; i++)
+    {
+        buckets[i] += t.buckets[i];
+    }
+}
+
+double RenderProfiler::Timing::PercentileMS(float p) const
+{
+    long long frames = 0;
+    for (int i = 0; i < RENDERPROFILER_BUCKETS; i++)
+    {
+        frames += buckets[i];
+    }
+    if (frames == 0) return 0.0;
+
+    long long target = (long long)((double)frames * p);
+    if (target < 1) target = 1;
+    long long seen = 0;
+    for (int i = 0; i < RENDERPROFILER_BUCKETS; i++)
+    {
+        seen += buckets[i];
+        if (seen >= target)
+        {
+            long long us = BucketLimitUS(i);
+            if (us > maxUS) us = maxUS;
+            return (double)us / 1000.0;
+        }
+    }
+    return (double)maxUS / 1000.0;
+}
+#pragma endregion Timing
+
+#pragma region Constructors and Destructors
+RenderProfiler::RenderProfiler()
+{
+    _startUS = 0;
+    _renderUS = 0;
+    _running = false;
+    _generation = 0;
+}
+
+RenderProfiler::~RenderProfiler()
+{
+    for (auto it = _buffers.begin(); it != _buffers.end(); ++it)
+    {
+        delete *it;
+    }
+    _buffers.clear();
+    for (auto it = _free.begin(); it != _free.end(); ++it)
+    {
+        delete *it;
+    }
+    _free.clear();
+}
+#pragma endregion Constructors and Destructors
+
+long long RenderProfiler::NowUS()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::string RenderProfiler::CategoryName(int category)
+{
+    switch (category)
+    {
+    case CATEGORY_MODEL: return "Model";
+    case CATEGORY_EFFECT: return "Effect";
+    case CATEGORY_LAYER_SETTING: return "Layer Setting";
+    default: break;
+    }
+    return "";
+}
+
+// render threads come and go with the job pool so buffers are reused rather than one kept for every thread ever seen
+RenderProfiler::ThreadBuffer* RenderProfiler::GetThreadBuffer()
+{
+    if (__threadProfiler != this || __threadBuffer == nullptr || __threadGeneration != _generation)
+    {
+        ThreadBuffer* buffer = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            if (_free.empty())
+            {
+                buffer = new ThreadBuffer();
+            }
+            else
+            {
+                buffer = _free.front();
+                _free.pop_front();
+            }
+            _buffers.push_back(buffer);
+            __threadGeneration = _generation;
+        }
+        __threadProfiler = this;
+        __threadBuffer = buffer;
+    }
+    return (ThreadBuffer*)__threadBuffer;
+}
+
+void RenderProfiler::TakeBackBuffers()
+{
+    for (auto it = _buffers.begin(); it != _buffers.end(); ++it)
+    {
+        // a thread that has not yet noticed may still add to it ... that is safe, the buffer is never freed while we run
+        std::unique_lock<std::mutex> block((*it)->lock);
+        for (int c = 0; c < CATEGORY_COUNT; c++)
+        {
+            for (auto t = (*it)->timings[c].begin(); t != (*it)->timings[c].end(); ++t)
+            {
+                _merged[c][t->first].Merge(t->second);
+            }
+            (*it)->timings[c].clear();
+        }
+    }
+    _free.splice(_free.end(), _buffers);
+    _generation++;
+}
+
+void RenderProfiler::Start()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    TakeBackBuffers();
+    for (int c = 0; c < CATEGORY_COUNT; c++)
+    {
+        _merged[c].clear();
+    }
+    _startUS = NowUS();
+    _renderUS = 0;
+    _running = true;
+}
+
+void RenderProfiler::Stop()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    if (_running)
+    {
+        _renderUS = NowUS() - _startUS;
+        _running = false;
+        TakeBackBuffers();
+    }
+}
+
+void RenderProfiler::Add(Category category, const std::string& name, long frames, long long us)
+{
+    if (!_running) return;
+
+    ThreadBuffer* buffer = GetThreadBuffer();
+    std::unique_lock<std::mutex> lock(buffer->lock);
+    buffer->timings[category][name].Add(frames, us);
+}
+
+RenderProfiler::Results RenderProfiler::GetResults()
+{
+    Results res;
+
+    std::unique_lock<std::mutex> lock(_lock);
+    res.renderUS = _running ? NowUS() - _startUS : _renderUS;
+    for (int c = 0; c < CATEGORY_COUNT; c++)
+    {
+        res.timings[c] = _merged[c];
+    }
+    for (auto it = _buffers.begin(); it != _buffers.end(); ++it)
+    {
+        std::unique_lock<std::mutex> block((*it)->lock);
+        for (int c = 0; c < CATEGORY_COUNT; c++)
+        {
+            for (auto t = (*it)->timings[c].begin(); t != (*it)->timings[c].end(); ++t)
+            {
+                res.timings[c][t->first].Merge(t->second);
+            }
+        }
+    }
+
+    return res;
+}
+
+std::string RenderProfiler::AsJSON(const std::string& sequence, long long totalUS)
+{
+    Results res = GetResults();
+
+    std::ostringstream out;
+    out << "{\n";
+    out << "  \"sequence\": " << JSONString(sequence) << ",\n";
+    out << "  \"totalMS\": " << (double)totalUS / 1000.0 << ",\n";
+    out << "  \"renderMS\": " << (double)res.renderUS / 1000.0 << ",\n";
+    WriteTimings(out, "models", res.timings[CATEGORY_MODEL]);
+    out << ",\n";
+    WriteTimings(out, "effects", res.timings[CATEGORY_EFFECT]);
+    out << ",\n";
+    WriteTimings(out, "layerSettings", res.timings[CATEGORY_LAYER_SETTING]);
+    out << "\n}";
+
+    return out.str();
+}
+
+std::string RenderProfiler::AsCSV(const Results& results)
+{
+    std::ostringstream out;
+    out << "Category,Name,Frames,Total ms,Average ms,P50 ms,P90 ms,P99 ms,Max ms\n";
+    for (int c = 0; c < CATEGORY_COUNT; c++)
+    {
+        for (auto it = results.timings[c].begin(); it != results.timings[c].end(); ++it)
+        {
+            const Timing& t = it->second;
+            out << CSVString(CategoryName(c)) << ","
+                << CSVString(it->first) << ","
+                << t.count << ","
+                << (double)t.totalUS / 1000.0 << ","
+                << t.AverageMS() << ","
+                << t.PercentileMS(0.5f) << ","
+                << t.PercentileMS(0.9f) << ","
+                << t.PercentileMS(0.99f) << ","
+                << (double)t.maxUS / 1000.0 << "\n";
+        }
+    }
+    return out.str();
+}
@@ -0,0 +1,112 @@
+#ifndef RENDERPROFILER_H
+#define RENDERPROFILER_H
+
+#include <string>
+#include <map>
+#include <list>
+#include <mutex>
+#include <atomic>
+
+// half octave buckets from 1us up to about 18 hours
+#define RENDERPROFILER_BUCKETS 64
+
+// ******************************************************
+// * Collects where render time goes ... wall time per
+// * model, per effect type and per layer setting (blur,
+// * rotozoom, transitions and sparkles). Render threads
+// * add to a buffer of their own so recording never
+// * waits on another thread. The buffers are merged when
+// * asked for the results and when a render stops, then
+// * handed to whichever threads record the next render.
+// ******************************************************
+
+class RenderProfiler
+{
+public:
+
+    enum Category
+    {
+        CATEGORY_MODEL = 0,
+        CATEGORY_EFFECT,
+        CATEGORY_LAYER_SETTING,
+        CATEGORY_COUNT
+    };
+
+    struct Timing
+    {
+        long count; // frames
+        long long totalUS;
+        long long maxUS; // slowest frame
+        unsigned int buckets[RENDERPROFILER_BUCKETS]; // frames by how long they took
+
+        Timing();
+        // n frames that took us between them
+        void Add(long n, long long us);
+        void Merge(const Timing& t);
+        double AverageMS() const { return count == 0 ? 0.0 : (double)totalUS / (double)count / 1000.0; }
+        // approximate ... the top of the bucket the percentile falls in
+        double PercentileMS(float p) const;
+
+        static int Bucket(long long us);
+        static long long BucketLimitUS(int bucket);
+    };
+
+    struct Results
+    {
+        long long renderUS;
+        std::map<std::string, Timing> timings[CATEGORY_COUNT];
+    };
+
+private:
+
+    struct ThreadBuffer
+    {
+        std::mutex lock; // only ever contended while results are being merged
+        std::map<std::string, Timing> timings[CATEGORY_COUNT];
+    };
+
+    #pragma region Member Variables
+    std::mutex _lock;
+    std::list<ThreadBuffer*> _buffers; // handed out this run
+    std::list<ThreadBuffer*> _free;
+    std::atomic<unsigned int> _generation; // bumped when the buffers are taken back so threads ask again
+    std::map<std::string, Timing> _merged[CATEGORY_COUNT]; // from buffers taken back this run
+    long long _startUS;
+    long long _renderUS;
+    std::atomic<bool> _running;
+    #pragma endregion Member Variables
+
+    ThreadBuffer* GetThreadBuffer();
+    // merges everything recorded into _merged and frees the buffers for reuse ... _lock must be held
+    void TakeBackBuffers();
+
+public:
+
+    #pragma region Constructors and Destructors
+    RenderProfiler();
+    ~RenderProfiler();
+    #pragma endregion Constructors and Destructors
+
+    static long long NowUS();
+    static std::string CategoryName(int category);
+
+    // clears anything collected and starts timing a render
+    void Start();
+    void Stop();
+    bool IsRunning() const { return _running; }
+
+    // ignored unless a render is being timed
+    void Add(Category category, const std::string& name, long frames, long long us);
+    void AddModel(const std::string& model, long frames, long long us) { Add(CATEGORY_MODEL, model, frames, us); }
+    void AddEffect(const std::string& effect, long long us) { Add(CATEGORY_EFFECT, effect, 1, us); }
+    void AddLayerSetting(const std::string& setting, long long us) { Add(CATEGORY_LAYER_SETTING, setting, 1, us); }
+
+    Results GetResults();
+
+    // results as a json object
+    std::string AsJSON(const std::string& sequence, long long totalUS);
+    // one row per model, effect and layer setting
+    static std::string AsCSV(const Results& results);
+};
+
+#endif
@@ -3,6 +3,9 @@
 #ifndef __XL_RENDERUTILS__
 #define __XL_RENDERUTILS__
 
+#include <vector>
+#include <algorithm>
+
 class NodeRange {
 public:
     NodeRange(unsigned int s, unsigned int e) : start(s), end(e) {}
@@ -47,6 +50,58 @@ public:
     unsigned int end;
 };
 
+// Finds every pair of owners (models/render rows) that share a channel.
+// Rather than comparing every owner's ranges against every other owner's it sorts all
+// the ranges once and sweeps them in start order only comparing ranges that are open at
+// the same time.
+class RangeOverlapSweep {
+public:
+    void Add(int owner, const NodeRange &r) {
+        ranges.push_back(OwnedRange(owner, r));
+    }
+
+    // each pair has the lower owner first ... sorted with no duplicates
+    std::vector<std::pair<int, int>> FindOverlaps() {
+        std::vector<std::pair<int, int>> res;
+        std::sort(ranges.begin(), ranges.end(), [](const OwnedRange &a, const OwnedRange &b) {
+            return a.range.start < b.range.start;
+        });
+
+        std::vector<OwnedRange> open;
+        for (auto it = ranges.begin(); it != ranges.end(); it++) {
+            // drop anything that finished before this one starts
+            for (size_t i = 0; i < open.size();) {
+                if (open[i].range.end < it->range.start) {
+                    open[i] = open.back();
+                    open.pop_back();
+                } else {
+                    i++;
+                }
+            }
+            for (auto o = open.begin(); o != open.end(); o++) {
+                if (o->owner < it->owner) {
+                    res.push_back(std::pair<int, int>(o->owner, it->owner));
+                } else if (o->owner > it->owner) {
+                    res.push_back(std::pair<int, int>(it->owner, o->owner));
+                }
+            }
+            open.push_back(*it);
+        }
+
+        std::sort(res.begin(), res.end());
+        res.erase(std::unique(res.begin(), res.end()), res.end());
+        return res;
+    }
+
+private:
+    struct OwnedRange {
+        OwnedRange(int o, const NodeRange &r) : owner(o), range(r) {}
+        int owner;
+        NodeRange range;
+    };
+    std::vector<OwnedRange> ranges;
+};
+
 
 
 
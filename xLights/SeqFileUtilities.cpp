@@ -380,7 +380,10 @@ void xLightsFrame::OpenSequence(const wxString passed_filename, ConvertLogDialog
         {
             SeqData.init(GetMaxNumChannels(), CurrentSeqXmlFile->GetSequenceDurationMS() / ms, ms);
         }
-        displayElementsPanel->Initialize();
+        if (!_renderMode)
+        {
+            displayElementsPanel->Initialize();
+        }
         Timer1.Start(SeqData.FrameTime());
 
         if( loaded_fseq )
@@ -398,7 +401,11 @@ void xLightsFrame::OpenSequence(const wxString passed_filename, ConvertLogDialog
         SetTitle(xlights_base_name + " - " + filename);
 
         EnableSequenceControls(true);
-        Notebook1->SetSelection(Notebook1->GetPageIndex(PanelSequencer));
+        // switching tab sets up the sequencer windows which a batch render does not have
+        if (!_renderMode)
+        {
+            Notebook1->SetSelection(Notebook1->GetPageIndex(PanelSequencer));
+        }
     }
 }
 
@@ -448,13 +455,19 @@ bool xLightsFrame::CloseSequence()
     mSavedChangeCount = mSequenceElements.GetChangeCount();
     mLastAutosaveCount = mSavedChangeCount;
 
-    mainSequencer->PanelWaveForm->CloseMedia();
+    if (mainSequencer != nullptr)
+    {
+        mainSequencer->PanelWaveForm->CloseMedia();
+    }
     SeqData.init(0,0,50);
     EnableSequenceControls(true);  // let it re-evaluate menu state
     SetStatusText("");
     SetStatusText(CurrentDir, 1);
-    sPreview1->Refresh();
-    sPreview2->Refresh();
+    if (sPreview1 != nullptr)
+    {
+        sPreview1->Refresh();
+        sPreview2->Refresh();
+    }
 
     SetTitle( xlights_base_name + xlights_qualifier + " (Ver " + xlights_version_string + ") " + xlights_build_date );
 
@@ -550,7 +563,10 @@ void xLightsFrame::RenderIseqData(bool bottom_layers, ConvertLogDialog* plog)
 
 void xLightsFrame::SetSequenceEnd(int ms)
 {
-    mainSequencer->PanelTimeLine->SetSequenceEnd(CurrentSeqXmlFile->GetSequenceDurationMS());
+    if (mainSequencer != nullptr)
+    {
+        mainSequencer->PanelTimeLine->SetSequenceEnd(CurrentSeqXmlFile->GetSequenceDurationMS());
+    }
     mSequenceElements.SetSequenceEnd(CurrentSeqXmlFile->GetSequenceDurationMS());
 }
 
@@ -1193,6 +1193,16 @@ void FRAMECLASS WriteFalconPiFile(const wxString& filename)
         return;
     }
 
+    if (_compressedFSEQ)
+    {
+        if (!FileConverter::WriteFSEQV2File(f, SeqData, mediaFilename))
+        {
+            ConversionError(wxString("Unable to write file: ") + filename);
+        }
+        f.Close();
+        return;
+    }
+
     wxUint8* buf;
     buf = (wxUint8 *)calloc(sizeof(wxUint8), stepSize < 1024 ? 1024 : stepSize);
 
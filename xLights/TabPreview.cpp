@@ -11,12 +11,18 @@
 
 void xLightsFrame::UpdatePreview()
 {
-    layoutPanel->UpdatePreview();
+    if (layoutPanel != nullptr)
+    {
+        layoutPanel->UpdatePreview();
+    }
 }
 
 void xLightsFrame::RefreshLayout()
 {
-    layoutPanel->RefreshLayout();
+    if (layoutPanel != nullptr)
+    {
+        layoutPanel->RefreshLayout();
+    }
 }
 
 void xLightsFrame::ShowPreviewTime(long ElapsedMSec)
@@ -27,7 +33,10 @@ void xLightsFrame::ShowPreviewTime(long ElapsedMSec)
 void xLightsFrame::PreviewOutput(int period)
 {
     TimerOutput(period);
-    modelPreview->Render(&SeqData[period][0]);
+    if (modelPreview != nullptr)
+    {
+        modelPreview->Render(&SeqData[period][0]);
+    }
 }
 
 void xLightsFrame::SetStoredLayoutGroup(const std::string &group)
@@ -47,13 +56,20 @@ void xLightsFrame::SetPreviewBackgroundImage(const wxString &filename)
         SetXmlSetting("backgroundImage",mBackgroundImage);
         UnsavedRgbEffectsChanges=true;
     }
-    modelPreview->SetbackgroundImage(mBackgroundImage);
-    sPreview2->SetbackgroundImage(mBackgroundImage);
+    if (modelPreview != nullptr)
+    {
+        modelPreview->SetbackgroundImage(mBackgroundImage);
+    }
+    if (sPreview2 != nullptr)
+    {
+        sPreview2->SetbackgroundImage(mBackgroundImage);
+    }
     UpdatePreview();
 }
 
 const wxString & xLightsFrame::GetDefaultPreviewBackgroundImage()
 {
+    if (sPreview2 == nullptr) return mBackgroundImage;
     return sPreview2->GetBackgroundImage();
 }
 
@@ -64,13 +80,20 @@ void xLightsFrame::SetPreviewBackgroundBrightness(int i)
         SetXmlSetting("backgroundBrightness",wxString::Format("%d",mBackgroundBrightness));
         UnsavedRgbEffectsChanges=true;
     }
-    modelPreview->SetBackgroundBrightness(mBackgroundBrightness);
-    sPreview2->SetBackgroundBrightness(mBackgroundBrightness);
+    if (modelPreview != nullptr)
+    {
+        modelPreview->SetBackgroundBrightness(mBackgroundBrightness);
+    }
+    if (sPreview2 != nullptr)
+    {
+        sPreview2->SetBackgroundBrightness(mBackgroundBrightness);
+    }
     UpdatePreview();
 }
 
 bool xLightsFrame::GetDefaultPreviewBackgroundScaled()
 {
+    if (sPreview2 == nullptr) return mScaleBackgroundImage;
     return sPreview2->GetScaleBackgroundImage();
 }
 
@@ -80,11 +103,18 @@ void xLightsFrame::SetPreviewBackgroundScaled(bool scaled) {
         SetXmlSetting("scaleImage",wxString::Format("%d",scaled));
         UnsavedRgbEffectsChanges=true;
     }
-    modelPreview->SetScaleBackgroundImage(scaled);
-    sPreview2->SetScaleBackgroundImage(scaled);
+    if (modelPreview != nullptr)
+    {
+        modelPreview->SetScaleBackgroundImage(scaled);
+    }
+    if (sPreview2 != nullptr)
+    {
+        sPreview2->SetScaleBackgroundImage(scaled);
+    }
 }
 
 int xLightsFrame::GetDefaultPreviewBackgroundBrightness()
 {
+    if (sPreview2 == nullptr) return mBackgroundBrightness;
     return sPreview2->GetBackgroundBrightness();
 }
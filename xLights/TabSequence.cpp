@@ -2,6 +2,7 @@
 #include <wx/tokenzr.h>
 #include <wx/clipbrd.h>
 #include <wx/xml/xml.h>
+#include <wx/file.h>
 #include "xLightsMain.h"
 #include "heartbeat.h"
 
@@ -213,7 +214,10 @@ wxString xLightsFrame::LoadEffectsFileNoCheck()
 
     // Do this here as it may switch the background image
     LayoutGroups.clear();
-    layoutPanel->Reset();
+    if (layoutPanel != nullptr)
+    {
+        layoutPanel->Reset();
+    }
     AllModels.SetLayoutsNode(LayoutGroupsNode);  // provides easy access to layout names for the model class
     for(wxXmlNode* e=LayoutGroupsNode->GetChildren(); e!=nullptr; e=e->GetNext() )
     {
@@ -225,7 +229,10 @@ wxString xLightsFrame::LoadEffectsFileNoCheck()
                 LayoutGroup* grp = new LayoutGroup(grp_name.ToStdString(), this, e);
                 LayoutGroups.push_back(grp);
                 AddPreviewOption(grp);
-                layoutPanel->AddPreviewChoice(grp_name.ToStdString());
+                if (layoutPanel != nullptr)
+                {
+                    layoutPanel->AddPreviewChoice(grp_name.ToStdString());
+                }
                 if( grp_name.ToStdString() == mStoredLayoutGroup )
                 {
                     found_saved_preview = true;
@@ -239,10 +246,13 @@ wxString xLightsFrame::LoadEffectsFileNoCheck()
     mScaleBackgroundImage = wxAtoi(GetXmlSetting("scaleImage","0")) > 0;
     SetPreviewBackgroundScaled(mScaleBackgroundImage);
 
-    std::string group = layoutPanel->GetCurrentLayoutGroup();
-    if( group != "Default" && group != "All Models" && group != "Unassigned" ) {
-        modelPreview->SetBackgroundBrightness(layoutPanel->GetBackgroundBrightnessForSelectedPreview());
-        modelPreview->SetScaleBackgroundImage(layoutPanel->GetBackgroundScaledForSelectedPreview());
+    if (layoutPanel != nullptr)
+    {
+        std::string group = layoutPanel->GetCurrentLayoutGroup();
+        if( group != "Default" && group != "All Models" && group != "Unassigned" ) {
+            modelPreview->SetBackgroundBrightness(layoutPanel->GetBackgroundBrightnessForSelectedPreview());
+            modelPreview->SetScaleBackgroundImage(layoutPanel->GetBackgroundScaledForSelectedPreview());
+        }
     }
 
     return effectsFile.GetFullPath();
@@ -560,11 +570,14 @@ void xLightsFrame::UpdateModelsList()
 
     playModel = nullptr;
     PreviewModels.clear();
-    layoutPanel->GetMainPreview()->GetModels().clear();
+    if (layoutPanel != nullptr)
+    {
+        layoutPanel->GetMainPreview()->GetModels().clear();
+    }
 
     AllModels.LoadModels(ModelsNode,
-                         modelPreview->GetVirtualCanvasWidth(),
-                         modelPreview->GetVirtualCanvasHeight());
+                         _previewSize.GetWidth(),
+                         _previewSize.GetHeight());
 
     std::vector<std::string> current;
     for (auto it = AllModels.begin(); it != AllModels.end(); it++) {
@@ -616,8 +629,8 @@ void xLightsFrame::UpdateModelsList()
                                             }
                                         }
                                         AllModels.LoadModels(ModelsNode,
-                                                             modelPreview->GetVirtualCanvasWidth(),
-                                                             modelPreview->GetVirtualCanvasHeight());
+                                                             _previewSize.GetWidth(),
+                                                             _previewSize.GetHeight());
                                     }
                                 }
                             }
@@ -647,8 +660,8 @@ void xLightsFrame::UpdateModelsList()
         }
     }
     AllModels.LoadGroups(ModelGroupsNode,
-                         modelPreview->GetVirtualCanvasWidth(),
-                         modelPreview->GetVirtualCanvasHeight());
+                         _previewSize.GetWidth(),
+                         _previewSize.GetHeight());
 
     wxString msg;
 
@@ -673,12 +686,18 @@ void xLightsFrame::UpdateModelsList()
         }
     }
 
-    layoutPanel->UpdateModelList(true);
+    if (layoutPanel != nullptr)
+    {
+        layoutPanel->UpdateModelList(true);
+    }
 }
 
 void xLightsFrame::OpenRenderAndSaveSequences(const wxArrayString &origFilenames) {
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
     if (origFilenames.IsEmpty()) {
+        if (_renderTimingsFile != "") {
+            WriteRenderTimings();
+        }
         EnableSequenceControls(true);
         printf("Done All Files\n");
         Destroy();
@@ -699,14 +718,16 @@ void xLightsFrame::OpenRenderAndSaveSequences(const wxArrayString &origFilenames
     ProgressBar->Show();
     GaugeSizer->Layout();
     logger_base.info("Rendering on save.");
+    _renderProfiler.Start();
     RenderIseqData(true, NULL); // render ISEQ layers below the Nutcracker layer
     logger_base.info("   iseq below effects done.");
     ProgressBar->SetValue(10);
-    RenderGridToSeqData([this, sw, fileNames] {
+    RenderGridToSeqData([this, sw, fileNames, seq] {
         static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
         logger_base.info("   Effects done.");
         ProgressBar->SetValue(90);
         RenderIseqData(false, NULL);  // render ISEQ layers above the Nutcracker layer
+        _renderProfiler.Stop();
         logger_base.info("   iseq above effects done. Render complete.");
         ProgressBar->SetValue(100);
         ProgressBar->Hide();
@@ -720,6 +741,9 @@ void xLightsFrame::OpenRenderAndSaveSequences(const wxArrayString &origFilenames
         float elapsedTime = sw.Time()/1000.0; // now stop stopwatch timer and get elapsed time. change into seconds from ms
         wxString displayBuff = wxString::Format(_("%s     Updated in %7.3f seconds"),xlightsFilename,elapsedTime);
         logger_base.info("%s", (const char *) displayBuff.c_str());
+        if (_renderTimingsFile != "") {
+            _renderTimings.push_back(_renderProfiler.AsJSON(seq.ToStdString(), (long long)sw.Time() * 1000));
+        }
         CallAfter(&xLightsFrame::SetStatusText, displayBuff, 0);
         mSavedChangeCount = mSequenceElements.GetChangeCount();
         mLastAutosaveCount = mSavedChangeCount;
@@ -727,6 +751,26 @@ void xLightsFrame::OpenRenderAndSaveSequences(const wxArrayString &origFilenames
         CallAfter(&xLightsFrame::OpenRenderAndSaveSequences, fileNames);
     } );
 }
+void xLightsFrame::WriteRenderTimings() {
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    wxFile f;
+    if (!f.Create(_renderTimingsFile, true) || !f.IsOpened()) {
+        logger_base.error("Unable to create render timings file %s.", (const char *)_renderTimingsFile.c_str());
+        return;
+    }
+    std::string json = "[\n";
+    for (auto it = _renderTimings.begin(); it != _renderTimings.end(); ++it) {
+        if (it != _renderTimings.begin()) {
+            json += ",\n";
+        }
+        json += *it;
+    }
+    json += "\n]\n";
+    f.Write(json.c_str(), json.size());
+    f.Close();
+    logger_base.info("Render timings written to %s.", (const char *)_renderTimingsFile.c_str());
+}
 void xLightsFrame::SaveSequence()
 {
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
@@ -797,6 +841,7 @@ void xLightsFrame::SaveSequence()
         ProgressBar->Show();
         GaugeSizer->Layout();
         logger_base.info("Rendering on save.");
+        _renderProfiler.Start();
         RenderIseqData(true, NULL); // render ISEQ layers below the Nutcracker layer
         logger_base.info("   iseq below effects done.");
         ProgressBar->SetValue(10);
@@ -805,6 +850,7 @@ void xLightsFrame::SaveSequence()
             logger_base.info("   Effects done.");
             ProgressBar->SetValue(90);
             RenderIseqData(false, NULL);  // render ISEQ layers above the Nutcracker layer
+            _renderProfiler.Stop();
             logger_base.info("   iseq above effects done. Render complete.");
             ProgressBar->SetValue(100);
             ProgressBar->Hide();
@@ -901,6 +947,7 @@ void xLightsFrame::RenderAll()
     GaugeSizer->Layout();
     SetStatusText(_("Rendering all layers"));
     logger_base.debug("Rendering all.");
+    _renderProfiler.Start();
     RenderIseqData(true, nullptr); // render ISEQ layers below the Nutcracker layer
     logger_base.info("   iseq below effects done.");
     ProgressBar->SetValue(10);
@@ -909,6 +956,7 @@ void xLightsFrame::RenderAll()
         logger_base.info("   Effects done.");
         ProgressBar->SetValue(90);
         RenderIseqData(false, nullptr);  // render ISEQ layers above the Nutcracker layer
+        _renderProfiler.Stop();
         logger_base.info("   iseq above effects done. Render all complete.");
         ProgressBar->SetValue(100);
         float elapsedTime = sw.Time()/1000.0; // now stop stopwatch timer and get elapsed time. change into seconds from ms
@@ -97,7 +97,7 @@ bool xLightsFrame::SetDir(const wxString& newdir)
     }
     PreviewWindows.clear();
 
-    if (newdir != CurrentDir && "" != CurrentDir) {
+    if (newdir != CurrentDir && "" != CurrentDir && mainSequencer != nullptr) {
         wxFileName kbf;
         kbf.AssignDir(CurrentDir);
         kbf.SetFullName("xlights_keybindings.xml");
@@ -280,13 +280,16 @@ bool xLightsFrame::SetDir(const wxString& newdir)
     UpdateNetworkList(false);
     LoadEffectsFile();
 
-    wxFileName kbf;
-    kbf.AssignDir(CurrentDir);
-    kbf.SetFullName("xlights_keybindings.xml");
-    mainSequencer->keyBindings.Load(kbf);
+    if (mainSequencer != nullptr)
+    {
+        wxFileName kbf;
+        kbf.AssignDir(CurrentDir);
+        kbf.SetFullName("xlights_keybindings.xml");
+        mainSequencer->keyBindings.Load(kbf);
+    }
 
     EnableSequenceControls(true);
-    layoutPanel->RefreshLayout();
+    RefreshLayout();
 
     Notebook1->ChangeSelection(SETUPTAB);
     SetStatusText("");
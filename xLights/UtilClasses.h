@@ -4,6 +4,7 @@
 #include <map>
 #include <string>
 #include <algorithm>
+#include <memory>
 
 
 class MapStringString: public std::map<std::string,std::string> {
@@ -175,17 +176,53 @@ private:
     static const std::string EMPTY_STRING;
 };
 
+class EffectParameterBlock;
+
 class SettingsMap: public MapStringString {
 public:
     SettingsMap(): MapStringString() {
     }
+    SettingsMap(const SettingsMap &m): MapStringString(m) {
+    }
+    SettingsMap &operator=(const SettingsMap &m) {
+        MapStringString::operator=(m);
+        _parameters.reset();
+        return *this;
+    }
     virtual ~SettingsMap() {}
 
+    // anything that can change a setting throws away the compiled parameters
+    using MapStringString::operator[];
+    std::string &operator[](const std::string &key) {
+        _parameters.reset();
+        return MapStringString::operator[](key);
+    }
+    std::string &operator[](const char *key) {
+        _parameters.reset();
+        return MapStringString::operator[](key);
+    }
+    void erase(const char *key) {
+        _parameters.reset();
+        MapStringString::erase(key);
+    }
+    void clear() {
+        _parameters.reset();
+        MapStringString::clear();
+    }
+    void Parse(const std::string &str) {
+        _parameters.reset();
+        MapStringString::Parse(str);
+    }
+
+    // built the first time an effect asks for a parameter after the settings change
+    EffectParameterBlock &GetParameterBlock() const;
+
     virtual void RemapKey(std::string &n, std::string &value) {
         RemapChangedSettingKey(n, value);
     }
 private:
     static void RemapChangedSettingKey(std::string &n,  std::string &value);
+    mutable std::shared_ptr<EffectParameterBlock> _parameters;
 };
 
 
@@ -351,6 +351,7 @@ void ValueCurve::RenderType()
         }
     }
     _values.sort();
+    Bake();
 }
 
 ValueCurve::ValueCurve(const std::string& id, float min, float max, const std::string type, float parameter1, float parameter2, float parameter3, float parameter4, bool wrap)
@@ -360,6 +361,7 @@ ValueCurve::ValueCurve(const std::string& id, float min, float max, const std::s
     _min = min;
     _max = max;
     _wrap = wrap;
+    _baked = false;
     _parameter1 = SafeParameter(1, parameter1);
     _parameter2 = SafeParameter(2, parameter2);
     _parameter3 = SafeParameter(3, parameter3);
@@ -390,6 +392,7 @@ void ValueCurve::SetDefault(float min, float max)
 
 ValueCurve::ValueCurve(const std::string& s)
 {
+    _baked = false;
     Deserialise(s);
 }
 
@@ -562,6 +565,71 @@ float ValueCurve::GetOutputValueAt(float offset)
 }
 
 float ValueCurve::GetValueAt(float offset)
+{
+    if (_bakedValues.size() > 0)
+    {
+        if (offset < 0.0f) offset = 0.0;
+        if (offset > 1.0f) offset = 1.0;
+
+        float pos = offset * VALUECURVE_BAKED_SIZE;
+        int i = std::min((int)pos, VALUECURVE_BAKED_SIZE - 1);
+        if (!_bakedExact[i])
+        {
+            return _bakedValues[i] + (_bakedValues[i + 1] - _bakedValues[i]) * (pos - i);
+        }
+    }
+
+    return GetExactValueAt(offset);
+}
+
+// Samples the curve into a table. Between points the curve is a straight line so the
+// table can only be wrong in the gaps which hold a point or where the line is clipped ... those always use the exact value.
+// Every other gap is checked against the exact value to be sure.
+void ValueCurve::Bake()
+{
+    _bakedValues.clear();
+    _bakedExact.clear();
+
+    if (!_baked || !_active || _values.size() < 2) return;
+
+    _bakedValues.resize(VALUECURVE_BAKED_SIZE + 1);
+    for (int i = 0; i <= VALUECURVE_BAKED_SIZE; i++)
+    {
+        _bakedValues[i] = GetExactValueAt((float)i / VALUECURVE_BAKED_SIZE);
+    }
+
+    _bakedExact.resize(VALUECURVE_BAKED_SIZE, false);
+    for (auto it = _values.begin(); it != _values.end(); ++it)
+    {
+        // a point on the edge of a gap can still step the value just after it so mark both sides
+        int i = (int)(it->x * VALUECURVE_BAKED_SIZE);
+        if (i > 0) _bakedExact[i - 1] = true;
+        if (i < VALUECURVE_BAKED_SIZE) _bakedExact[i] = true;
+    }
+
+    for (int i = 0; i < VALUECURVE_BAKED_SIZE; i++)
+    {
+        // values are clipped to 0-1 which puts a corner in the line wherever it is clipped
+        float v1 = _bakedValues[i];
+        float v2 = _bakedValues[i + 1];
+        if (v1 != v2 && (v1 == 0.0f || v1 == 1.0f || v2 == 0.0f || v2 == 1.0f))
+        {
+            _bakedExact[i] = true;
+        }
+
+        if (!_bakedExact[i])
+        {
+            float mid = ((float)i + 0.5f) / VALUECURVE_BAKED_SIZE;
+            float baked = (_bakedValues[i] + _bakedValues[i + 1]) / 2.0f;
+            if (std::abs(baked - GetExactValueAt(mid)) > VALUECURVE_BAKED_ERROR)
+            {
+                _bakedExact[i] = true;
+            }
+        }
+    }
+}
+
+float ValueCurve::GetExactValueAt(float offset)
 {
     float res = 0.0f;
 
@@ -647,6 +715,7 @@ void ValueCurve::DeletePoint(float offset)
             }
             it++;
         }
+        Bake();
     }
 }
 
@@ -676,6 +745,7 @@ void ValueCurve::RemoveExcessCustomPoints()
             it3++;
         }
     }
+    Bake();
 }
 
 void ValueCurve::SetValueAt(float offset, float value)
@@ -692,6 +762,7 @@ void ValueCurve::SetValueAt(float offset, float value)
     }
     _values.push_back(vcSortablePoint(offset, value, false));
     _values.sort();
+    Bake();
 }
 
 void ValueCurve::SetWrap(bool wrap) 
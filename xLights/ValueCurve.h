@@ -4,6 +4,12 @@
 #include <wx/position.h>
 #include <string>
 #include <list>
+#include <vector>
+
+// samples in a baked value curve
+#define VALUECURVE_BAKED_SIZE 1024
+// a baked value may differ from the exact value by at most this (values are 0-1)
+#define VALUECURVE_BAKED_ERROR 0.001f
 
 class vcSortablePoint
 {
@@ -71,14 +77,19 @@ class ValueCurve
     float _parameter4;
     bool _active;
     bool _wrap;
+    bool _baked;
+    std::vector<float> _bakedValues; // VALUECURVE_BAKED_SIZE + 1 samples ... empty if not baked
+    std::vector<bool> _bakedExact; // true for the samples gaps where a straight line is not close enough
 
     void RenderType();
+    void Bake();
+    float GetExactValueAt(float offset);
     void SetSerialisedValue(std::string k, std::string s);
     float SafeParameter(size_t p, float v);
     float Safe01(float v);
 
 public:
-    ValueCurve() { ValueCurve(""); };
+    ValueCurve() { _baked = false; ValueCurve(""); };
     ValueCurve(const std::string& serialised);
     ValueCurve(const std::string& id, float min, float max = 100.0f, const std::string type = "Flat", float parameter1 = 0.0f, float parameter2 = 0.0f, float parameter3 = 0.0f, float parameter4 = 0.0f, bool wrap = false);
     wxBitmap GetImage(int x, int y);
@@ -94,7 +105,10 @@ public:
     float GetOutputValueAt(float offset);
     void SetActive(bool a) { _active = a; RenderType(); }
     bool IsActive() { return IsOk() && _active; }
-    void ToggleActive() { _active = !_active; if (_active) RenderType(); }
+    void ToggleActive() { _active = !_active; if (_active) RenderType(); else Bake(); }
+    // baked curves are sampled into a table whenever they change so GetValueAt is a lookup
+    void SetBaked(bool baked) { _baked = baked; Bake(); }
+    bool IsBaked() const { return _bakedValues.size() > 0; }
     void SetValueAt(float offset, float value);
     void DeletePoint(float offset);
     bool IsSetPoint(float offset);
@@ -102,8 +102,8 @@ void BarsEffect::GetSpatialColor(xlColor& color, size_t colorIndex, float x, flo
 void BarsEffect::Render(Effect *effect, const SettingsMap &SettingsMap, RenderBuffer &buffer) {
 
     float offset = buffer.GetEffectTimeIntervalPosition();
-    int PaletteRepeat = GetValueCurveInt("Bars_BarCount", 1, SettingsMap, offset);
-    double cycles = GetValueCurveDouble("Bars_Cycles", 1.0, SettingsMap, offset);
+    int PaletteRepeat = GetValueCurveInt(PARAMETER_SLOT("Bars_BarCount"), 1, SettingsMap, offset);
+    double cycles = GetValueCurveDouble(PARAMETER_SLOT("Bars_Cycles"), 1.0, SettingsMap, offset);
 
     int Center = SettingsMap.GetInt("SLIDER_Bars_Center", 0);
     int Direction = GetDirection(SettingsMap["CHOICE_Bars_Direction"]);
@@ -70,9 +70,9 @@ void ButterflyEffect::SetDefaultParameters(Model *cls) {
 void ButterflyEffect::Render(Effect *effect, const SettingsMap &SettingsMap, RenderBuffer &buffer)
 {
     float oset = buffer.GetEffectTimeIntervalPosition();
-    int Chunks = GetValueCurveInt("Butterfly_Chunks", 1, SettingsMap, oset);
-    int Skip = GetValueCurveInt("Butterfly_Skip", 2, SettingsMap, oset);
-    int butterFlySpeed = GetValueCurveInt("Butterfly_Speed", 10, SettingsMap, oset);
+    int Chunks = GetValueCurveInt(PARAMETER_SLOT("Butterfly_Chunks"), 1, SettingsMap, oset);
+    int Skip = GetValueCurveInt(PARAMETER_SLOT("Butterfly_Skip"), 2, SettingsMap, oset);
+    int butterFlySpeed = GetValueCurveInt(PARAMETER_SLOT("Butterfly_Speed"), 10, SettingsMap, oset);
 
     int Style = SettingsMap.GetInt("SLIDER_Butterfly_Style", 1);
     int ColorScheme = GetButterflyColorScheme(SettingsMap["CHOICE_Butterfly_Colors"]);
@@ -155,9 +155,9 @@ void CirclesEffect::SetDefaultParameters(Model *cls) {
 void CirclesEffect::Render(Effect *effect, const SettingsMap &SettingsMap, RenderBuffer &buffer) {
  
     float oset = buffer.GetEffectTimeIntervalPosition();
-    int number = GetValueCurveInt("Circles_Count", 3, SettingsMap, oset);
-    int circleSpeed = GetValueCurveInt("Circles_Speed", 10, SettingsMap, oset);
-    int radius = GetValueCurveInt("Circles_Size", 5, SettingsMap, oset);
+    int number = GetValueCurveInt(PARAMETER_SLOT("Circles_Count"), 3, SettingsMap, oset);
+    int circleSpeed = GetValueCurveInt(PARAMETER_SLOT("Circles_Speed"), 10, SettingsMap, oset);
+    int radius = GetValueCurveInt(PARAMETER_SLOT("Circles_Size"), 5, SettingsMap, oset);
 
     bool plasma = SettingsMap.GetBool("CHECKBOX_Circles_Plasma", false);
     bool radial = SettingsMap.GetBool("CHECKBOX_Circles_Radial", false);
@@ -200,11 +200,11 @@ void CirclesEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Rende
             int colorIdx = 0;
             if (ii >= cache->numBalls || buffer.needToInit)
             {
-                start_x = rand() % (buffer.BufferWi);
-                start_y = rand() % (buffer.BufferHt);
+                start_x = buffer.rand() % (buffer.BufferWi);
+                start_y = buffer.rand() % (buffer.BufferHt);
                 colorIdx = ii%colorCnt;
-                angle = rand() % 2 ? rand() % 90 : -rand() % 90;
-                spd = rand() % 3 + 1;
+                angle = buffer.rand() % 2 ? buffer.rand() % 90 : -buffer.rand() % 90;
+                spd = buffer.rand() % 3 + 1;
             }
             else
             {
@@ -217,7 +217,7 @@ void CirclesEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Rende
             effectObjects[ii].Reset((float)start_x, (float)start_y, spd, angle, (float)radius, colorIdx);
             if (bubbles) //keep bubbles going mostly up
             {
-                angle = 90 + rand() % 45 - 22.5; //+/- 22.5 degrees from 90 degrees
+                angle = 90 + buffer.rand() % 45 - 22.5; //+/- 22.5 degrees from 90 degrees
                 angle *= 2 * M_PI / 180;
                 effectObjects[ii]._dx = spd * cos(angle);
                 effectObjects[ii]._dy = spd * sin(angle);
@@ -149,7 +149,7 @@ void ColorWashEffect::RemoveDefaults(const std::string &version, Effect *effect)
 void ColorWashEffect::Render(Effect *effect, const SettingsMap &SettingsMap, RenderBuffer &buffer) {
 
     float oset = buffer.GetEffectTimeIntervalPosition();
-    float cycles = GetValueCurveDouble("ColorWash_Cycles", 1.0, SettingsMap, oset);
+    float cycles = GetValueCurveDouble(PARAMETER_SLOT("ColorWash_Cycles"), 1.0, SettingsMap, oset);
 
     bool HorizFade = SettingsMap.GetBool(CHECKBOX_ColorWash_HFade);
     bool VertFade = SettingsMap.GetBool(CHECKBOX_ColorWash_VFade);
@@ -0,0 +1,155 @@
+#include "EffectParameterBlock.h"
+#include "../UtilClasses.h"
+#include "../ValueCurve.h"
+
+#include <map>
+#include <mutex>
+
+// slot numbers are shared by every block
+static std::mutex __slotLock;
+static std::map<std::string, int> __slots;
+static std::vector<std::string> __slotNames;
+
+static bool ParseInt(const std::string& s, int& value)
+{
+    if (s.length() == 0) return false;
+    try {
+        value = stoi(s);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+static bool ParseDouble(const std::string& s, double& value)
+{
+    if (s.length() == 0) return false;
+    try {
+        value = stod(s);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+EffectParameterBlock::EffectParameterBlock(const SettingsMap& settings) : _settings(settings)
+{
+}
+
+EffectParameterBlock::~EffectParameterBlock()
+{
+    for (auto it = _parameters.begin(); it != _parameters.end(); ++it)
+    {
+        if (it->curve != nullptr) delete it->curve;
+    }
+}
+
+int EffectParameterBlock::GetSlot(const std::string& name)
+{
+    std::unique_lock<std::mutex> lock(__slotLock);
+
+    auto it = __slots.find(name);
+    if (it != __slots.end()) return it->second;
+
+    int slot = __slotNames.size();
+    __slots[name] = slot;
+    __slotNames.push_back(name);
+    return slot;
+}
+
+EffectParameterBlock::Parameter& EffectParameterBlock::Compile(int slot)
+{
+    if (slot >= (int)_parameters.size())
+    {
+        _parameters.resize(slot + 1);
+    }
+
+    Parameter& p = _parameters[slot];
+    if (p.compiled) return p;
+
+    std::string name;
+    {
+        std::unique_lock<std::mutex> lock(__slotLock);
+        name = __slotNames[slot];
+    }
+
+    auto it = _settings.find("SLIDER_" + name);
+    if (it != _settings.end())
+    {
+        p.hasSlider = true;
+        p.sliderValid = ParseInt(it->second, p.sliderValue);
+    }
+
+    it = _settings.find("TEXTCTRL_" + name);
+    if (it != _settings.end())
+    {
+        p.hasText = true;
+        p.textIntValid = ParseInt(it->second, p.textIntValue);
+        p.textDoubleValid = ParseDouble(it->second, p.textDoubleValue);
+    }
+
+    it = _settings.find("VALUECURVE_" + name);
+    if (it != _settings.end() && it->second != "")
+    {
+        ValueCurve* vc = new ValueCurve(it->second);
+        if (vc->IsActive())
+        {
+            // it is read every frame for the life of the effect
+            vc->SetBaked(true);
+            p.curve = vc;
+        }
+        else
+        {
+            delete vc;
+        }
+    }
+
+    p.compiled = true;
+    return p;
+}
+
+int EffectParameterBlock::GetInt(int slot, int def, float offset)
+{
+    Parameter& p = Compile(slot);
+
+    int res = def;
+    if (p.hasSlider)
+    {
+        if (p.sliderValid) res = p.sliderValue;
+    }
+    else if (p.hasText)
+    {
+        if (p.textIntValid) res = p.textIntValue;
+    }
+
+    if (p.curve != nullptr)
+    {
+        res = p.curve->GetOutputValueAt(offset);
+    }
+
+    return res;
+}
+
+double EffectParameterBlock::GetDouble(int slot, double def, float offset)
+{
+    Parameter& p = Compile(slot);
+
+    double res = p.textDoubleValid ? p.textDoubleValue : def;
+
+    if (p.curve != nullptr)
+    {
+        res = p.curve->GetOutputValueAt(offset);
+    }
+
+    return res;
+}
+
+// lives here so UtilClasses.h does not need to know about value curves
+EffectParameterBlock& SettingsMap::GetParameterBlock() const
+{
+    if (_parameters == nullptr)
+    {
+        _parameters.reset(new EffectParameterBlock(*this));
+    }
+    return *_parameters;
+}
@@ -0,0 +1,55 @@
+#ifndef EFFECTPARAMETERBLOCK_H
+#define EFFECTPARAMETERBLOCK_H
+
+#include <string>
+#include <vector>
+
+class SettingsMap;
+class ValueCurve;
+
+// Gets the slot for a parameter name once per call site ... after the first call it is just a static int
+#define PARAMETER_SLOT(name) ([]() { static const int slot = EffectParameterBlock::GetSlot(name); return slot; }())
+
+// The slider, text and value curve settings an effect reads every frame parsed once
+// when the settings map is filled rather than on every frame.
+// Each parameter name is given a slot number that is the same for every block so a
+// lookup is just an index.
+// A block belongs to one SettingsMap and is thrown away whenever the map changes.
+class EffectParameterBlock
+{
+    struct Parameter
+    {
+        bool compiled;
+        bool hasSlider;
+        bool sliderValid;
+        int sliderValue;
+        bool hasText;
+        bool textIntValid;
+        int textIntValue;
+        bool textDoubleValid;
+        double textDoubleValue;
+        ValueCurve* curve; // only set if there is an active value curve ... owned by the block
+
+        Parameter() : compiled(false), hasSlider(false), sliderValid(false), sliderValue(0), hasText(false),
+            textIntValid(false), textIntValue(0), textDoubleValid(false), textDoubleValue(0.0), curve(nullptr) {}
+    };
+
+    const SettingsMap& _settings;
+    std::vector<Parameter> _parameters;
+
+    Parameter& Compile(int slot);
+
+public:
+
+    EffectParameterBlock(const SettingsMap& settings);
+    ~EffectParameterBlock();
+
+    // thread safe ... but takes a lock so use PARAMETER_SLOT where the name is fixed
+    static int GetSlot(const std::string& name);
+
+    // these match RenderableEffect::GetValueCurveInt/Double
+    int GetInt(int slot, int def, float offset);
+    double GetDouble(int slot, double def, float offset);
+};
+
+#endif
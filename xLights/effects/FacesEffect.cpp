@@ -392,7 +392,7 @@ void FacesEffect::drawline1(RenderBuffer &buffer, int Phoneme, int x1,int x2,int
     size_t colorcnt=buffer.GetColorCount();
 
 
-    ColorIdx=rand() % colorcnt; // Select random numbers from 0 up to number of colors the user has checked. 0-5 if 6 boxes checked
+    ColorIdx=buffer.rand() % colorcnt; // Select random numbers from 0 up to number of colors the user has checked. 0-5 if 6 boxes checked
     buffer.palette.GetHSV(ColorIdx, hsv); // Now go and get the hsv value for this ColorIdx
     hsv.hue = (float)Phoneme/10.0;
     //int ch=FindChannelAtXY( x,  y,'A');
@@ -421,7 +421,7 @@ void FacesEffect::drawline3(RenderBuffer &buffer, int Phoneme, int x1,int x2,int
     size_t colorcnt=buffer.GetColorCount();
 
 
-    ColorIdx=rand() % colorcnt; // Select random numbers from 0 up to number of colors the user has checked. 0-5 if 6 boxes checked
+    ColorIdx=buffer.rand() % colorcnt; // Select random numbers from 0 up to number of colors the user has checked. 0-5 if 6 boxes checked
     buffer.palette.GetHSV(ColorIdx, hsv);
     hsv.hue = (float)Phoneme/10.0;
     hsv.value=1.0;
@@ -478,7 +478,7 @@ void FacesEffect::drawoutline(RenderBuffer &buffer, int Phoneme, bool outline, c
     Wt = BufferWi-1;
 
 
-    ColorIdx=rand() % colorcnt; // Select random numbers from 0 up to number of colors the user has checked. 0-5 if 6 boxes checked
+    ColorIdx=buffer.rand() % colorcnt; // Select random numbers from 0 up to number of colors the user has checked. 0-5 if 6 boxes checked
     buffer.palette.GetHSV(ColorIdx, hsv);
     hsv.hue = 0.0;
     hsv.saturation = 1.0;
@@ -790,7 +790,7 @@ void FacesEffect::RenderFaces(RenderBuffer &buffer,
             if ("Auto" == eyes) {
                 if ((buffer.curPeriod * buffer.frameTimeInMs) >= cache->nextBlinkTime) {
                     //roughly every 5 seconds we'll blink
-                    cache->nextBlinkTime += (4500 + (rand() % 1000));
+                    cache->nextBlinkTime += (4500 + (buffer.rand() % 1000));
                     cache->blinkEndTime = buffer.curPeriod * buffer.frameTimeInMs + 101; //100ms blink
                     eyes = "Closed";
                 } else if ((buffer.curPeriod * buffer.frameTimeInMs) < cache->blinkEndTime) {
@@ -833,7 +833,7 @@ void FacesEffect::RenderFaces(RenderBuffer &buffer,
                 if ((buffer.curPeriod * buffer.frameTimeInMs) >= cache->nextBlinkTime) {
                     if ((startms + 150) >= (buffer.curPeriod * buffer.frameTimeInMs)) {
                         //don't want to blink RIGHT at the start of the rest, delay a little bie
-                        int tmp =  (buffer.curPeriod * buffer.frameTimeInMs) + 150 + rand() % 400;
+                        int tmp =  (buffer.curPeriod * buffer.frameTimeInMs) + 150 + buffer.rand() % 400;
 
                         //also don't want it right at the end
                         if ((tmp + 130) > endms) {
@@ -843,7 +843,7 @@ void FacesEffect::RenderFaces(RenderBuffer &buffer,
                         }
                     } else {
                         //roughly every 5 seconds we'll blink
-                        cache->nextBlinkTime += (4500 + (rand() % 1000));
+                        cache->nextBlinkTime += (4500 + (buffer.rand() % 1000));
                         cache->blinkEndTime = buffer.curPeriod * buffer.frameTimeInMs + 101; //100ms blink
                         eyes = "Closed";
                     }
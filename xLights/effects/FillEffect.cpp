@@ -152,12 +152,12 @@ static inline int GetDirection(const std::string & DirectionString) {
 void FillEffect::Render(Effect *effect, const SettingsMap &SettingsMap, RenderBuffer &buffer) {
 
     double eff_pos = buffer.GetEffectTimeIntervalPosition();
-    int position = GetValueCurveInt("Fill_Position", 100, SettingsMap, eff_pos);
+    int position = GetValueCurveInt(PARAMETER_SLOT("Fill_Position"), 100, SettingsMap, eff_pos);
     double pos_pct = (double)position / 100.0;
     int Direction = GetDirection(SettingsMap["CHOICE_Fill_Direction"]);
-    int BandSize = GetValueCurveInt("Fill_Band_Size", 0, SettingsMap, eff_pos);
-    int SkipSize = GetValueCurveInt("Fill_Skip_Size", 0, SettingsMap, eff_pos);
-    int offset = GetValueCurveInt("Fill_Offset", 0, SettingsMap, eff_pos);
+    int BandSize = GetValueCurveInt(PARAMETER_SLOT("Fill_Band_Size"), 0, SettingsMap, eff_pos);
+    int SkipSize = GetValueCurveInt(PARAMETER_SLOT("Fill_Skip_Size"), 0, SettingsMap, eff_pos);
+    int offset = GetValueCurveInt(PARAMETER_SLOT("Fill_Offset"), 0, SettingsMap, eff_pos);
     int offset_in_pixels = SettingsMap.GetBool("CHECKBOX_Fill_Offset_In_Pixels", true);
     int color_by_time = SettingsMap.GetBool("CHECKBOX_Fill_Color_Time", false);
     int wrap = SettingsMap.GetBool("CHECKBOX_Fill_Wrap", true);
@@ -161,9 +161,9 @@ void FireEffect::SetDefaultParameters(Model *cls) {
 void FireEffect::Render(Effect *effect, const SettingsMap &SettingsMap, RenderBuffer &buffer) {
 
     float offset = buffer.GetEffectTimeIntervalPosition();
-    int HeightPct = GetValueCurveInt("Fire_Height", 50, SettingsMap, offset);
-    int HueShift = GetValueCurveInt("Fire_HueShift", 0, SettingsMap, offset);
-    float cycles = GetValueCurveDouble("Fire_GrowthCycles", 0.0f, SettingsMap, offset);
+    int HeightPct = GetValueCurveInt(PARAMETER_SLOT("Fire_Height"), 50, SettingsMap, offset);
+    int HueShift = GetValueCurveInt(PARAMETER_SLOT("Fire_HueShift"), 0, SettingsMap, offset);
+    float cycles = GetValueCurveDouble(PARAMETER_SLOT("Fire_GrowthCycles"), 0.0f, SettingsMap, offset);
     bool withMusic = SettingsMap.GetBool("CHECKBOX_Fire_GrowWithMusic", false);
 
     int x,y,r,v1,v2,v3,v4,n,new_index;
@@ -176,7 +176,7 @@ void FireEffect::Render(Effect *effect, const SettingsMap &SettingsMap, RenderBu
         if (buffer.GetMedia() != NULL)
         {
             float f = 0.0;
-            std::list<float>* pf = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
+            const FrameDataSpan* pf = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
             if (pf != NULL)
             {
                 f = *pf->begin();
@@ -219,7 +219,7 @@ void FireEffect::Render(Effect *effect, const SettingsMap &SettingsMap, RenderBu
     }
     // build fire
     for (x=0; x<maxWi; x++) {
-        r=x%2==0 ? 190+(rand() % 10) : 100+(rand() % 50);
+        r=x%2==0 ? 190+(buffer.rand() % 10) : 100+(buffer.rand() % 50);
         SetFireBuffer(x,0,r, cache->FireBuffer, maxWi, maxHt);
     }
     int step=255*100/maxHt/HeightPct;
@@ -257,7 +257,7 @@ void FireEffect::Render(Effect *effect, const SettingsMap &SettingsMap, RenderBu
             new_index=n > 0 ? sum / n : 0;
             if (new_index > 0)
             {
-                new_index+=(rand() % 100 < 20) ? step : -step;
+                new_index+=(buffer.rand() % 100 < 20) ? step : -step;
                 if (new_index < 0) new_index=0;
                 if (new_index >= FirePalette.size()) new_index = FirePalette.size()-1;
             }
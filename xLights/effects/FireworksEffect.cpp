@@ -80,15 +80,15 @@ public:
         _bActive = false;
     }
 
-    void Reset(int x, int y, bool active, float velocity, int colorindex, int start)
+    void Reset(int x, int y, bool active, float velocity, int colorindex, int start, RenderRandom &rng)
     {
         _x       = x;
         orig_x = x;
         _y       = y;
         orig_y = y;
-        vel      = (rand()-RAND_MAX/2)*velocity/(RAND_MAX/2);
+        vel      = (rng.Next()-RenderRandom::MAX_VALUE/2)*velocity/(RenderRandom::MAX_VALUE/2);
         orig_vel = vel;
-        angle    = 2*M_PI*rand()/RAND_MAX;
+        angle    = 2*M_PI*rng.Next()/RenderRandom::MAX_VALUE;
         orig_angle = angle;
         _dx      = vel*cos(angle);
         orig_dx = _dx;
@@ -194,7 +194,7 @@ void FireworksEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Ren
     if (useMusic)
     {
         if (buffer.GetMedia() != nullptr) {
-            std::list<float>* pf = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
+            const FrameDataSpan* pf = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
             if (pf != nullptr)
             {
                 f = *pf->begin();
@@ -237,13 +237,13 @@ void FireworksEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Ren
             y75=(int)buffer.BufferHt*0.75;
             int startX;
             int startY;
-            if((x75-x25)>0) startX = x25 + rand()%(x75-x25); else startX=0;
-            if((y75-y25)>0) startY = y25 + rand()%(y75-y25); else startY=0;
+            if((x75-x25)>0) startX = x25 + buffer.rand()%(x75-x25); else startX=0;
+            if((y75-y25)>0) startY = y25 + buffer.rand()%(y75-y25); else startY=0;
             
             // Create a new burst
-            ColorIdx=rand() % colorcnt; // Select random numbers from 0 up to number of colors the user has checked. 0-5 if 6 boxes checked
+            ColorIdx=buffer.rand() % colorcnt; // Select random numbers from 0 up to number of colors the user has checked. 0-5 if 6 boxes checked
             for(int i=0; i<Count; i++) {
-                cache->fireworkBursts[x * Count + i].Reset(startX, startY, false, Velocity, ColorIdx, start);
+                cache->fireworkBursts[x * Count + i].Reset(startX, startY, false, Velocity, ColorIdx, start, buffer.rng);
             }
         }
 
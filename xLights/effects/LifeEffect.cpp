@@ -95,8 +95,8 @@ void LifeEffect::Render(Effect *effect, const SettingsMap &SettingsMap, RenderBu
         buffer.ClearTempBuf();
         for(i=0; i<Count; i++)
         {
-            x=rand() % BufferWi;
-            y=rand() % BufferHt;
+            x=buffer.rand() % BufferWi;
+            y=buffer.rand() % BufferHt;
             buffer.GetMultiColorBlend(buffer.rand01(),false,color);
             buffer.SetTempPixel(x,y,color);
         }
@@ -53,11 +53,11 @@ void LightningEffect::SetDefaultParameters(Model *cls) {
 
 void LightningEffect::Render(Effect *effect, const SettingsMap &SettingsMap, RenderBuffer &buffer) {
     float oset = buffer.GetEffectTimeIntervalPosition();
-    int Number_Bolts = GetValueCurveInt("Number_Bolts", 10, SettingsMap, oset);
-    int Number_Segments = GetValueCurveInt("Number_Segments", 5, SettingsMap, oset);
+    int Number_Bolts = GetValueCurveInt(PARAMETER_SLOT("Number_Bolts"), 10, SettingsMap, oset);
+    int Number_Segments = GetValueCurveInt(PARAMETER_SLOT("Number_Segments"), 5, SettingsMap, oset);
     bool ForkedLightning = SettingsMap.GetBool("CHECKBOX_ForkedLightning", false);
-    int topX = GetValueCurveInt("Lightning_TopX", 0, SettingsMap, oset);
-    int topY = GetValueCurveInt("Lightning_TopY", 0, SettingsMap, oset);
+    int topX = GetValueCurveInt(PARAMETER_SLOT("Lightning_TopX"), 0, SettingsMap, oset);
+    int topY = GetValueCurveInt(PARAMETER_SLOT("Lightning_TopY"), 0, SettingsMap, oset);
     int botX = SettingsMap.GetInt("SLIDER_Lightning_BOTX", 0);
     int botY = SettingsMap.GetInt("SLIDER_Lightning_BOTY", 0);
     
@@ -100,15 +100,15 @@ void LightningEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Ren
     for(i=0; i<=segment; i++) {
         //0  x2=bolt[i].x1;
         //  y2=bolt[i].y1;
-        j=rand()+1;
+        j=buffer.rand()+1;
         if(DIRECTION==UP || DIRECTION==DOWN) {
             if(i%2==0) { // Every even segment will alternate direction
-                if(rand()%2==0) // target x is to the left
+                if(buffer.rand()%2==0) // target x is to the left
                     x2 = xc + topX - (j%Number_Segments);
                 else // but randomely we reverse direction, also make it a larger jag
                     x2 = xc + topX + (2*j%Number_Segments);
             } else { // odd segments will
-                if(rand()%2==0) // move to the right
+                if(buffer.rand()%2==0) // move to the right
                     x2 = xc + topX + (j%Number_Segments);
                 else // but sometimes move 3 units to left.
                     x2 = xc + topX - (3*j%Number_Segments);
@@ -125,16 +125,16 @@ void LightningEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Ren
             if(i>(segment/2)) {
                 
                 if(i%2==1) {
-                    if(rand()%2==1)
+                    if(buffer.rand()%2==1)
                         x3 = xc + topX - (j%Number_Segments);
                     else  x3 = xc + topX + (2*j%Number_Segments);
                 } else {
-                    if(rand()%2==1)
+                    if(buffer.rand()%2==1)
                         x3 = xc + topX + (j%Number_Segments);
                     else
                         x3 = xc + topX - (3*j%Number_Segments);
                 }
-                y3 = buffer.BufferHt-(i*StepSegment) - topY - rand()%5;
+                y3 = buffer.BufferHt-(i*StepSegment) - topY - buffer.rand()%5;
                 LightningDrawBolt(buffer, x1+xoffset,y1,x3+xoffset,y2,color,curState);
             }
         }
@@ -160,7 +160,7 @@ void MeteorsEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Rende
     {
         if (buffer.GetMedia() != NULL) {
             float f = 0.0;
-            std::list<float>* pf = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
+            const FrameDataSpan* pf = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
             if (pf != NULL)
             {
                 f = *pf->begin();
@@ -247,7 +247,7 @@ void MeteorsEffect::RenderMeteorsHorizontal(RenderBuffer &buffer, int ColorSchem
 
     for(int i=0; i<buffer.BufferHt; i++)
     {
-        if (rand() % 200 < Count) {
+        if (buffer.rand() % 200 < Count) {
             m.x=buffer.BufferWi - 1;
             m.y=i;
 
@@ -257,7 +257,7 @@ void MeteorsEffect::RenderMeteorsHorizontal(RenderBuffer &buffer, int ColorSchem
                     buffer.SetRangeColor(hsv0,hsv1,m.hsv);
                     break;
                 case 2:
-                    buffer.palette.GetHSV(rand()%colorcnt, m.hsv);
+                    buffer.palette.GetHSV(buffer.rand()%colorcnt, m.hsv);
                     break;
             }
             cache->meteors.push_back(m);
@@ -275,7 +275,7 @@ void MeteorsEffect::RenderMeteorsHorizontal(RenderBuffer &buffer, int ColorSchem
             switch (ColorScheme)
             {
                 case 0:
-                    hsv.hue=double(rand() % 1000) / 1000.0;
+                    hsv.hue=double(buffer.rand() % 1000) / 1000.0;
                     hsv.saturation=1.0;
                     hsv.value=1.0;
                     break;
@@ -356,7 +356,7 @@ void MeteorsEffect::RenderMeteorsVertical(RenderBuffer &buffer, int ColorScheme,
 
     for(int i=0; i<buffer.BufferWi; i++)
     {
-        if (rand() % 200 < Count) {
+        if (buffer.rand() % 200 < Count) {
             m.x=i;
             m.y=buffer.BufferHt - 1;
 
@@ -366,7 +366,7 @@ void MeteorsEffect::RenderMeteorsVertical(RenderBuffer &buffer, int ColorScheme,
                     buffer.SetRangeColor(hsv0,hsv1,m.hsv);
                     break;
                 case 2:
-                    buffer.palette.GetHSV(rand()%colorcnt, m.hsv);
+                    buffer.palette.GetHSV(buffer.rand()%colorcnt, m.hsv);
                     break;
             }
             cache->meteors.push_back(m);
@@ -384,7 +384,7 @@ void MeteorsEffect::RenderMeteorsVertical(RenderBuffer &buffer, int ColorScheme,
             switch (ColorScheme)
             {
                 case 0:
-                    hsv.hue=double(rand() % 1000) / 1000.0;
+                    hsv.hue=double(buffer.rand() % 1000) / 1000.0;
                     hsv.saturation=1.0;
                     hsv.value=1.0;
                     break;
@@ -440,11 +440,11 @@ void MeteorsEffect::RenderIcicleDrip(RenderBuffer &buffer, int ColorScheme, int
 
     for(int i=0; i<buffer.BufferWi; i++)
     {
-        if (rand() % 200 < Count) {
+        if (buffer.rand() % 200 < Count) {
             m.x=i;
             m.y=buffer.BufferHt - 1;
             //            m.h = TailLength;
-            m.h = (rand() % (2 * buffer.BufferHt))/3; //somewhat variable length -DJ
+            m.h = (buffer.rand() % (2 * buffer.BufferHt))/3; //somewhat variable length -DJ
 
             switch (ColorScheme)
             {
@@ -452,7 +452,7 @@ void MeteorsEffect::RenderIcicleDrip(RenderBuffer &buffer, int ColorScheme, int
                     buffer.SetRangeColor(hsv0,hsv1,m.hsv);
                     break;
                 case 2:
-                    buffer.palette.GetHSV(rand()%colorcnt, m.hsv);
+                    buffer.palette.GetHSV(buffer.rand()%colorcnt, m.hsv);
                     break;
             }
             cache->meteors.push_back(m);
@@ -486,7 +486,7 @@ void MeteorsEffect::RenderIcicleDrip(RenderBuffer &buffer, int ColorScheme, int
             switch (ColorScheme)
             {
                 case 0:
-                    hsv.hue=double(rand() % 1000) / 1000.0;
+                    hsv.hue=double(buffer.rand() % 1000) / 1000.0;
                     hsv.saturation=1.0;
                     hsv.value=1.0;
                     break;
@@ -569,11 +569,11 @@ void MeteorsEffect::RenderMeteorsImplode(RenderBuffer &buffer, int ColorScheme,
     m.cnt=1;
     for(int i=0; i<MinDimension; i++)
     {
-        if (rand() % 200 < Count) {
+        if (buffer.rand() % 200 < Count) {
             if (buffer.BufferHt==1) {
-                angle=double(rand() % 2) * M_PI;
+                angle=double(buffer.rand() % 2) * M_PI;
             } else if (buffer.BufferWi==1) {
-                angle=double(rand() % 2) * M_PI - (M_PI/2.0);
+                angle=double(buffer.rand() % 2) * M_PI - (M_PI/2.0);
             } else {
                 angle=buffer.rand01()*2.0*M_PI;
             }
@@ -590,7 +590,7 @@ void MeteorsEffect::RenderMeteorsImplode(RenderBuffer &buffer, int ColorScheme,
                     buffer.SetRangeColor(hsv0,hsv1,m.hsv);
                     break;
                 case 2:
-                    buffer.palette.GetHSV(rand()%colorcnt, m.hsv);
+                    buffer.palette.GetHSV(buffer.rand()%colorcnt, m.hsv);
                     break;
             }
             cache->meteorsRadial.push_back(m);
@@ -617,7 +617,7 @@ void MeteorsEffect::RenderMeteorsImplode(RenderBuffer &buffer, int ColorScheme,
             switch (ColorScheme)
             {
                 case 0:
-                    hsv.hue=double(rand() % 1000) / 1000.0;
+                    hsv.hue=double(buffer.rand() % 1000) / 1000.0;
                     hsv.saturation=1.0;
                     hsv.value=1.0;
                     break;
@@ -715,11 +715,11 @@ void MeteorsEffect::RenderMeteorsExplode(RenderBuffer &buffer, int ColorScheme,
     m.cnt=1;
     for(int i=0; i<MinDimension; i++)
     {
-        if (rand() % 200 < Count) {
+        if (buffer.rand() % 200 < Count) {
             if (buffer.BufferHt==1) {
-                angle=double(rand() % 2) * M_PI;
+                angle=double(buffer.rand() % 2) * M_PI;
             } else if (buffer.BufferWi==1) {
-                angle=double(rand() % 2) * M_PI - (M_PI/2.0);
+                angle=double(buffer.rand() % 2) * M_PI - (M_PI/2.0);
             } else {
                 angle=buffer.rand01()*2.0*M_PI;
             }
@@ -732,7 +732,7 @@ void MeteorsEffect::RenderMeteorsExplode(RenderBuffer &buffer, int ColorScheme,
                     buffer.SetRangeColor(hsv0,hsv1,m.hsv);
                     break;
                 case 2:
-                    buffer.palette.GetHSV(rand()%colorcnt, m.hsv);
+                    buffer.palette.GetHSV(buffer.rand()%colorcnt, m.hsv);
                     break;
             }
             cache->meteorsRadial.push_back(m);
@@ -760,7 +760,7 @@ void MeteorsEffect::RenderMeteorsExplode(RenderBuffer &buffer, int ColorScheme,
             switch (ColorScheme)
             {
                 case 0:
-                    hsv.hue=double(rand() % 1000) / 1000.0;
+                    hsv.hue=double(buffer.rand() % 1000) / 1000.0;
                     hsv.saturation=1.0;
                     hsv.value=1.0;
                     break;
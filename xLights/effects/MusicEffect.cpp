@@ -101,7 +101,7 @@ void MusicEffect::Render(Effect *effect, const SettingsMap &SettingsMap, RenderB
         SettingsMap.GetInt("SLIDER_Music_Sensitivity", 50),
         SettingsMap.GetBool("CHECKBOX_Music_Scale", false),
         std::string(SettingsMap.Get("CHOICE_Music_Scaling", "None")),
-        GetValueCurveInt("Music_Offset", 0, SettingsMap, oset),
+        GetValueCurveInt(PARAMETER_SLOT("Music_Offset"), 0, SettingsMap, oset),
         SettingsMap.GetInt("SLIDER_Music_StartNote", 60),
         SettingsMap.GetInt("SLIDER_Music_EndNote", 80),
         SettingsMap.Get("CHOICE_Music_Colour", "Distinct"),
@@ -343,7 +343,7 @@ void MusicEffect::CreateEvents(RenderBuffer& buffer, std::vector<std::list<Music
     // go through each frame and extract the data i need
     for (int f = buffer.curEffStartPer; f <= buffer.curEffEndPer; f++)
     {
-        std::list<float>* pdata = buffer.GetMedia()->GetFrameData(f, FRAMEDATATYPE::FRAMEDATA_VU, "");
+        const FrameDataSpan* pdata = buffer.GetMedia()->GetFrameData(f, FRAMEDATATYPE::FRAMEDATA_VU, "");
 
         if (pdata != nullptr)
         {
@@ -164,7 +164,7 @@ void OnEffect::Render(Effect *eff, const SettingsMap &SettingsMap, RenderBuffer
         color = hsv;
     }
     
-    int transparency = GetValueCurveInt("On_Transparency", 0, SettingsMap, adjust);
+    int transparency = GetValueCurveInt(PARAMETER_SLOT("On_Transparency"), 0, SettingsMap, adjust);
     if (transparency) {
         transparency *= 255;
         transparency /= 100;
@@ -55,14 +55,14 @@ void PinwheelEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Rend
     float oset = buffer.GetEffectTimeIntervalPosition();
 
     int pinwheel_arms = SettingsMap.GetInt("SLIDER_Pinwheel_Arms", 3);
-    int pinwheel_twist = GetValueCurveInt("Pinwheel_Twist", 0, SettingsMap, oset);
-    int pinwheel_thickness = GetValueCurveInt("Pinwheel_Thickness", 0, SettingsMap, oset);
+    int pinwheel_twist = GetValueCurveInt(PARAMETER_SLOT("Pinwheel_Twist"), 0, SettingsMap, oset);
+    int pinwheel_thickness = GetValueCurveInt(PARAMETER_SLOT("Pinwheel_Thickness"), 0, SettingsMap, oset);
     bool pinwheel_rotation = SettingsMap.GetBool("CHECKBOX_Pinwheel_Rotation");
     const std::string &pinwheel_3d = SettingsMap["CHOICE_Pinwheel_3D"];
-    int xc_adj = GetValueCurveInt("PinwheelXC", 0, SettingsMap, oset);
-    int yc_adj = GetValueCurveInt("PinwheelYC", 0, SettingsMap, oset);
-    int pinwheel_armsize = GetValueCurveInt("Pinwheel_ArmSize", 100, SettingsMap, oset);
-    int pspeed = GetValueCurveInt("Pinwheel_Speed", 10, SettingsMap, oset);
+    int xc_adj = GetValueCurveInt(PARAMETER_SLOT("PinwheelXC"), 0, SettingsMap, oset);
+    int yc_adj = GetValueCurveInt(PARAMETER_SLOT("PinwheelYC"), 0, SettingsMap, oset);
+    int pinwheel_armsize = GetValueCurveInt(PARAMETER_SLOT("Pinwheel_ArmSize"), 100, SettingsMap, oset);
+    int pspeed = GetValueCurveInt(PARAMETER_SLOT("Pinwheel_Speed"), 10, SettingsMap, oset);
     const std::string &pinwheel_style = SettingsMap["CHOICE_Pinwheel_Style"];
 
     int xc;
@@ -770,43 +770,20 @@ void RenderableEffect::SetRadioValue(wxRadioButton *r) {
 
 double RenderableEffect::GetValueCurveDouble(wxString name, double def, const SettingsMap &SettingsMap, float offset)
 {
-    double res = SettingsMap.GetDouble("TEXTCTRL_" + name, def);
-
-    wxString vc = SettingsMap.Get("VALUECURVE_" + name, "");
-    if (vc != "")
-    {
-        ValueCurve valc(vc.ToStdString());
-        if (valc.IsActive())
-        {
-            res = valc.GetOutputValueAt(offset);
-        }
-    }
-
-    return res;
+    return GetValueCurveDouble(EffectParameterBlock::GetSlot(name.ToStdString()), def, SettingsMap, offset);
 }
 int RenderableEffect::GetValueCurveInt(wxString name, int def, const SettingsMap &SettingsMap, float offset)
 {
-    int res = def;
-    if (SettingsMap.Contains("SLIDER_" + name))
-    {
-        res = SettingsMap.GetInt("SLIDER_" + name, def);
-    }
-    else if (SettingsMap.Contains("TEXTCTRL_" + name))
-    {
-        res = SettingsMap.GetInt("TEXTCTRL_" + name, def);
-    }
-
-    if (SettingsMap.Contains("VALUECURVE_" + name))
-    {
-        wxString vc = SettingsMap.Get("VALUECURVE_" + name, "");
-        ValueCurve valc(vc.ToStdString());
-        if (valc.IsActive())
-        {
-            res = valc.GetOutputValueAt(offset);
-        }
-    }
+    return GetValueCurveInt(EffectParameterBlock::GetSlot(name.ToStdString()), def, SettingsMap, offset);
+}
 
-    return res;
+double RenderableEffect::GetValueCurveDouble(int slot, double def, const SettingsMap &SettingsMap, float offset)
+{
+    return SettingsMap.GetParameterBlock().GetDouble(slot, def, offset);
+}
+int RenderableEffect::GetValueCurveInt(int slot, int def, const SettingsMap &SettingsMap, float offset)
+{
+    return SettingsMap.GetParameterBlock().GetInt(slot, def, offset);
 }
 
 
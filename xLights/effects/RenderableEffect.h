@@ -5,6 +5,7 @@
 #include <string>
 #include "../Color.h"
 #include "assist/AssistPanel.h"
+#include "EffectParameterBlock.h"
 
 class wxPanel;
 class wxWindow;
@@ -79,6 +80,9 @@ class RenderableEffect
 
         double GetValueCurveDouble(wxString name, double def, const SettingsMap &SettingsMap, float offset);
         int GetValueCurveInt(wxString name, int def, const SettingsMap &SettingsMap, float offset);
+        // slot comes from PARAMETER_SLOT("name") ... avoids building keys and parsing curves every frame
+        double GetValueCurveDouble(int slot, double def, const SettingsMap &SettingsMap, float offset);
+        int GetValueCurveInt(int slot, int def, const SettingsMap &SettingsMap, float offset);
         bool IsVersionOlder(const std::string& compare, const std::string& version);
         void AdjustSettingsToBeFitToTime(int effectIdx, SettingsMap &settings, int startMS, int endMS, xlColorVector &colors);
         virtual void RemoveDefaults(const std::string &version, Effect *effect);
@@ -95,12 +95,12 @@ void SingleStrandEffect::Render(Effect *effect, const SettingsMap &SettingsMap,
         float offset = (float)buffer.curPeriod / ((float)buffer.curEffEndPer - (float)buffer.curEffStartPer);
         RenderSingleStrandChase(buffer,
                                 SettingsMap.Get("CHOICE_SingleStrand_Colors", "Palette"),
-                                GetValueCurveInt("Number_Chases", 1, SettingsMap, offset),
-                                GetValueCurveInt("Color_Mix1", 10, SettingsMap, offset),
+                                GetValueCurveInt(PARAMETER_SLOT("Number_Chases"), 1, SettingsMap, offset),
+                                GetValueCurveInt(PARAMETER_SLOT("Color_Mix1"), 10, SettingsMap, offset),
                                 SettingsMap.Get("CHOICE_Chase_Type1", "Left-Right"),
                                 SettingsMap.GetBool("CHECKBOX_Chase_3dFade1", false),
                                 SettingsMap.GetBool("CHECKBOX_Chase_Group_All", false),
-                                GetValueCurveDouble("Chase_Rotations", 1.0, SettingsMap, offset)
+                                GetValueCurveDouble(PARAMETER_SLOT("Chase_Rotations"), 1.0, SettingsMap, offset)
                                 );
     }
 }
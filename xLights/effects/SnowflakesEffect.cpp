@@ -203,8 +203,8 @@ void SnowflakesEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Re
             // find unused space
             for (check=0; check < 20; check++)
             {
-                x=rand() % buffer.BufferWi;
-                y=y0 + (rand() % delta_y);
+                x=buffer.rand() % buffer.BufferWi;
+                y=y0 + (buffer.rand() % delta_y);
                 if (buffer.GetTempPixel(x,y) == xlBLACK) {
                     effectState++;
                     break;
@@ -212,7 +212,7 @@ void SnowflakesEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Re
             }
 
             // draw flake, SnowflakeType=0 is random type
-            switch (SnowflakeType == 0 ? rand() % 5 : SnowflakeType-1)
+            switch (SnowflakeType == 0 ? buffer.rand() % 5 : SnowflakeType-1)
             {
                 case 0:
                     // single node
@@ -253,7 +253,7 @@ void SnowflakesEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Re
                     else
                     {
                         buffer.SetTempPixel(x,y,c1);
-                        if (rand() % 100 > 50)      // % 2 was not so random
+                        if (buffer.rand() % 100 > 50)      // % 2 was not so random
                         {
                             buffer.SetTempPixel(x-1,y,c2);
                             buffer.SetTempPixel(x+1,y,c2);
@@ -351,7 +351,7 @@ void SnowflakesEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Re
                         // randomly move the flake left or right
                         if (moves > 0 || (falling == "Falling" && y == 0))
                         {
-                            switch(rand() % 5)
+                            switch(buffer.rand() % 5)
                             {
                                 case 0:
                                     if (moves & 1) {
@@ -390,7 +390,7 @@ void SnowflakesEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Re
                                         x0 = x - 1;
                                     }
                                     else {
-                                        switch(rand() % 2)
+                                        switch(buffer.rand() % 2)
                                         {
                                             case 0:
                                                 x0 = x+1;
@@ -461,10 +461,10 @@ void SnowflakesEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Re
         int placedFullCount = 0;
         while (effectState < Count && check < 20) {
             // find unused space
-            x=rand() % buffer.BufferWi;
+            x=buffer.rand() % buffer.BufferWi;
             if (buffer.GetTempPixel(x, buffer.BufferHt-1) == xlBLACK) {
                 effectState++;
-                buffer.SetTempPixel(x, buffer.BufferHt-1, color1, SnowflakeType == 0 ? rand() % 5 : SnowflakeType-1);
+                buffer.SetTempPixel(x, buffer.BufferHt-1, color1, SnowflakeType == 0 ? buffer.rand() % 5 : SnowflakeType-1);
 
                 int nextmoves = possible_downward_moves(buffer, x, buffer.BufferHt-1);
                 if (nextmoves == 0) {
@@ -518,7 +518,7 @@ void SnowflakesEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Re
                                 set_pixel_if_not_color(buffer, x+1, y, color2, color1, wrapx, false);
                             }
                             else {
-                                if (rand() % 100 > 50)      // % 2 was not so random
+                                if (buffer.rand() % 100 > 50)      // % 2 was not so random
                                 {
                                     set_pixel_if_not_color(buffer, x-1, y, color2, color1, wrapx, false);
                                     set_pixel_if_not_color(buffer, x+1, y, color2, color1, wrapx, false);
@@ -90,7 +90,7 @@ static void SnowstormAdvance(RenderBuffer &buffer, SnowstormClass& ssItem)
     const int arr[] = {30,20,10,5,0,5,10,20,20,15,10,10,10,10,10,15}; // 2 sets of 8 numbers, each of which add up to 100
     wxPoint adv = SnowstormVector(7);
     int i0 = ssItem.idx % 7 <= 4 ? 0 : cnt;
-    int r=rand() % 100;
+    int r=buffer.rand() % 100;
     for(int i=0, val=0; i < cnt; i++)
     {
         val+=arr[i0+i];
@@ -172,11 +172,11 @@ void SnowstormEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Ren
             ssItem.points.clear();
             buffer.SetRangeColor(hsv0,hsv1,ssItem.hsv);
             // start in a random state
-            r=rand() % (2*TailLength);
+            r=buffer.rand() % (2*TailLength);
             if (r > 0)
             {
-                xy.x=rand() % buffer.BufferWi;
-                xy.y=rand() % buffer.BufferHt;
+                xy.x=buffer.rand() % buffer.BufferWi;
+                xy.y=buffer.rand() % buffer.BufferHt;
                 ssItem.points.push_back(xy);
             }
             if (r >= TailLength)
@@ -204,18 +204,18 @@ void SnowstormEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Ren
                 it->points.clear();  // start over
                 it->ssDecay=0;
             }
-            else if (rand() % 20 < sSpeed)
+            else if (buffer.rand() % 20 < sSpeed)
             {
                 it->ssDecay++;
             }
         }
         if (it->points.empty())
         {
-            xy.x=rand() % buffer.BufferWi;
-            xy.y=rand() % buffer.BufferHt;
+            xy.x=buffer.rand() % buffer.BufferWi;
+            xy.y=buffer.rand() % buffer.BufferHt;
             it->points.push_back(xy);
         }
-        else if (rand() % 20 < sSpeed)
+        else if (buffer.rand() % 20 < sSpeed)
         {
             SnowstormAdvance(buffer, *it);
         }
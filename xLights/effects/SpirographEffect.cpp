@@ -51,12 +51,12 @@ void SpirographEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Re
 
     float oset = buffer.GetEffectTimeIntervalPosition();
 
-    int int_R   = GetValueCurveInt("Spirograph_R", 20, SettingsMap, oset);
-    int int_r   = GetValueCurveInt("Spirograph_r", 10, SettingsMap, oset);
-    int int_d   = GetValueCurveInt("Spirograph_d", 30, SettingsMap, oset);
-    int Animate = GetValueCurveInt("Spirograph_Animate", 0, SettingsMap, oset);
-    int sspeed  = GetValueCurveInt("Spirograph_Speed", 10, SettingsMap, oset);
-    int length  = GetValueCurveInt("Spirograph_Length", 20, SettingsMap, oset);
+    int int_R   = GetValueCurveInt(PARAMETER_SLOT("Spirograph_R"), 20, SettingsMap, oset);
+    int int_r   = GetValueCurveInt(PARAMETER_SLOT("Spirograph_r"), 10, SettingsMap, oset);
+    int int_d   = GetValueCurveInt(PARAMETER_SLOT("Spirograph_d"), 30, SettingsMap, oset);
+    int Animate = GetValueCurveInt(PARAMETER_SLOT("Spirograph_Animate"), 0, SettingsMap, oset);
+    int sspeed  = GetValueCurveInt(PARAMETER_SLOT("Spirograph_Speed"), 10, SettingsMap, oset);
+    int length  = GetValueCurveInt(PARAMETER_SLOT("Spirograph_Length"), 20, SettingsMap, oset);
 
     int i,x,y,xc,yc,ColorIdx;
     int mod1440,d_mod;
@@ -110,7 +110,7 @@ void SpirographEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Re
 
 
         buffer.palette.GetHSV(0, hsv0);
-        ColorIdx=(state+rand()) % colorcnt; // Select random numbers from 0 up to number of colors the user has checked. 0-5 if 6 boxes checked
+        ColorIdx=(state+buffer.rand()) % colorcnt; // Select random numbers from 0 up to number of colors the user has checked. 0-5 if 6 boxes checked
         buffer.palette.GetHSV(ColorIdx, hsv1); // Now go and get the hsv value for this ColorIdx
 
         buffer.SetPixel(x,y,hsv);
@@ -91,7 +91,7 @@ void StrobeEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Render
         if (buffer.GetMedia() != NULL)
         {
             float f = 0.0;
-            std::list<float>* pf = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
+            const FrameDataSpan* pf = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
             if (pf != NULL)
             {
                 f = *pf->begin();
@@ -123,11 +123,11 @@ void StrobeEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Render
         for (int i = 0; i < Number_Strobes * StrobeDuration; i++)
         {
             xlColor color;
-            ColorIdx = rand() % colorcnt;
+            ColorIdx = buffer.rand() % colorcnt;
             buffer.palette.GetHSV(ColorIdx, hsv); // take first checked color as color of flash
             buffer.palette.GetColor(ColorIdx, color); // take first checked color as color of flash
-            strobe.push_back(StrobeClass(rand() % buffer.BufferWi,
-                rand() % buffer.BufferHt, i % StrobeDuration, hsv, color));
+            strobe.push_back(StrobeClass(buffer.rand() % buffer.BufferWi,
+                buffer.rand() % buffer.BufferHt, i % StrobeDuration, hsv, color));
         }
     }
 
@@ -136,11 +136,11 @@ void StrobeEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Render
     {
         HSVValue hsv;
         xlColor color;
-        ColorIdx = rand() % colorcnt;
+        ColorIdx = buffer.rand() % colorcnt;
         buffer.palette.GetHSV(ColorIdx, hsv); // take first checked color as color of flash
         buffer.palette.GetColor(ColorIdx, color); // take first checked color as color of flash
-        strobe.push_back(StrobeClass(rand() % buffer.BufferWi,
-            rand() % buffer.BufferHt, StrobeDuration, hsv, color));
+        strobe.push_back(StrobeClass(buffer.rand() % buffer.BufferWi,
+            buffer.rand() % buffer.BufferHt, StrobeDuration, hsv, color));
     }
 
     // render strobe, we go through all storbes and decide if they should be turned on
@@ -177,7 +177,7 @@ void StrobeEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Render
 
         if (Strobe_Type == 2)
         {
-            int r = rand() % 2;
+            int r = buffer.rand() % 2;
             if (r == 0)
             {
                 buffer.SetPixel(x, y - 1, color);
@@ -199,7 +199,7 @@ void StrobeEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Render
         }
         if (Strobe_Type == 4)
         {
-            int r = rand() % 2;
+            int r = buffer.rand() % 2;
             if (r == 0)
             {
                 buffer.SetPixel(x, y - 1, color);
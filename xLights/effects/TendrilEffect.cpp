@@ -99,7 +99,7 @@ ATendril::~ATendril()
 	}
 }
 
-ATendril::ATendril(float friction, int size, float dampening, float tension, float spring, const wxPoint& start, size_t maxx, size_t maxy)
+ATendril::ATendril(float friction, int size, float dampening, float tension, float spring, const wxPoint& start, size_t maxx, size_t maxy, RenderRandom &rng)
 {
     _width = maxx;
     _height = maxy;
@@ -126,11 +126,11 @@ ATendril::ATendril(float friction, int size, float dampening, float tension, flo
 	_friction = 0.5f;
 	if (friction >= 0)
 	{
-		_friction = friction + ((float)rand())/(float)RAND_MAX * 0.01f - 0.005f;
+		_friction = friction + ((float)rng.Next())/(float)RenderRandom::MAX_VALUE * 0.01f - 0.005f;
 	}
 	else
 	{
-		_friction = _friction + ((float)rand())/(float)RAND_MAX * 0.01f - 0.005f;
+		_friction = _friction + ((float)rng.Next())/(float)RenderRandom::MAX_VALUE * 0.01f - 0.005f;
 	}
 
     _nodes.clear();
@@ -251,7 +251,7 @@ Tendril::~Tendril()
 	}
 }
 
-Tendril::Tendril(float friction, int trails, int size, float dampening, float tension, float springbase, float springincr, const wxPoint& start, size_t maxx, size_t maxy)
+Tendril::Tendril(float friction, int trails, int size, float dampening, float tension, float springbase, float springincr, const wxPoint& start, size_t maxx, size_t maxy, RenderRandom &rng)
 {
     _width = maxx;
     _height = maxy;
@@ -275,7 +275,7 @@ Tendril::Tendril(float friction, int trails, int size, float dampening, float te
 	for (int i = 0; i < t; i++)
 	{
 		float aspring = sb + si * ((float)i / (float)t);
-		ATendril* t = new ATendril(friction, size, dampening, tension, aspring, start, maxx, maxy);
+		ATendril* t = new ATendril(friction, size, dampening, tension, aspring, start, maxx, maxy, rng);
 		if (t != NULL)
 		{
 			_tendrils.push_back(t);
@@ -283,7 +283,7 @@ Tendril::Tendril(float friction, int trails, int size, float dampening, float te
 	}
 }
 
-void Tendril::UpdateRandomMove(int tunemovement)
+void Tendril::UpdateRandomMove(int tunemovement, RenderRandom &rng)
 {
     if (tunemovement < 1)
     {
@@ -332,12 +332,12 @@ void Tendril::UpdateRandomMove(int tunemovement)
 			int x = 0;
 			if (xmove > 0)
 			{
-				x = (rand() % xmove) + realminmovex;
+				x = (rng.Next() % xmove) + realminmovex;
 			}
 			int y = 0;
 			if (ymove > 0)
 			{
-				y = (rand() % ymove) + realminmovey;
+				y = (rng.Next() % ymove) + realminmovey;
 			}
 
 			current->x = current->x + x;
@@ -443,18 +443,18 @@ void TendrilEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Rende
     float oset = buffer.GetEffectTimeIntervalPosition();
     Render(buffer,
         SettingsMap.Get("CHOICE_Tendril_Movement", "Random"),
-        GetValueCurveInt("Tendril_TuneMovement", 10, SettingsMap, oset),
+        GetValueCurveInt(PARAMETER_SLOT("Tendril_TuneMovement"), 10, SettingsMap, oset),
         SettingsMap.GetInt("TEXTCTRL_Tendril_Speed", 10),
-        GetValueCurveInt("Tendril_Thickness", 1, SettingsMap, oset),
+        GetValueCurveInt(PARAMETER_SLOT("Tendril_Thickness"), 1, SettingsMap, oset),
         SettingsMap.GetFloat("TEXTCTRL_Tendril_Friction", 10) / 20 * 0.2 + 0.4, // 0.4->0.6 but on screen 0-20: def 0.5
         SettingsMap.GetFloat("TEXTCTRL_Tendril_Dampening", 10) / 20 * 0.5, // 0->0.5 but on screen 0-20: def 0.25
         SettingsMap.GetFloat("TEXTCTRL_Tendril_Tension", 20) / 39 * 0.039 + 0.96, // 0.960->0.999 but on screen 0->39: def 0.980
         SettingsMap.GetInt("TEXTCTRL_Tendril_Trails", 1),
         SettingsMap.GetInt("TEXTCTRL_Tendril_Length", 60),
-        GetValueCurveInt("Tendril_XOffset", 0, SettingsMap, oset),
-        GetValueCurveInt("Tendril_YOffset", 0, SettingsMap, oset),
-        GetValueCurveInt("Tendril_ManualX", 0, SettingsMap, oset),
-        GetValueCurveInt("Tendril_ManualY", 0, SettingsMap, oset)
+        GetValueCurveInt(PARAMETER_SLOT("Tendril_XOffset"), 0, SettingsMap, oset),
+        GetValueCurveInt(PARAMETER_SLOT("Tendril_YOffset"), 0, SettingsMap, oset),
+        GetValueCurveInt(PARAMETER_SLOT("Tendril_ManualX"), 0, SettingsMap, oset),
+        GetValueCurveInt(PARAMETER_SLOT("Tendril_ManualY"), 0, SettingsMap, oset)
     );
 }
 
@@ -593,7 +593,7 @@ void TendrilEffect::Render(RenderBuffer &buffer, const std::string& movement,
             {
             case 1:
                 // random
-				_tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, startmiddle, buffer.BufferWi, buffer.BufferHt);
+				_tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, startmiddle, buffer.BufferWi, buffer.BufferHt, buffer.rng);
 				break;
             case 2:
                 // corners
@@ -605,7 +605,7 @@ void TendrilEffect::Render(RenderBuffer &buffer, const std::string& movement,
                 {
                     _mv4 = 1;
                 }
-				_tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, startbottomleft, buffer.BufferWi, buffer.BufferHt);
+				_tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, startbottomleft, buffer.BufferWi, buffer.BufferHt, buffer.rng);
 				break;
             case 3:
                 // circles
@@ -616,7 +616,7 @@ void TendrilEffect::Render(RenderBuffer &buffer, const std::string& movement,
                 {
                     _mv3 = 1;
                 }
-				_tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, startmiddle, buffer.BufferWi, buffer.BufferHt);
+				_tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, startmiddle, buffer.BufferWi, buffer.BufferHt, buffer.rng);
 				break;
             case 4:
                 // horizontal zig zag
@@ -627,14 +627,14 @@ void TendrilEffect::Render(RenderBuffer &buffer, const std::string& movement,
                     _mv2 = 1;
                 }
                 _mv3 = 1; // direction
-				_tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, startmiddlebottom, buffer.BufferWi, buffer.BufferHt);
+				_tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, startmiddlebottom, buffer.BufferWi, buffer.BufferHt, buffer.rng);
 				break;
             case 5:
                 // vertical zig zag
                 _mv1 = 0 + truexoffset; // current x
                 _mv2 = (double)tunemovement * 1.5;
                 _mv3 = 1; // direction
-				_tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, startmiddleleft, buffer.BufferWi, buffer.BufferHt);
+				_tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, startmiddleleft, buffer.BufferWi, buffer.BufferHt, buffer.rng);
 				break;
 			case 6:
 				// line movement based on music
@@ -644,7 +644,7 @@ void TendrilEffect::Render(RenderBuffer &buffer, const std::string& movement,
 				{
 					_mv3 = 1;
 				}
-				_tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, startbottomleft, buffer.BufferWi, buffer.BufferHt);
+				_tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, startbottomleft, buffer.BufferWi, buffer.BufferHt, buffer.rng);
 				break;
 			case 7:
 				// circle movement based on music
@@ -655,7 +655,7 @@ void TendrilEffect::Render(RenderBuffer &buffer, const std::string& movement,
 				{
 					_mv3 = 1;
 				}
-				_tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, startmiddle, buffer.BufferWi, buffer.BufferHt);
+				_tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, startmiddle, buffer.BufferWi, buffer.BufferHt, buffer.rng);
 				break;
             case 9:
                 // horizontal zig zag return
@@ -666,17 +666,17 @@ void TendrilEffect::Render(RenderBuffer &buffer, const std::string& movement,
                     _mv2 = 1;
                 }
                 _mv3 = 1; // direction
-                _tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, startmiddlebottom, buffer.BufferWi, buffer.BufferHt);
+                _tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, startmiddlebottom, buffer.BufferWi, buffer.BufferHt, buffer.rng);
                 break;
             case 8:
                 // vertical zig zag return
                 _mv1 = 0; // current x
                 _mv2 = (double)tunemovement * 1.5;
                 _mv3 = 1; // direction
-                _tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, startmiddleleft, buffer.BufferWi, buffer.BufferHt);
+                _tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, startmiddleleft, buffer.BufferWi, buffer.BufferHt, buffer.rng);
                 break;
             case 10:
-                _tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, wxPoint(manualx * buffer.BufferWi / 100, manualy * buffer.BufferHt / 100), buffer.BufferWi, buffer.BufferHt);
+                _tendril = new Tendril(friction, trails, length, dampening, tension, -1, -1, wxPoint(manualx * buffer.BufferWi / 100, manualy * buffer.BufferHt / 100), buffer.BufferWi, buffer.BufferHt, buffer.rng);
                 break;
             }
     }
@@ -691,7 +691,7 @@ void TendrilEffect::Render(RenderBuffer &buffer, const std::string& movement,
             // random
             if (_tendril != NULL)
             {
-                _tendril->UpdateRandomMove(tunemovement);
+                _tendril->UpdateRandomMove(tunemovement, buffer.rng);
             }
             break;
         case 2:
@@ -800,7 +800,7 @@ void TendrilEffect::Render(RenderBuffer &buffer, const std::string& movement,
             float f = 0.1f;
             if (buffer.GetMedia() != NULL)
             {
-                std::list<float>* p = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
+                const FrameDataSpan* p = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
                 if (p != NULL)
                 {
                     f = *p->begin();
@@ -830,7 +830,7 @@ void TendrilEffect::Render(RenderBuffer &buffer, const std::string& movement,
             float f = 0.1f;
             if (buffer.GetMedia() != NULL)
             {
-                std::list<float>* p = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
+                const FrameDataSpan* p = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
                 if (p != NULL)
                 {
                     f = *p->begin();
@@ -38,7 +38,7 @@ class ATendril
 	public:
 
 	~ATendril();
-	ATendril(float friction, int size, float dampening, float tension, float spring, const wxPoint& start, size_t maxx, size_t maxy);
+	ATendril(float friction, int size, float dampening, float tension, float spring, const wxPoint& start, size_t maxx, size_t maxy, RenderRandom &rng);
 	void Update(wxPoint* target);
 	void Draw(PathDrawingContext* gc, xlColor colour, int thickness);
 	wxPoint* LastLocation();
@@ -53,8 +53,8 @@ class Tendril
 	public:
 
 	~Tendril();
-	Tendril(float friction, int trails, int size, float dampening, float tension, float springbase, float springincr, const wxPoint& start, size_t maxx, size_t maxy);
-	void UpdateRandomMove(int tunemovement);
+	Tendril(float friction, int trails, int size, float dampening, float tension, float springbase, float springincr, const wxPoint& start, size_t maxx, size_t maxy, RenderRandom &rng);
+	void UpdateRandomMove(int tunemovement, RenderRandom &rng);
     void Update(wxPoint* target);
     void Update(int x, int y);
     void Draw(PathDrawingContext* gc, xlColor colour, int thickness);
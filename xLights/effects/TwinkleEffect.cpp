@@ -97,12 +97,12 @@ void TwinkleEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Rende
                 if (i%step==1 || step==1) {
                     int s = strobe.size();
                     strobe.resize(s + 1);
-                    strobe[s].duration = rand() % max_modulo;
+                    strobe[s].duration = buffer.rand() % max_modulo;
                     
                     strobe[s].x = x;
                     strobe[s].y = y;
                     
-                    strobe[s].colorindex = rand() % colorcnt;
+                    strobe[s].colorindex = buffer.rand() % colorcnt;
                 }
             }
         }
@@ -116,8 +116,8 @@ void TwinkleEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Rende
         if (strobe[x].duration == max_modulo) {
             strobe[x].duration = 0;
             if (reRandomize) {
-                strobe[x].duration -= rand() % max_modulo2;
-                strobe[x].colorindex = rand() % colorcnt;
+                strobe[x].duration -= buffer.rand() % max_modulo2;
+                strobe[x].colorindex = buffer.rand() % colorcnt;
             }
         }
         int i7 = strobe[x].duration;
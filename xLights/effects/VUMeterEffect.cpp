@@ -141,7 +141,7 @@ void VUMeterEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Rende
         SettingsMap.GetInt("SLIDER_VUMeter_StartNote", 0),
         SettingsMap.GetInt("SLIDER_VUMeter_EndNote", 127),
         SettingsMap.GetInt("SLIDER_VUMeter_XOffset", 0),
-        GetValueCurveInt("VUMeter_YOffset", 0, SettingsMap, oset)
+        GetValueCurveInt(PARAMETER_SLOT("VUMeter_YOffset"), 0, SettingsMap, oset)
     );
 }
 
@@ -331,7 +331,7 @@ void VUMeterEffect::RenderSpectrogramFrame(RenderBuffer &buffer, int usebars, st
     if (buffer.GetMedia() == nullptr) return;
 
     int truexoffset = xoffset * buffer.BufferWi / 100;
-	std::list<float>* pdata = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_VU, "");
+	const FrameDataSpan* pdata = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_VU, "");
 
 	if (pdata != nullptr && pdata->size() != 0)
 	{
@@ -339,11 +339,11 @@ void VUMeterEffect::RenderSpectrogramFrame(RenderBuffer &buffer, int usebars, st
 		{
 			if (lastvalues.size() == 0)
 			{
-				lastvalues = *pdata;
+				lastvalues.assign(pdata->begin(), pdata->end());
 			}
 			else
 			{
-				std::list<float>::iterator newdata = pdata->begin();
+				const float* newdata = pdata->begin();
 				std::list<float>::iterator olddata = lastvalues.begin();
 
 				while (olddata != lastvalues.end())
@@ -368,7 +368,7 @@ void VUMeterEffect::RenderSpectrogramFrame(RenderBuffer &buffer, int usebars, st
 		}
 		else
 		{
-			lastvalues = *pdata;
+			lastvalues.assign(pdata->begin(), pdata->end());
 		}
 
         int datapoints = std::min((int)pdata->size(), endNote - startNote + 1);
@@ -451,7 +451,7 @@ void VUMeterEffect::RenderVolumeBarsFrame(RenderBuffer &buffer, int usebars)
 		if (start + i >= 0)
 		{
 			float f = 0.0;
-			std::list<float>* pf = buffer.GetMedia()->GetFrameData(start + i, FRAMEDATA_HIGH, "");
+			const FrameDataSpan* pf = buffer.GetMedia()->GetFrameData(start + i, FRAMEDATA_HIGH, "");
 			if (pf != nullptr)
 			{
 				f = *pf->begin();
@@ -489,7 +489,7 @@ void VUMeterEffect::RenderWaveformFrame(RenderBuffer &buffer, int usebars, int y
 		if (start + i >= 0)
 		{
 			float fh = 0.0;
-			std::list<float>* pf = buffer.GetMedia()->GetFrameData(start + i, FRAMEDATA_HIGH, "");
+			const FrameDataSpan* pf = buffer.GetMedia()->GetFrameData(start + i, FRAMEDATA_HIGH, "");
 			if (pf != nullptr)
 			{
 				fh = *pf->begin();
@@ -649,7 +649,7 @@ void VUMeterEffect::RenderOnFrame(RenderBuffer& buffer)
     if (buffer.GetMedia() == nullptr) return;
    
     float f = 0.0;
-	std::list<float>* pf = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
+	const FrameDataSpan* pf = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
 	if (pf != nullptr)
 	{
 		f = *pf->begin();
@@ -672,7 +672,7 @@ void VUMeterEffect::RenderOnColourFrame(RenderBuffer& buffer)
     if (buffer.GetMedia() == nullptr) return;
 
     float f = 0.0;
-    std::list<float>* pf = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
+    const FrameDataSpan* pf = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
     if (pf != nullptr)
     {
         f = *pf->begin();
@@ -765,7 +765,7 @@ void VUMeterEffect::RenderIntensityWaveFrame(RenderBuffer &buffer, int usebars)
 		if (start + i >= 0)
 		{
 			float f = 0.0;
-			std::list<float>* pf = buffer.GetMedia()->GetFrameData(start + i, FRAMEDATA_HIGH, "");
+			const FrameDataSpan* pf = buffer.GetMedia()->GetFrameData(start + i, FRAMEDATA_HIGH, "");
 			if (pf != nullptr)
 			{
 				f = *pf->begin();
@@ -801,7 +801,7 @@ void VUMeterEffect::RenderLevelPulseFrame(RenderBuffer &buffer, int fadeframes,
     if (buffer.GetMedia() == nullptr) return;
     
     float f = 0.0;
-	std::list<float>* pf = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
+	const FrameDataSpan* pf = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
 	if (pf != nullptr)
 	{
 		f = *pf->begin();
@@ -998,7 +998,7 @@ void VUMeterEffect::RenderLevelShapeFrame(RenderBuffer& buffer, const std::strin
     float scaling = (float)scale / 100.0 * 7.0;
 
 	float f = 0.0;
-	std::list<float>* pf = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
+	const FrameDataSpan* pf = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
 	if (pf != nullptr)
 	{
 		f = *pf->begin();
@@ -1437,7 +1437,7 @@ void VUMeterEffect::RenderTimingEventJumpFrame(RenderBuffer &buffer, int fallfra
             if (effectPresent)
             {
                 float f = 0.0;
-                std::list<float>* pf = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
+                const FrameDataSpan* pf = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_HIGH, "");
                 if (pf != nullptr)
                 {
                     f = *pf->begin();
@@ -1524,7 +1524,7 @@ void VUMeterEffect::RenderNoteOnFrame(RenderBuffer& buffer, int startNote, int e
 {
     if (buffer.GetMedia() == nullptr) return;
 
-    std::list<float>* pdata = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_VU, "");
+    const FrameDataSpan* pdata = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_VU, "");
 
     if (pdata != nullptr && pdata->size() != 0)
     {
@@ -1557,7 +1557,7 @@ void VUMeterEffect::RenderNoteLevelPulseFrame(RenderBuffer& buffer, int fadefram
 {
     if (buffer.GetMedia() == nullptr) return;
 
-    std::list<float>* pdata = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_VU, "");
+    const FrameDataSpan* pdata = buffer.GetMedia()->GetFrameData(buffer.curPeriod, FRAMEDATA_VU, "");
 
     if (pdata != nullptr && pdata->size() != 0)
     {
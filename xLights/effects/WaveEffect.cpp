@@ -101,10 +101,10 @@ void WaveEffect::Render(Effect *effect, const SettingsMap &SettingsMap, RenderBu
     int FillColor = GetWaveFillColor(SettingsMap["CHOICE_Fill_Colors"]);
 
     bool MirrorWave = SettingsMap.GetBool("CHECKBOX_Mirror_Wave");
-    int NumberWaves = GetValueCurveInt("Number_Waves", 1, SettingsMap, oset);
-    int ThicknessWave = GetValueCurveInt("Thickness_Percentage", 5, SettingsMap, oset);
-    int WaveHeight = GetValueCurveInt("Wave_Height", 50, SettingsMap, oset);
-    int wspeed = GetValueCurveInt("Wave_Speed", 10, SettingsMap, oset);
+    int NumberWaves = GetValueCurveInt(PARAMETER_SLOT("Number_Waves"), 1, SettingsMap, oset);
+    int ThicknessWave = GetValueCurveInt(PARAMETER_SLOT("Thickness_Percentage"), 5, SettingsMap, oset);
+    int WaveHeight = GetValueCurveInt(PARAMETER_SLOT("Wave_Height"), 50, SettingsMap, oset);
+    int wspeed = GetValueCurveInt(PARAMETER_SLOT("Wave_Speed"), 10, SettingsMap, oset);
 
     int WaveDirection = "Left to Right" == SettingsMap["CHOICE_Wave_Direction"] ? 1 : 0;
 
@@ -156,14 +156,14 @@ void WaveEffect::Render(Effect *effect, const SettingsMap &SettingsMap, RenderBu
             int delay = 0, delta; //next branch length, angle
             WaveBuffer0.resize(NumberWaves * buffer.BufferWi);
             for (int x = 0; x < NumberWaves * buffer.BufferWi; ++x) {
-                //                if (delay < 1) angle = (rand() % 45) - 22.5;
+                //                if (delay < 1) angle = (buffer.rand() % 45) - 22.5;
                 //                int xx = WaveDirection? NumberWaves * BufferWi - x - 1: x;
                 WaveBuffer0[x] = (delay-- > 0) ? WaveBuffer0[x - 1] + delta : 2 * yc;
                 if (WaveBuffer0[x] >= 2 * buffer.BufferHt) { delta = -2; WaveBuffer0[x] = 2 * buffer.BufferHt - 1; if (delay > 1) delay = 1; }
                 if (WaveBuffer0[x] < 0) { delta = 2; WaveBuffer0[x] = 0; if (delay > 1) delay = 1; }
                 if (delay < 1) {
-                    delta = (rand() % 7) - 3;
-                    delay = 2 + (rand() % 3);
+                    delta = (buffer.rand() % 7) - 3;
+                    delay = 2 + (buffer.rand() % 3);
                 }
             }
         }
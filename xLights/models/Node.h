@@ -19,9 +19,11 @@
 #define NODE_SINGLE_COLOR_CHAN_CNT  1
 
 class Model;
+class PackedNodeTable;
 
 class NodeBaseClass
 {
+    friend class PackedNodeTable;
 
 protected:
     // color values in rgb order
@@ -16,7 +16,7 @@ bool ArtNetOutput::__initialised = false;
 ArtNetOutput::ArtNetOutput(wxXmlNode* node) : IPOutput(node)
 {
     _sequenceNum = 0;
-    _datagram = nullptr;
+    _socket = -1;
     memset(_data, 0, sizeof(_data));
 }
 
@@ -24,13 +24,12 @@ ArtNetOutput::ArtNetOutput() : IPOutput()
 {
     _channels = 510;
     _sequenceNum = 0;
-    _datagram = nullptr;
+    _socket = -1;
     memset(_data, 0, sizeof(_data));
 }
 
 ArtNetOutput::~ArtNetOutput()
 {
-    if (_datagram != nullptr) delete _datagram;
 }
 #pragma endregion Constructors and Destructors
 
@@ -58,8 +57,7 @@ int ArtNetOutput::GetArtNetCombinedUniverse(int net, int subnet, int universe)
 void ArtNetOutput::SendSync()
 {
     static wxByte syncdata[ARTNET_SYNCPACKET_LEN];
-    static wxIPV4address syncremoteAddr;
-    static wxDatagramSocket *syncdatagram = nullptr;
+    static UDPTransmitter::Destination syncDestination;
 
     if (!__initialised)
     {
@@ -78,40 +76,21 @@ void ArtNetOutput::SendSync()
         syncdata[9] = 0x52;
         syncdata[11] = 0x0E; // Protocol version Low
 
-        wxIPV4address localaddr;
-        if (IPOutput::__localIP == "")
-        {
-            localaddr.AnyAddress();
-        }
-        else
-        {
-            localaddr.Hostname(IPOutput::__localIP);
-        }
-
-        if (syncdatagram != nullptr)
-        {
-            delete syncdatagram;
-        }
-
-        syncdatagram = new wxDatagramSocket(localaddr, wxSOCKET_NOWAIT);
-        if (syncdatagram == nullptr)
-        {
-            logger_base.error("Error initialising Artnet sync datagram.");
-            return;
-        }
-
         // broadcast ... this is not really in line with the spec
         // I should use the net mask but i cant find a good way to do that
         //syncremoteAddr.BroadcastAddress();
         wxString ipaddrWithUniv = wxString::Format("%d.%d.%d.%d", __ip1, __ip2, __ip3, 255);
         logger_base.debug("artNet Sync broadcasting to %s.", (const char *)ipaddrWithUniv.c_str());
+        wxIPV4address syncremoteAddr;
         syncremoteAddr.Hostname(ipaddrWithUniv);
         syncremoteAddr.Service(ARTNET_PORT);
+        syncDestination = UDPTransmitter::Resolve(syncremoteAddr);
     }
 
-    if (syncdatagram != nullptr)
+    // sync goes out after all the universe data as it is queued last in the frame
+    if (IPOutput::__transmitter != nullptr)
     {
-        syncdatagram->SendTo(syncremoteAddr, syncdata, ARTNET_SYNCPACKET_LEN);
+        IPOutput::__transmitter->Queue(IPOutput::__transmitter->OpenInterface(IPOutput::__localIP), syncDestination, syncdata, ARTNET_SYNCPACKET_LEN);
     }
 }
 #pragma endregion Static Functions
@@ -142,26 +121,19 @@ bool ArtNetOutput::Open()
     _data[15] = ((_universe & 0xFF00) >> 8);
     _data[16] = 0x02; // we are going to send all 512 bytes
 
-    wxIPV4address localaddr;
-    if (IPOutput::__localIP == "")
-    {
-        localaddr.AnyAddress();
-    }
-    else
-    {
-        localaddr.Hostname(IPOutput::__localIP);
-    }
-
-    _datagram = new wxDatagramSocket(localaddr, wxSOCKET_NOWAIT);
-    if (_datagram == nullptr)
+    // all universes on the same local interface share one socket
+    _socket = __transmitter != nullptr ? __transmitter->OpenInterface(IPOutput::__localIP) : -1;
+    if (_socket < 0)
     {
         logger_base.error("Error initialising Artnet datagram for %s %d:%d:%d.", (const char *)_ip.c_str(), GetArtNetNet(), GetArtNetSubnet(), GetArtNetUniverse());
         _ok = false;
         return _ok;
     }
 
-    _remoteAddr.Hostname(_ip.c_str());
-    _remoteAddr.Service(ARTNET_PORT);
+    wxIPV4address remoteAddr;
+    remoteAddr.Hostname(_ip.c_str());
+    remoteAddr.Service(ARTNET_PORT);
+    _destination = UDPTransmitter::Resolve(remoteAddr);
 
     // work out our broascast address
     wxArrayString ipc = wxSplit(_ip.c_str(), '.');
@@ -206,14 +178,14 @@ bool ArtNetOutput::Open()
 #pragma region Frame Handling
 void ArtNetOutput::EndFrame()
 {
-    if (!_enabled || _datagram == nullptr) return;
+    if (!_enabled || _socket < 0 || __transmitter == nullptr) return;
 
 #ifdef USECHANGEDETECTION
     if (changed || SkipCount > 10)
     {
 #endif
         _data[12] = _sequenceNum;
-        _datagram->SendTo(_remoteAddr, _data, ARTNET_PACKET_LEN - (512 - _channels));
+        __transmitter->Queue(_socket, _destination, _data, ARTNET_PACKET_LEN - (512 - _channels));
         _sequenceNum = _sequenceNum == 255 ? 0 : _sequenceNum + 1;
 #ifdef USECHANGEDETECTION
         _skipCount = 0;
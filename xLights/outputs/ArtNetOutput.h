@@ -22,8 +22,8 @@ class ArtNetOutput : public IPOutput
     #pragma region Member Variables
     wxByte _data[ARTNET_PACKET_LEN];
     wxByte _sequenceNum;
-    wxIPV4address _remoteAddr;
-    wxDatagramSocket *_datagram;
+    int _socket;
+    UDPTransmitter::Destination _destination;
 
     // These are used for artnet sync
     static int __ip1;
@@ -63,7 +63,7 @@ public:
 
     #pragma region Start and Stop
     virtual bool Open() override;
-    virtual void Close() override {};
+    virtual void Close() override { _socket = -1; };
     #pragma endregion Start and Stop
 
     #pragma region Frame Handling
@@ -56,10 +56,7 @@ void DMXOutput::EndFrame()
     if (changed)
     {
 #endif
-        if (_serial != nullptr)
-        {
-            _serial->Write((char *)_data, _datalen);
-        }
+        SendFrame(_data, _datalen);
 #ifdef USECHANGEDETECTION
         changed = false;
     }
@@ -12,7 +12,7 @@ E131Output::E131Output(wxXmlNode* node) : IPOutput(node)
     _numUniverses = wxAtoi(node->GetAttribute("NumUniverses", "1"));
     CreateMultiUniverses(_numUniverses);
     _sequenceNum = 0;
-    _datagram = nullptr;
+    _socket = -1;
     memset(_data, 0, sizeof(_data));
 }
 
@@ -23,13 +23,12 @@ E131Output::E131Output() : IPOutput()
     _universe = 1;
     _sequenceNum = 0;
     _numUniverses = 1;
-    _datagram = nullptr;
+    _socket = -1;
     memset(_data, 0, sizeof(_data));
 }
 
 E131Output::~E131Output()
 {
-    if (_datagram != nullptr) delete _datagram;
 }
 #pragma endregion Constructors and Destructors
 
@@ -69,8 +68,7 @@ void E131Output::SendSync(int syncUniverse)
     static wxByte syncSequenceNum = 0;
     static bool initialised = false;
     static wxUint16 _lastsyncuniverse = 0;
-    static wxIPV4address syncremoteAddr;
-    static wxDatagramSocket *syncdatagram = nullptr;
+    static UDPTransmitter::Destination syncDestination;
 
     if (!initialised)
     {
@@ -124,26 +122,12 @@ void E131Output::SendSync(int syncUniverse)
             syncdata[45] = syncUniverse >> 8;
             syncdata[46] = syncUniverse & 0xff;
 
-            wxIPV4address localaddr;
-            if (IPOutput::__localIP == "")
-            {
-                localaddr.AnyAddress();
-            }
-            else
-            {
-                localaddr.Hostname(IPOutput::__localIP);
-            }
-
-            if (syncdatagram != nullptr)
-            {
-                delete syncdatagram;
-            }
-            syncdatagram = new wxDatagramSocket(localaddr, wxSOCKET_NOWAIT);
-
             // multicast - universe number must be in lower 2 bytes
             wxString ipaddrWithUniv = wxString::Format("%d.%d.%d.%d", 239, 255, syncdata[45], syncdata[46]);
+            wxIPV4address syncremoteAddr;
             syncremoteAddr.Hostname(ipaddrWithUniv);
             syncremoteAddr.Service(E131_PORT);
+            syncDestination = UDPTransmitter::Resolve(syncremoteAddr);
 
             log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
             logger_base.debug("e131 Sync sync universe changed to %d => %s:%d.", syncUniverse, (const char *)ipaddrWithUniv.c_str(), E131_PORT);
@@ -151,7 +135,11 @@ void E131Output::SendSync(int syncUniverse)
         syncdata[44] = syncSequenceNum++;   // sequence number
         syncdata[45] = syncUniverse >> 8;
         syncdata[46] = syncUniverse & 0xff;
-        syncdatagram->SendTo(syncremoteAddr, syncdata, E131_SYNCPACKET_LEN);
+        // sync goes out after all the universe data as it is queued last in the frame
+        if (IPOutput::__transmitter != nullptr)
+        {
+            IPOutput::__transmitter->Queue(IPOutput::__transmitter->OpenInterface(IPOutput::__localIP), syncDestination, syncdata, E131_SYNCPACKET_LEN);
+        }
     }
 }
 #pragma endregion Static Functions
@@ -233,33 +221,26 @@ bool E131Output::Open()
         _data[123] = 0x02;  // Property value count (high)
         _data[124] = 0x01;  // Property value count (low)
 
-        wxIPV4address localaddr;
-        if (IPOutput::__localIP == "")
-        {
-            localaddr.AnyAddress();
-        }
-        else
-        {
-            localaddr.Hostname(IPOutput::__localIP);
-        }
-
-        _datagram = new wxDatagramSocket(localaddr, wxSOCKET_NOWAIT);
-        if (_datagram == nullptr)
+        // all universes on the same local interface share one socket
+        _socket = __transmitter != nullptr ? __transmitter->OpenInterface(IPOutput::__localIP) : -1;
+        if (_socket < 0)
         {
             logger_base.error("E131Output: Error opening datagram.");
         }
 
+        wxIPV4address remoteAddr;
         if (wxString(_ip).StartsWith("239.255.") || _ip == "MULTICAST")
         {
             // multicast - universe number must be in lower 2 bytes
             wxString ipaddrWithUniv = wxString::Format("%d.%d.%d.%d", 239, 255, (int)UnivHi, (int)UnivLo);
-            _remoteAddr.Hostname(ipaddrWithUniv);
+            remoteAddr.Hostname(ipaddrWithUniv);
         }
         else
         {
-            _remoteAddr.Hostname(_ip.c_str());
+            remoteAddr.Hostname(_ip.c_str());
         }
-        _remoteAddr.Service(E131_PORT);
+        remoteAddr.Service(E131_PORT);
+        _destination = UDPTransmitter::Resolve(remoteAddr);
 
         int i = _channels;
         wxByte NumHi = i >> 8;   // Channels (high)
@@ -288,7 +269,7 @@ bool E131Output::Open()
         _data[116] = lo;  // 0x20b = E131_PACKET_LEN - 115
     }
 
-    return _ok && _datagram != nullptr;
+    return _ok && _socket >= 0;
 }
 
 void E131Output::Close()
@@ -300,6 +281,7 @@ void E131Output::Close()
             (*it)->Close();
         }
     }
+    _socket = -1;
 }
 #pragma endregion Start and Stop
 
@@ -356,7 +338,7 @@ void E131Output::EndFrame()
     }
     else
     {
-        if (_datagram == nullptr) return;
+        if (_socket < 0 || __transmitter == nullptr) return;
 
 #ifdef USECHANGEDETECTION
         // skipping would cause ECG-DR4 (firmware version 1.30) to timeout
@@ -364,7 +346,7 @@ void E131Output::EndFrame()
         {
 #endif
             _data[111] = _sequenceNum;
-            _datagram->SendTo(_remoteAddr, _data, E131_PACKET_LEN - (512 - _channels));
+            __transmitter->Queue(_socket, _destination, _data, E131_PACKET_LEN - (512 - _channels));
             _sequenceNum = _sequenceNum == 255 ? 0 : _sequenceNum + 1;
 
 #ifdef USECHANGEDETECTION
@@ -22,8 +22,8 @@ class E131Output : public IPOutput
     #pragma region Member Variables
     wxByte _data[E131_PACKET_LEN];
     wxByte _sequenceNum;
-    wxIPV4address _remoteAddr;
-    wxDatagramSocket *_datagram;
+    int _socket;
+    UDPTransmitter::Destination _destination;
 
     // in case it is a multi universe e131
     int _numUniverses;
@@ -5,6 +5,7 @@
 #include <log4cpp/Category.hh>
 
 std::string IPOutput::__localIP = "";
+UDPTransmitter* IPOutput::__transmitter = nullptr;
 
 #pragma region Constructors and Destructors
 IPOutput::IPOutput(wxXmlNode* node) : Output(node)
@@ -2,11 +2,13 @@
 #define IPOUTPUT_H
 
 #include "Output.h"
+#include "UDPTransmitter.h"
 
 class IPOutput : public Output
 {
 protected:
     static std::string __localIP;
+    static UDPTransmitter* __transmitter;
 
     virtual void Save(wxXmlNode* node) override;
 
@@ -22,6 +24,7 @@ public:
     static bool IsIPValid(std::string ip);
     static std::string CleanupIP(std::string ip);
     static void SetLocalIP(const std::string& localIP) { __localIP = localIP; }
+    static void SetTransmitter(UDPTransmitter* transmitter) { __transmitter = transmitter; }
     #pragma endregion Static Functions
 
     #pragma region Getters and Setters
@@ -0,0 +1,150 @@
+#include "LOREncoder.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+// most of the room left after the changed channels is kept free so the port does not stay full
+#define LOR_REFRESH_SHARE 4
+
+#pragma region Constructors and Destructors
+LOREncoder::LOREncoder()
+{
+    for (size_t i = 0; i <= 255; i++)
+    {
+        _intensity[i] = IntensityByte(i);
+    }
+    _refresh = 0;
+    _lastChanged = 0;
+    _lastDeferred = 0;
+}
+#pragma endregion Constructors and Destructors
+
+#pragma region Static Functions
+wxByte LOREncoder::IntensityByte(wxByte value)
+{
+    int temp = (int)(100.0*(double)value / (double)255 + 0.5);
+    switch (temp)
+    {
+    case 0:
+        return 0xF0;
+    case 100:
+        return 0x01;
+    default:
+        return 228 - temp * 2;
+    }
+}
+
+void LOREncoder::AppendIntensity(std::vector<wxByte>& buffer, long channel, wxByte intensity)
+{
+    wxByte unit = channel >> 4;
+    if (unit < 0xF0) unit++;
+
+    buffer.push_back(0);
+    buffer.push_back(unit);
+    buffer.push_back(3);
+    buffer.push_back(intensity);
+    buffer.push_back(0x80 | (channel % 16));
+    buffer.push_back(0);
+}
+
+void LOREncoder::AppendHeartbeat(std::vector<wxByte>& buffer)
+{
+    buffer.push_back(0);
+    buffer.push_back(0xFF);
+    buffer.push_back(0x81);
+    buffer.push_back(0x56);
+    buffer.push_back(0);
+}
+#pragma endregion Static Functions
+
+#pragma region Getters and Setters
+void LOREncoder::SetChannels(long channels)
+{
+    if (channels < 0) channels = 0;
+
+    _values.assign(channels, 0);
+    _sent.assign(channels, 0);
+    _known.assign(channels, false);
+    _heldBack.assign(channels, 0);
+    _touched.assign(channels, false);
+    _order.clear();
+    _order.reserve(channels);
+    _refresh = 0;
+}
+#pragma endregion Getters and Setters
+
+void LOREncoder::Reset()
+{
+    std::fill(_known.begin(), _known.end(), false);
+    std::fill(_heldBack.begin(), _heldBack.end(), 0);
+}
+
+void LOREncoder::Encode(std::vector<wxByte>& buffer, size_t maxBytes)
+{
+    long channels = (long)_values.size();
+
+    size_t room = channels;
+    if (maxBytes != LOR_NO_LIMIT)
+    {
+        room = buffer.size() < maxBytes ? (maxBytes - buffer.size()) / LOR_INTENSITY_COMMAND_LEN : 0;
+    }
+
+    _order.clear();
+    for (long i = 0; i < channels; i++)
+    {
+        _touched[i] = false;
+        if (!_known[i] || _intensity[_sent[i]] != _intensity[_values[i]])
+        {
+            _order.push_back(i);
+        }
+    }
+    _lastChanged = _order.size();
+
+    if (_order.size() > room)
+    {
+        // longest waiting first so nothing is starved then the biggest visible change
+        std::stable_sort(_order.begin(), _order.end(), [this](long a, long b)
+        {
+            if (_heldBack[a] != _heldBack[b]) return _heldBack[a] > _heldBack[b];
+            int da = _known[a] ? std::abs((int)_values[a] - (int)_sent[a]) : 256;
+            int db = _known[b] ? std::abs((int)_values[b] - (int)_sent[b]) : 256;
+            return da > db;
+        });
+    }
+
+    size_t send = std::min(room, _order.size());
+    buffer.reserve(buffer.size() + send * LOR_INTENSITY_COMMAND_LEN);
+    for (size_t i = 0; i < _order.size(); i++)
+    {
+        long ch = _order[i];
+        _touched[ch] = true;
+        if (i < send)
+        {
+            AppendIntensity(buffer, ch, _intensity[_values[ch]]);
+            _sent[ch] = _values[ch];
+            _known[ch] = true;
+            _heldBack[ch] = 0;
+        }
+        else
+        {
+            _heldBack[ch]++;
+        }
+    }
+    _lastDeferred = _order.size() - send;
+    room -= send;
+
+    // with no limit there is nothing to gain by repeating ourselves
+    if (maxBytes == LOR_NO_LIMIT || _lastDeferred > 0 || channels == 0) return;
+
+    size_t refresh = room / LOR_REFRESH_SHARE;
+    for (long checked = 0; refresh > 0 && checked < channels; checked++)
+    {
+        long ch = _refresh;
+        _refresh = (_refresh + 1) % channels;
+        if (!_touched[ch])
+        {
+            AppendIntensity(buffer, ch, _intensity[_sent[ch]]);
+            refresh--;
+        }
+    }
+}
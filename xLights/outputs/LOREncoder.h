@@ -0,0 +1,71 @@
+#ifndef LORENCODER_H
+#define LORENCODER_H
+
+#include <wx/defs.h>
+#include <vector>
+
+#pragma region LOR Encoder Constants
+#define LOR_INTENSITY_COMMAND_LEN 6
+#define LOR_HEARTBEAT_LEN 5
+#define LOR_NO_LIMIT ((size_t)-1)
+#pragma endregion LOR Encoder Constants
+
+// ******************************************************
+// * Turns channel values into LOR intensity commands.
+// * It remembers what each controller was last sent so a
+// * frame only carries the channels that changed. When a
+// * frame would take longer to send than the port has the
+// * channels that have been held back longest go first
+// * then the biggest changes. Anything left over goes out
+// * on a later frame. Spare room is used to resend
+// * unchanged channels in turn so a controller that missed
+// * a command or was power cycled comes back into step.
+// ******************************************************
+
+class LOREncoder
+{
+    #pragma region Member Variables
+    std::vector<wxByte> _values; // what the sequence wants now
+    std::vector<wxByte> _sent; // value last sent ... only valid where _known is set
+    std::vector<bool> _known;
+    std::vector<int> _heldBack; // frames a changed channel has been waiting
+    std::vector<long> _order; // scratch for prioritising
+    std::vector<bool> _touched; // scratch ... channels already dealt with this frame
+    wxByte _intensity[256];
+    long _refresh; // next unchanged channel to resend when there is room
+    size_t _lastChanged;
+    size_t _lastDeferred;
+    #pragma endregion Member Variables
+
+public:
+
+    #pragma region Constructors and Destructors
+    LOREncoder();
+    virtual ~LOREncoder() {}
+    #pragma endregion Constructors and Destructors
+
+    #pragma region Static Functions
+    // LOR intensity byte for a 0-255 channel value
+    static wxByte IntensityByte(wxByte value);
+    static void AppendIntensity(std::vector<wxByte>& buffer, long channel, wxByte intensity);
+    static void AppendHeartbeat(std::vector<wxByte>& buffer);
+    #pragma endregion Static Functions
+
+    #pragma region Getters and Setters
+    void SetChannels(long channels);
+    long GetChannels() const { return (long)_values.size(); }
+    void SetOneChannel(long channel, wxByte value) { if (channel >= 0 && channel < (long)_values.size()) _values[channel] = value; }
+    // changed channels in the last Encode
+    size_t GetLastChanged() const { return _lastChanged; }
+    // changed channels the last Encode had to leave for a later frame
+    size_t GetLastDeferred() const { return _lastDeferred; }
+    #pragma endregion Getters and Setters
+
+    // forget what the controllers have been sent so the next frame sends every channel
+    void Reset();
+
+    // appends commands to buffer keeping it no bigger than maxBytes
+    void Encode(std::vector<wxByte>& buffer, size_t maxBytes = LOR_NO_LIMIT);
+};
+
+#endif
@@ -1,24 +1,31 @@
 #include "LOROutput.h"
 
 #include <wx/xml/xml.h>
+#include <log4cpp/Category.hh>
 
 #pragma region Constructors and Destructors
 LOROutput::LOROutput(SerialOutput* output) : SerialOutput(output)
 {
     _lastheartbeat = -1;
-    memset(_data, 0, sizeof(_data));
+    _lastframe = -1;
+    _sendAll = false;
+    _deferredFrames = 0;
 }
 
 LOROutput::LOROutput(wxXmlNode* node) : SerialOutput(node)
 {
     _lastheartbeat = -1;
-    memset(_data, 0, sizeof(_data));
+    _lastframe = -1;
+    _sendAll = false;
+    _deferredFrames = 0;
 }
 
 LOROutput::LOROutput() : SerialOutput()
 {
     _lastheartbeat = -1;
-    memset(_data, 0, sizeof(_data));
+    _lastframe = -1;
+    _sendAll = false;
+    _deferredFrames = 0;
 }
 #pragma endregion Constructors and Destructors
 
@@ -26,16 +33,9 @@ void LOROutput::SendHeartbeat() const
 {
     if (!_enabled || _serial == nullptr || !_ok) return;
 
-    wxByte d[5];
-    d[0] = 0;
-    d[1] = 0xFF;
-    d[2] = 0x81;
-    d[3] = 0x56;
-    d[4] = 0;
-    if (_serial != nullptr)
-    {
-        _serial->Write((char *)d, 5);
-    }
+    std::vector<wxByte> d;
+    LOREncoder::AppendHeartbeat(d);
+    _serial->Write((char *)&d[0], d.size());
 }
 
 #pragma region Start and Stop
@@ -43,22 +43,11 @@ bool LOROutput::Open()
 {
     _ok = SerialOutput::Open();
 
-    for (size_t i = 0; i <= 255; i++)
-    {
-        int temp = (int)(100.0*(double)i / (double)255 + 0.5);
-        switch (temp)
-        {
-        case 0:
-            _data[i] = 0xF0;
-            break;
-        case 100:
-            _data[i] = 0x01;
-            break;
-        default:
-            _data[i] = 228 - temp * 2;
-            break;
-        }
-    }
+    // we know nothing about what the controllers are showing so the first frame sends every channel
+    _encoder.SetChannels(_channels);
+    _lastframe = -1;
+    _sendAll = false;
+    _deferredFrames = 0;
 
     return _ok;
 }
@@ -72,21 +61,71 @@ void LOROutput::Close()
 #pragma endregion Start and Stop
 
 #pragma region Frame Handling
+size_t LOROutput::GetFrameBudget() const
+{
+    if (_baudRate <= 0) return LOR_NO_LIMIT;
+
+    long ms = LOR_DEFAULT_FRAME_MS;
+    if (_lastframe >= 0 && _timer_msec > _lastframe)
+    {
+        ms = _timer_msec - _lastframe;
+    }
+
+    // 10 bits a byte on the wire ... less whatever the last frame left in the port
+    size_t budget = (size_t)_baudRate / 10 * ms / 1000;
+    size_t waiting = _serial->IsOpen() ? _serial->WaitingToWrite() : 0;
+    return budget > waiting ? budget - waiting : 0;
+}
+
 void LOROutput::EndFrame()
 {
-    if (!_enabled) return;
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (!_enabled || _serial == nullptr || !_ok) return;
+
+    _buffer.clear();
 
     // send heartbeat
     if (_timer_msec > _lastheartbeat + 300 || _timer_msec < _lastheartbeat || _lastheartbeat < 0)
     {
-        SendHeartbeat();
+        LOREncoder::AppendHeartbeat(_buffer);
         _lastheartbeat = _timer_msec;
     }
+
+    // only changed channels are sent ... if they will not all fit before the next frame the rest wait
+    _encoder.Encode(_buffer, _sendAll ? LOR_NO_LIMIT : GetFrameBudget());
+    _sendAll = false;
+    _lastframe = _timer_msec;
+
+    // only log when the port falls behind and when it catches up otherwise this would be every frame
+    if (_encoder.GetLastDeferred() > 0)
+    {
+        if (_deferredFrames == 0)
+        {
+            logger_base.debug("LOR %s cannot keep up, %d of %d changed channels held back.", (const char *)_commPort.c_str(), (int)_encoder.GetLastDeferred(), (int)_encoder.GetLastChanged());
+        }
+        _deferredFrames++;
+    }
+    else if (_deferredFrames > 0)
+    {
+        logger_base.debug("LOR %s caught up after %d frames.", (const char *)_commPort.c_str(), (int)_deferredFrames);
+        _deferredFrames = 0;
+    }
+
+    if (_buffer.size() > 0)
+    {
+        _serial->Write((char *)&_buffer[0], _buffer.size());
+    }
 }
 
 void LOROutput::ResetFrame()
 {
     _lastheartbeat = -1;
+    _lastframe = -1;
+    _deferredFrames = 0;
+
+    // playback is starting over so send every channel rather than trust what was sent before
+    _encoder.Reset();
 }
 #pragma endregion Frame Handling
 
@@ -95,19 +134,8 @@ void LOROutput::SetOneChannel(long channel, unsigned char data)
 {
     if (!_enabled || _serial == nullptr || !_ok) return;
 
-    wxByte d[6];
-    d[0] = 0;
-    d[1] = channel >> 4;
-    if (d[1] < 0xF0) d[1]++;
-    d[2] = 3;
-    d[3] = _data[data];
-    d[4] = 0x80 | (channel % 16);
-    d[5] = 0;
-
-    if (_serial != nullptr)
-    {
-        _serial->Write((char *)d, 6);
-    }
+    // nothing is sent until the end of the frame
+    _encoder.SetOneChannel(channel, data);
 }
 
 void LOROutput::AllOff()
@@ -116,12 +144,15 @@ void LOROutput::AllOff()
     {
         SetOneChannel(i, 0x00);
     }
+
+    // lights must not be left on because the port was busy
+    _sendAll = true;
 }
 #pragma endregion Data Setting
 
 #pragma region Getters and Setters
 std::string LOROutput::GetSetupHelp() const
 {
-    return "LOR controllers attached to any LOR dongle.\nMax of 8 channels at 9600 baud.\nMax of 48 channels at 57600 baud.\nMax of 96 channels at 115200 baud.\nRun your controllers in DMX mode for higher throughput.";
+    return "LOR controllers attached to any LOR dongle.\nOnly channels that change are sent so the limits below apply to channels changing each frame.\nMax of 8 channels at 9600 baud.\nMax of 48 channels at 57600 baud.\nMax of 96 channels at 115200 baud.\nRun your controllers in DMX mode for higher throughput.";
 }
 #pragma endregion Getters and Setters
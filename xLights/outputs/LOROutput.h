@@ -2,21 +2,33 @@
 #define LOROUTPUT_H
 
 #include "SerialOutput.h"
+#include "LOREncoder.h"
 
 // Should be called with: 0 <= chindex <= 3839 (max channels=240*16)
 
 #pragma region LOR Constants
 #define LOR_PACKET_LEN 256
 #define LOR_MAX_CHANNELS 3840
+#define LOR_DEFAULT_FRAME_MS 50
 #pragma endregion LOR Constants
 
 class LOROutput : public SerialOutput
 {
     #pragma region Member Variables
     long _lastheartbeat;
-    wxByte _data[LOR_PACKET_LEN];
+    long _lastframe; // _timer_msec of the last frame sent
+    bool _sendAll; // next frame must go out in full regardless of how long it takes
+    long _deferredFrames; // frames in a row that could not send every changed channel
+    LOREncoder _encoder;
+    std::vector<wxByte> _buffer; // everything for a frame goes to the port in one write
     #pragma endregion Member Variables
 
+    // how many bytes the port can take before the next frame is due
+    size_t GetFrameBudget() const;
+
+    // the whole frame already goes to the port in one write sized to fit before the next frame
+    virtual bool UsesTransmitter() const override { return false; }
+
 public:
 
     #pragma region Constructors and Destructors
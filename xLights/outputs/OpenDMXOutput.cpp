@@ -47,12 +47,9 @@ void OpenDMXOutput::EndFrame()
     if (changed)
     {
 #endif
-        if (_serial != nullptr)
-        {
-            _serial->SendBreak();  // sends a 1 millisecond break
-            wxMilliSleep(1);      // mark after break (MAB) - 1 millisecond is overkill (8 microseconds is the minimum dmx requirement)
-            _serial->Write((char *)_data, 513);
-        }
+        // the writer sends a 1 millisecond break and a 1 millisecond mark after break (MAB) ahead of the data
+        // 1 millisecond is overkill (8 microseconds is the minimum dmx requirement)
+        SendFrame(_data, 513, true);
 
 #ifdef USECHANGEDETECTION
         changed = false;
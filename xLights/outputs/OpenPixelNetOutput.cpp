@@ -61,14 +61,9 @@ void OpenPixelNetOutput::EndFrame()
     if (changed)
     {
 #endif
-        if (_serial != nullptr)
-        {
-            if (_serial->WaitingToWrite() == 0)
-            {
-                memcpy(&_serialBuffer[6], _data, sizeof(_data));
-                _serial->Write((char *)_serialBuffer, sizeof(_serialBuffer));
-            }
-        }
+        // if the port is still busy with the last frame the writer replaces it with this one
+        memcpy(&_serialBuffer[6], _data, sizeof(_data));
+        SendFrame(_serialBuffer, sizeof(_serialBuffer));
 #ifdef USECHANGEDETECTION
         changed = false;
     }
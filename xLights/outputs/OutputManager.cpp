@@ -9,6 +9,7 @@
 #include "ArtNetOutput.h"
 #include "TestPreset.h"
 #include <wx/msgdlg.h>
+#include <algorithm>
 
 #pragma region Constructors and Destructors
 OutputManager::OutputManager()
@@ -17,6 +18,7 @@ OutputManager::OutputManager()
     _dirty = false;
     _syncUniverse = 0;
     _outputting = false;
+    _routesChanged = false;
 }
 
 OutputManager::~OutputManager()
@@ -328,6 +330,12 @@ void OutputManager::SomethingChanged() const
 
         start += (*it)->GetChannels() * (*it)->GetUniverses();
     }
+
+    // channel numbers may have moved under us
+    if (_outputting)
+    {
+        RoutesChanged();
+    }
 }
 
 void OutputManager::SetForceFromIP(const std::string& forceFromIP)
@@ -546,14 +554,115 @@ void OutputManager::Replace(Output* replacethis, Output* withthis)
         }
     }
     _outputs = newoutputs;
+
+    if (_outputting)
+    {
+        RoutesChanged();
+    }
 }
 #pragma endregion Output Management
 
+#pragma region Channel Routing
+// Flattens the outputs into a table of channel runs so finding where a channel goes
+// does not mean walking the output list ... and walking each multi universe output's list
+void OutputManager::BuildRoutes(std::vector<OutputRoute>& routes, std::vector<int>& routePages) const
+{
+    routes.clear();
+    routePages.clear();
+
+    for (auto it = _outputs.begin(); it != _outputs.end(); ++it)
+    {
+        if ((*it)->IsOutputCollection())
+        {
+            // the universes in a collection dont know their own start channel
+            long start = (*it)->GetStartChannel() - 1;
+            auto outputs = (*it)->GetOutputs();
+            for (auto it2 = outputs.begin(); it2 != outputs.end(); ++it2)
+            {
+                if ((*it2)->GetChannels() > 0)
+                {
+                    routes.push_back({ start, (*it2)->GetChannels(), *it2 });
+                }
+                start += (*it2)->GetChannels();
+            }
+        }
+        else if ((*it)->GetChannels() > 0)
+        {
+            routes.push_back({ (*it)->GetStartChannel() - 1, (*it)->GetChannels(), *it });
+        }
+    }
+
+    std::sort(routes.begin(), routes.end(), [](const OutputRoute& a, const OutputRoute& b) { return a.startChannel < b.startChannel; });
+
+    if (routes.size() == 0) return;
+
+    routePages.resize((routes.back().startChannel + routes.back().channels) / OUTPUT_ROUTE_PAGE + 1, -1);
+    for (int i = 0; i < (int)routes.size(); i++)
+    {
+        long lastPage = (routes[i].startChannel + routes[i].channels - 1) / OUTPUT_ROUTE_PAGE;
+        for (long p = routes[i].startChannel / OUTPUT_ROUTE_PAGE; p <= lastPage; p++)
+        {
+            if (routePages[p] == -1)
+            {
+                routePages[p] = i;
+            }
+        }
+    }
+}
+
+// the output thread reads the routes without taking the lock so they are built to one side
+// and StartFrame swaps them in between frames
+void OutputManager::RoutesChanged() const
+{
+    std::vector<OutputRoute> routes;
+    std::vector<int> routePages;
+    BuildRoutes(routes, routePages);
+
+    wxCriticalSectionLocker lock(_outputCriticalSection);
+    _newRoutes.swap(routes);
+    _newRoutePages.swap(routePages);
+    _routesChanged = true;
+}
+
+// channel is zero based ... returns -1 if no output has the channel
+int OutputManager::FindRoute(long channel) const
+{
+    if (channel < 0) return -1;
+
+    long page = channel / OUTPUT_ROUTE_PAGE;
+    if (page >= (long)_routePages.size()) return -1;
+
+    int r = _routePages[page];
+    if (r < 0) return -1;
+
+    // a page only ever holds a few outputs
+    while (r < (int)_routes.size() && _routes[r].startChannel + _routes[r].channels <= channel)
+    {
+        r++;
+    }
+
+    if (r < (int)_routes.size() && _routes[r].startChannel <= channel)
+    {
+        return r;
+    }
+
+    return -1;
+}
+#pragma endregion Channel Routing
+
 #pragma region Frame Handling
 void OutputManager::StartFrame(long msec)
 {
     if (!_outputting) return;
     if (!_outputCriticalSection.TryEnter()) return;
+    if (_routesChanged)
+    {
+        _routes.swap(_newRoutes);
+        _routePages.swap(_newRoutePages);
+        _newRoutes.clear();
+        _newRoutePages.clear();
+        _routesChanged = false;
+    }
     for (auto it = _outputs.begin(); it != _outputs.end(); ++it)
     {
         (*it)->StartFrame(msec);
@@ -597,6 +706,9 @@ void OutputManager::EndFrame()
             ArtNetOutput::SendSync();
         }
     }
+
+    // everything for this frame is queued ... let it go
+    _transmitter.Flush();
     _outputCriticalSection.Leave();
 }
 #pragma endregion Frame Handling
@@ -612,6 +724,11 @@ bool OutputManager::StartOutput()
     int started = 0;
     bool ok = true;
 
+    BuildRoutes(_routes, _routePages);
+    _routesChanged = false;
+    _transmitter.Start();
+    IPOutput::SetTransmitter(&_transmitter);
+
     for (auto it = _outputs.begin(); it != _outputs.end(); ++it)
     {
         bool preok = ok;
@@ -639,7 +756,16 @@ void OutputManager::StopOutput()
         (*it)->Close();
     }
 
+    // sends anything still queued then closes the sockets
+    _transmitter.Stop();
+    IPOutput::SetTransmitter(nullptr);
+
     _outputting = false;
+    _routes.clear();
+    _routePages.clear();
+    _newRoutes.clear();
+    _newRoutePages.clear();
+    _routesChanged = false;
     _outputCriticalSection.Leave();
 }
 #pragma endregion Start and Stop
@@ -653,12 +779,23 @@ void OutputManager::AllOff()
         (*it)->AllOff();
         (*it)->EndFrame();
     }
+    _transmitter.Flush();
     _outputCriticalSection.Leave();
 }
 
 // channel here is zero based
 void OutputManager::SetOneChannel(long channel, unsigned char data)
 {
+    if (_routes.size() > 0)
+    {
+        int r = FindRoute(channel);
+        if (r >= 0)
+        {
+            _routes[r].output->SetOneChannel(channel - _routes[r].startChannel, data);
+        }
+        return;
+    }
+
     long sc = 0;
     Output* output = GetOutput(channel + 1, sc);
     if (output != nullptr)
@@ -672,6 +809,31 @@ void OutputManager::SetManyChannels(long channel, unsigned char* data, long size
 {
     if (size == 0) return;
 
+    if (_routes.size() > 0)
+    {
+        int r = FindRoute(channel);
+        wxASSERT(r >= 0);
+        if (r < 0) return;
+
+        // each route is one contiguous copy into an output's buffer
+        long offset = channel - _routes[r].startChannel;
+        long left = size;
+        while (left > 0 && r < (int)_routes.size())
+        {
+            const OutputRoute& route = _routes[r];
+#ifdef _MSC_VER
+            long send = min(left, route.channels - offset);
+#else
+            long send = std::min(left, route.channels - offset);
+#endif
+            route.output->SetManyChannels(offset, &data[size - left], send);
+            left -= send;
+            offset = 0;
+            r++;
+        }
+        return;
+    }
+
     long stch;
     Output* o = GetOutput(channel + 1, stch);
     wxASSERT(o != nullptr);
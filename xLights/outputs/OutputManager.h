@@ -2,8 +2,10 @@
 #define OUTPUTMANAGER_H
 
 #include <list>
+#include <vector>
 #include <string>
 #include <wx/thread.h>
+#include "UDPTransmitter.h"
 
 class Output;
 class Controller;
@@ -11,8 +13,19 @@ class TestPreset;
 
 #define NETWORKSFILE "xlights_networks.xml";
 
+// channels per entry in the route page index
+#define OUTPUT_ROUTE_PAGE 512
+
 class OutputManager
 {
+    // a run of channels which all go to one output ... multi universe outputs get one per universe
+    struct OutputRoute
+    {
+        long startChannel; // zero based absolute channel
+        long channels;
+        Output* output;
+    };
+
     #pragma region Member Variables
     std::string _filename;
     std::list<Output*> _outputs;
@@ -21,9 +34,19 @@ class OutputManager
     bool _syncEnabled;
     bool _dirty;
     bool _outputting; // true if we are currently sending out data
-    wxCriticalSection _outputCriticalSection; // used to protect areas that must be single threaded
+    mutable wxCriticalSection _outputCriticalSection; // used to protect areas that must be single threaded
+    UDPTransmitter _transmitter; // sends the e131 and artnet packets for each frame
+    std::vector<OutputRoute> _routes; // only valid while outputting
+    std::vector<int> _routePages; // first route that covers each page of channels or -1
+    mutable std::vector<OutputRoute> _newRoutes; // rebuilt routes waiting for the next StartFrame
+    mutable std::vector<int> _newRoutePages;
+    mutable bool _routesChanged;
     #pragma endregion Member Variables
 
+    void BuildRoutes(std::vector<OutputRoute>& routes, std::vector<int>& routePages) const;
+    void RoutesChanged() const;
+    int FindRoute(long channel) const;
+
 public:
 
     #pragma region Constructors and Destructors
@@ -50,15 +50,10 @@ void PixelNetOutput::EndFrame()
     if (changed)
     {
 #endif
-        if (_serial != nullptr)
-        {
-            if (_serial->WaitingToWrite() == 0)
-            {
-                memcpy(&_serialBuffer[1], _data, sizeof(_data));
-                _serialBuffer[0] = 170;    // start of message
-                _serial->Write((char *)_serialBuffer, sizeof(_serialBuffer));
-            }
-        }
+        // if the port is still busy with the last frame the writer replaces it with this one
+        memcpy(&_serialBuffer[1], _data, sizeof(_data));
+        _serialBuffer[0] = 170;    // start of message
+        SendFrame(_serialBuffer, sizeof(_serialBuffer));
 #ifdef USECHANGEDETECTION
         changed = false;
     }
@@ -49,10 +49,7 @@ void RenardOutput::EndFrame()
     if (changed)
     {
 #endif
-        if (_serial != nullptr)
-        {
-            _serial->Write((char *)&_data[0], _datalen);
-        }
+        SendFrame(&_data[0], _datalen);
 #ifdef USECHANGEDETECTION
         changed = false;
     }
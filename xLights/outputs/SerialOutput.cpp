@@ -1,4 +1,5 @@
 #include "SerialOutput.h"
+#include "SerialTransmitter.h"
 
 #include <wx/xml/xml.h>
 #include <log4cpp/Category.hh>
@@ -16,6 +17,7 @@
 SerialOutput::SerialOutput(wxXmlNode* node) : Output(node)
 {
     _serial = nullptr;
+    _transmitter = nullptr;
     strcpy(_serialConfig, "8N1");
     _commPort = node->GetAttribute("ComPort", "").ToStdString();
     if (node->GetAttribute("BaudRate", "n/a") == "n/a")
@@ -31,6 +33,7 @@ SerialOutput::SerialOutput(wxXmlNode* node) : Output(node)
 SerialOutput::SerialOutput(SerialOutput* output) : Output(output)
 {
     _serial = nullptr;
+    _transmitter = nullptr;
     strcpy(_serialConfig, "8N1");
     _commPort = output->GetCommPort();
     _baudRate = output->GetBaudRate();
@@ -39,6 +42,7 @@ SerialOutput::SerialOutput(SerialOutput* output) : Output(output)
 SerialOutput::SerialOutput() : Output()
 {
     _serial = nullptr;
+    _transmitter = nullptr;
     strcpy(_serialConfig, "8N1");
     _commPort = "";
     _baudRate = 0;
@@ -46,6 +50,7 @@ SerialOutput::SerialOutput() : Output()
 
 SerialOutput::~SerialOutput()
 {
+    if (_transmitter != nullptr) delete _transmitter;
     if (_serial != nullptr) delete _serial;
 }
 #pragma endregion Constructors and Destructors
@@ -94,11 +99,13 @@ std::string SerialOutput::GetBaudRateString() const
 
 size_t SerialOutput::TxNonEmptyCount() const
 {
+    if (_transmitter) return _transmitter->WaitingToWrite();
     return _serial ? _serial->WaitingToWrite() : 0;
 }
 
 bool SerialOutput::TxEmpty() const
 {
+    if (_transmitter) return (_transmitter->WaitingToWrite() == 0);
     if (_serial) return (_serial->WaitingToWrite() == 0);
     return true;
 }
@@ -317,6 +324,15 @@ bool SerialOutput::Open()
                 errcode);
             wxMessageBox(msg, _("Communication Error"), wxOK);
         }
+        else if (UsesTransmitter())
+        {
+            _transmitter = new SerialTransmitter(_serial, _commPort, _baudRate);
+            if (!_transmitter->Start())
+            {
+                delete _transmitter;
+                _transmitter = nullptr;
+            }
+        }
     }
 
     return _ok;
@@ -324,6 +340,13 @@ bool SerialOutput::Open()
 
 void SerialOutput::Close()
 {
+    if (_transmitter != nullptr)
+    {
+        // must finish with the port before we delete it
+        delete _transmitter;
+        _transmitter = nullptr;
+    }
+
     if (_serial != nullptr)
     {
         delete _serial;
@@ -332,6 +355,25 @@ void SerialOutput::Close()
 }
 #pragma endregion Start and Stop
 
+#pragma region Frame Handling
+void SerialOutput::SendFrame(const wxByte* data, size_t length, bool sendBreak)
+{
+    if (_transmitter != nullptr)
+    {
+        _transmitter->Send(data, length, sendBreak);
+    }
+    else if (_serial != nullptr)
+    {
+        if (sendBreak)
+        {
+            _serial->SendBreak();
+            wxMilliSleep(1); // mark after break
+        }
+        _serial->Write((char *)data, length);
+    }
+}
+#pragma endregion Frame Handling
+
 #pragma region Operator
 bool SerialOutput::operator==(const SerialOutput& output) const
 {
@@ -4,6 +4,8 @@
 #include "Output.h"
 #include "serial.h"
 
+class SerialTransmitter;
+
 class SerialOutput : public Output
 {
 
@@ -11,11 +13,17 @@ protected:
 
     #pragma region Member Variables
     SerialPort* _serial;
+    SerialTransmitter* _transmitter;
     char _serialConfig[4];
     #pragma endregion Member Variables
 
     virtual void Save(wxXmlNode* node) override;
 
+    // hands the frame to the port's writer thread ... writes it directly if the port has no writer
+    void SendFrame(const wxByte* data, size_t length, bool sendBreak = false);
+    // outputs that write the port themselves turn this off so Open does not start a writer thread
+    virtual bool UsesTransmitter() const { return true; }
+
 public:
 
     #pragma region Constructors and Destructors
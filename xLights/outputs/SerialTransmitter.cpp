@@ -0,0 +1,232 @@
+#include "SerialTransmitter.h"
+#include "serial.h"
+
+#include <wx/thread.h>
+#include <wx/utils.h>
+#include <chrono>
+#include <cstring>
+#include <log4cpp/Category.hh>
+
+// how long we keep retrying a port that will not take any more data
+#define SERIAL_WRITE_TIMEOUT_MS 1000
+// extra time allowed over the theoretical wire time for the port to drain
+#define SERIAL_DRAIN_SLACK_MS 20
+
+static long long NowUS()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+class SerialTransmitterThread : public wxThread
+{
+    SerialTransmitter* _transmitter;
+
+public:
+    SerialTransmitterThread(SerialTransmitter* transmitter) : wxThread(wxTHREAD_JOINABLE), _transmitter(transmitter) {}
+
+    virtual ExitCode Entry() override
+    {
+        _transmitter->ProcessFrames();
+        return nullptr;
+    }
+};
+
+#pragma region Constructors and Destructors
+SerialTransmitter::SerialTransmitter(SerialPort* serial, const std::string& portName, int baudRate)
+{
+    _serial = serial;
+    _portName = portName;
+    _baudRate = baudRate;
+    _hasPending = false;
+    _busy = false;
+    _stop = false;
+    _thread = nullptr;
+    memset(&_stats, 0x00, sizeof(_stats));
+}
+
+SerialTransmitter::~SerialTransmitter()
+{
+    Stop();
+}
+#pragma endregion Constructors and Destructors
+
+#pragma region Start and Stop
+bool SerialTransmitter::Start()
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (_thread != nullptr) return true;
+
+    _stop = false;
+    _hasPending = false;
+    _busy = false;
+    memset(&_stats, 0x00, sizeof(_stats));
+
+    _thread = new SerialTransmitterThread(this);
+    if (_thread->Create() != wxTHREAD_NO_ERROR)
+    {
+        logger_base.error("SerialTransmitter: Unable to create the writer thread for %s.", (const char *)_portName.c_str());
+        delete _thread;
+        _thread = nullptr;
+        return false;
+    }
+    _thread->SetPriority(WXTHREAD_DEFAULT_PRIORITY + 1);
+    _thread->Run();
+
+    logger_base.debug("SerialTransmitter: Writer thread started for %s.", (const char *)_portName.c_str());
+    return true;
+}
+
+void SerialTransmitter::Stop()
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (_thread == nullptr) return;
+
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        _stop = true;
+    }
+    _signal.notify_all();
+    _thread->Wait();
+    delete _thread;
+    _thread = nullptr;
+
+    Stats stats = GetStats();
+    logger_base.debug("SerialTransmitter: Writer thread stopped for %s. %d frames written, %d dropped because the port could not keep up, %d errors, slowest write took %ldus.",
+        (const char *)_portName.c_str(), (int)stats.frames, (int)stats.dropped, (int)stats.errors, stats.maxWriteUS);
+}
+#pragma endregion Start and Stop
+
+#pragma region Frame Handling
+void SerialTransmitter::Send(const wxByte* data, size_t length, bool sendBreak)
+{
+    if (_thread == nullptr) return;
+
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        if (_hasPending)
+        {
+            // the writer never got to the last one ... the newest frame wins
+            _stats.dropped++;
+        }
+        _pending.data.assign(data, data + length);
+        _pending.sendBreak = sendBreak;
+        _pending.queued = NowUS();
+        _hasPending = true;
+    }
+    _signal.notify_one();
+}
+
+size_t SerialTransmitter::WaitingToWrite()
+{
+    size_t res = 0;
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        if (_hasPending) res += _pending.data.size();
+    }
+    if (_serial != nullptr && _serial->IsOpen())
+    {
+        res += _serial->WaitingToWrite();
+    }
+    return res;
+}
+
+SerialTransmitter::Stats SerialTransmitter::GetStats()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    return _stats;
+}
+
+void SerialTransmitter::WriteFrame(Frame& frame)
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    long long start = NowUS();
+    bool ok = true;
+
+    if (frame.sendBreak)
+    {
+        _serial->SendBreak();
+        wxMilliSleep(1); // mark after break
+    }
+
+    size_t written = 0;
+    long long giveUp = start + SERIAL_WRITE_TIMEOUT_MS * 1000;
+    while (written < frame.data.size())
+    {
+        size_t remaining = frame.data.size() - written;
+        int n = _serial->Write((char *)&frame.data[written], remaining);
+#ifdef __WXMSW__
+        // overlapped writes take the whole buffer and report nothing written while pending
+        if (n >= 0) n = remaining;
+#endif
+        if (n < 0)
+        {
+            logger_base.error("SerialTransmitter: Error writing to %s.", (const char *)_portName.c_str());
+            ok = false;
+            break;
+        }
+        written += n;
+        if (n == 0)
+        {
+            if (NowUS() > giveUp)
+            {
+                logger_base.warn("SerialTransmitter: %s would not accept any more data. %d of %d bytes written.", (const char *)_portName.c_str(), (int)written, (int)frame.data.size());
+                ok = false;
+                break;
+            }
+            // the driver buffer is full
+            wxMilliSleep(1);
+        }
+    }
+
+    // let the port drain before we take the next frame so frames never queue up in the driver
+    // and so the last frame is out before the port is closed
+    if (ok && _baudRate > 0)
+    {
+        long long drainUS = (long long)frame.data.size() * 10 * 1000000 / _baudRate + SERIAL_DRAIN_SLACK_MS * 1000;
+        long long deadline = NowUS() + drainUS;
+        while (_serial->WaitingToWrite() > 0 && NowUS() < deadline)
+        {
+            wxMilliSleep(1);
+        }
+    }
+
+    long long end = NowUS();
+
+    std::unique_lock<std::mutex> lock(_lock);
+    if (ok)
+    {
+        _stats.frames++;
+    }
+    else
+    {
+        _stats.errors++;
+    }
+    _stats.lastWriteUS = (long)(end - start);
+    if (_stats.lastWriteUS > _stats.maxWriteUS) _stats.maxWriteUS = _stats.lastWriteUS;
+    _stats.lastLatencyUS = (long)(end - frame.queued);
+    if (_stats.lastLatencyUS > _stats.maxLatencyUS) _stats.maxLatencyUS = _stats.lastLatencyUS;
+}
+
+void SerialTransmitter::ProcessFrames()
+{
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            _busy = false;
+            _signal.wait(lock, [this]() { return _stop || _hasPending; });
+            // a frame queued just before Stop still goes out ... it is often the blackout
+            if (!_hasPending) return;
+
+            std::swap(_pending, _sending);
+            _hasPending = false;
+            _busy = true;
+        }
+
+        WriteFrame(_sending);
+    }
+}
+#pragma endregion Frame Handling
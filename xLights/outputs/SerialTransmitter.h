@@ -0,0 +1,90 @@
+#ifndef SERIALTRANSMITTER_H
+#define SERIALTRANSMITTER_H
+
+#include <wx/defs.h>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+
+class SerialPort;
+class SerialTransmitterThread;
+
+// ******************************************************
+// * Writes frames to one serial port from its own thread so
+// * a slow port no longer holds up the frame for every other
+// * output. The port holds at most one waiting frame ... if
+// * a new frame arrives before the writer has picked up the
+// * last one the old frame is dropped and counted.
+// ******************************************************
+
+class SerialTransmitter
+{
+public:
+
+    struct Stats
+    {
+        size_t frames; // frames written
+        size_t dropped; // frames replaced before they could be written
+        size_t errors; // frames the port failed to accept
+        long lastWriteUS; // how long it took to write the last frame out of the port
+        long maxWriteUS;
+        long lastLatencyUS; // from being queued to being written
+        long maxLatencyUS;
+    };
+
+private:
+
+    struct Frame
+    {
+        std::vector<wxByte> data;
+        bool sendBreak;
+        long long queued; // us
+    };
+
+    #pragma region Member Variables
+    SerialPort* _serial;
+    std::string _portName;
+    int _baudRate;
+    Frame _pending;
+    Frame _sending;
+    bool _hasPending;
+    bool _busy;
+    bool _stop;
+    std::mutex _lock;
+    std::condition_variable _signal;
+    SerialTransmitterThread* _thread;
+    Stats _stats;
+    #pragma endregion Member Variables
+
+    void WriteFrame(Frame& frame);
+    void ProcessFrames();
+
+    friend class SerialTransmitterThread;
+
+public:
+
+    #pragma region Constructors and Destructors
+    // the port must stay open until the transmitter is stopped
+    SerialTransmitter(SerialPort* serial, const std::string& portName, int baudRate);
+    ~SerialTransmitter();
+    #pragma endregion Constructors and Destructors
+
+    #pragma region Start and Stop
+    bool Start();
+    // writes out any frame still waiting then stops the writer
+    void Stop();
+    bool IsRunning() const { return _thread != nullptr; }
+    #pragma endregion Start and Stop
+
+    #pragma region Frame Handling
+    // queues a copy of the frame replacing any frame not yet picked up by the writer
+    void Send(const wxByte* data, size_t length, bool sendBreak = false);
+    // bytes waiting in the mailbox and the port
+    size_t WaitingToWrite();
+    #pragma endregion Frame Handling
+
+    Stats GetStats();
+};
+
+#endif
@@ -0,0 +1,351 @@
+#include <wx/defs.h>
+
+// winsock2 must come before anything that pulls in windows.h
+#ifdef __WXMSW__
+#include <winsock2.h>
+#else
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <errno.h>
+#endif
+
+#include "UDPTransmitter.h"
+
+#include <wx/socket.h>
+#include <wx/thread.h>
+#include <wx/utils.h>
+#include <wx/arrstr.h>
+#include <algorithm>
+#include <chrono>
+#include <log4cpp/Category.hh>
+
+// most packets we hand to the OS in one call
+#define UDP_BATCH 256
+// how many times we wait for the socket buffer to drain before giving up on a packet
+#define UDP_RETRIES 10
+// big enough to hold a whole frame of a large show so sends rarely have to wait
+#define UDP_SEND_BUFFER (4 * 1024 * 1024)
+
+static long long NowUS()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void FillAddress(sockaddr_in& addr, const UDPTransmitter::Destination& to)
+{
+    memset(&addr, 0x00, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(to.port);
+    memcpy(&addr.sin_addr, &to.ip, sizeof(to.ip));
+}
+
+static bool IsBufferFull()
+{
+#ifdef __WXMSW__
+    return WSAGetLastError() == WSAEWOULDBLOCK || WSAGetLastError() == WSAENOBUFS;
+#else
+    return errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS;
+#endif
+}
+
+class UDPTransmitterThread : public wxThread
+{
+    UDPTransmitter* _transmitter;
+
+public:
+    UDPTransmitterThread(UDPTransmitter* transmitter) : wxThread(wxTHREAD_JOINABLE), _transmitter(transmitter) {}
+
+    virtual ExitCode Entry() override
+    {
+        _transmitter->ProcessFrames();
+        return nullptr;
+    }
+};
+
+#pragma region Constructors and Destructors
+UDPTransmitter::UDPTransmitter()
+{
+    _hasPending = false;
+    _stop = false;
+    _thread = nullptr;
+    memset(&_lastFrame, 0x00, sizeof(_lastFrame));
+    _frames = 0;
+    _droppedFrames = 0;
+    _maxSendUS = 0;
+}
+
+UDPTransmitter::~UDPTransmitter()
+{
+    Stop();
+}
+#pragma endregion Constructors and Destructors
+
+#pragma region Static Functions
+UDPTransmitter::Destination UDPTransmitter::Resolve(const wxIPV4address& address)
+{
+    Destination d;
+
+    wxByte ip[4] = { 0, 0, 0, 0 };
+    wxArrayString parts = wxSplit(address.IPAddress(), '.');
+    for (size_t i = 0; i < 4 && i < parts.size(); i++)
+    {
+        ip[i] = (wxByte)wxAtoi(parts[i]);
+    }
+    memcpy(&d.ip, ip, sizeof(d.ip));
+    d.port = address.Service();
+
+    return d;
+}
+#pragma endregion Static Functions
+
+#pragma region Start and Stop
+bool UDPTransmitter::Start()
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (_thread != nullptr) return true;
+
+    _stop = false;
+    _hasPending = false;
+    _building.Clear();
+    _pending.Clear();
+    memset(&_lastFrame, 0x00, sizeof(_lastFrame));
+    _frames = 0;
+    _droppedFrames = 0;
+    _maxSendUS = 0;
+
+    _thread = new UDPTransmitterThread(this);
+    if (_thread->Create() != wxTHREAD_NO_ERROR)
+    {
+        logger_base.error("UDPTransmitter: Unable to create the output thread.");
+        delete _thread;
+        _thread = nullptr;
+        return false;
+    }
+    // like the frame timer run slightly above normal so packets go out on time
+    _thread->SetPriority(WXTHREAD_DEFAULT_PRIORITY + 1);
+    _thread->Run();
+
+    logger_base.debug("UDPTransmitter: Output thread started.");
+    return true;
+}
+
+void UDPTransmitter::Stop()
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (_thread != nullptr)
+    {
+        Flush();
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            _stop = true;
+        }
+        _signal.notify_all();
+        _thread->Wait();
+        delete _thread;
+        _thread = nullptr;
+
+        logger_base.debug("UDPTransmitter: Output thread stopped. %d frames sent, %d dropped because the network could not keep up, slowest frame took %ldus to send.",
+            (int)_frames, (int)_droppedFrames, _maxSendUS);
+    }
+
+    for (auto it = _sockets.begin(); it != _sockets.end(); ++it)
+    {
+        (*it)->Close();
+        delete *it;
+    }
+    _sockets.clear();
+    _interfaces.clear();
+}
+
+int UDPTransmitter::OpenInterface(const std::string& localIP)
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    auto it = _interfaces.find(localIP);
+    if (it != _interfaces.end()) return it->second;
+
+    wxIPV4address localaddr;
+    if (localIP == "")
+    {
+        localaddr.AnyAddress();
+    }
+    else
+    {
+        localaddr.Hostname(localIP);
+    }
+
+    // broadcast is needed for artnet sync
+    wxDatagramSocket* socket = new wxDatagramSocket(localaddr, wxSOCKET_NOWAIT | wxSOCKET_BROADCAST);
+    if (!socket->IsOk())
+    {
+        logger_base.error("UDPTransmitter: Error opening datagram on '%s'.", (const char *)localIP.c_str());
+        delete socket;
+        return -1;
+    }
+
+    int size = UDP_SEND_BUFFER;
+    socket->SetOption(SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+
+    _sockets.push_back(socket);
+    _interfaces[localIP] = _sockets.size() - 1;
+    logger_base.debug("UDPTransmitter: Opened datagram on '%s'.", (const char *)localIP.c_str());
+
+    return _sockets.size() - 1;
+}
+#pragma endregion Start and Stop
+
+#pragma region Frame Handling
+void UDPTransmitter::Queue(int socket, const Destination& to, const wxByte* data, size_t length)
+{
+    if (socket < 0 || socket >= (int)_sockets.size()) return;
+
+    Packet p;
+    // the send thread only ever sees the native socket so it never touches the socket list
+    p.socket = _sockets[socket]->GetSocket();
+    p.to = to;
+    p.offset = _building.data.size();
+    p.length = length;
+    _building.data.insert(_building.data.end(), data, data + length);
+    _building.packets.push_back(p);
+}
+
+void UDPTransmitter::Flush()
+{
+    if (_thread == nullptr)
+    {
+        _building.Clear();
+        return;
+    }
+    if (_building.packets.empty()) return;
+
+    _building.flushed = NowUS();
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        // if the last frame has not gone yet it is stale ... send this one instead
+        if (_hasPending) _droppedFrames++;
+        std::swap(_building, _pending);
+        _hasPending = true;
+    }
+    _signal.notify_all();
+
+    // we get back the buffers of an old frame so the next one is built without allocating
+    _building.Clear();
+}
+
+void UDPTransmitter::ProcessFrames()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    while (true)
+    {
+        _signal.wait(lock, [this] { return _hasPending || _stop; });
+
+        if (_hasPending)
+        {
+            std::swap(_pending, _sending);
+            _hasPending = false;
+            lock.unlock();
+            SendFrame(_sending);
+            lock.lock();
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+void UDPTransmitter::SendFrame(Frame& frame)
+{
+    FrameStats stats;
+    stats.packets = frame.packets.size();
+    stats.bytes = frame.data.size();
+    stats.errors = 0;
+    long long start = NowUS();
+    stats.queuedUS = (long)(start - frame.flushed);
+
+    size_t i = 0;
+    while (i < frame.packets.size())
+    {
+        wxSOCKET_T fd = frame.packets[i].socket;
+
+        // send runs of packets going out the same socket together
+        size_t count = 0;
+        while (i + count < frame.packets.size() && count < UDP_BATCH && frame.packets[i + count].socket == fd) count++;
+
+#ifdef __linux__
+        mmsghdr msgs[UDP_BATCH];
+        iovec iovs[UDP_BATCH];
+        sockaddr_in addrs[UDP_BATCH];
+        memset(msgs, 0x00, sizeof(mmsghdr) * count);
+        for (size_t j = 0; j < count; j++)
+        {
+            const Packet& p = frame.packets[i + j];
+            FillAddress(addrs[j], p.to);
+            iovs[j].iov_base = &frame.data[p.offset];
+            iovs[j].iov_len = p.length;
+            msgs[j].msg_hdr.msg_name = &addrs[j];
+            msgs[j].msg_hdr.msg_namelen = sizeof(addrs[j]);
+            msgs[j].msg_hdr.msg_iov = &iovs[j];
+            msgs[j].msg_hdr.msg_iovlen = 1;
+        }
+
+        size_t sent = 0;
+        int retries = 0;
+        while (sent < count)
+        {
+            int res = sendmmsg(fd, &msgs[sent], count - sent, 0);
+            if (res > 0)
+            {
+                sent += res;
+            }
+            else if (IsBufferFull() && retries++ < UDP_RETRIES)
+            {
+                wxMilliSleep(1);
+            }
+            else
+            {
+                // skip the packet the OS would not take
+                stats.errors++;
+                sent++;
+            }
+        }
+#else
+        for (size_t j = 0; j < count; j++)
+        {
+            const Packet& p = frame.packets[i + j];
+            sockaddr_in addr;
+            FillAddress(addr, p.to);
+
+            int retries = 0;
+            while (sendto(fd, (const char*)&frame.data[p.offset], p.length, 0, (const sockaddr*)&addr, sizeof(addr)) < 0)
+            {
+                if (!IsBufferFull() || retries++ >= UDP_RETRIES)
+                {
+                    stats.errors++;
+                    break;
+                }
+                wxMilliSleep(1);
+            }
+        }
+#endif
+        i += count;
+    }
+
+    stats.sendUS = (long)(NowUS() - start);
+    frame.Clear();
+
+    std::unique_lock<std::mutex> lock(_lock);
+    _lastFrame = stats;
+    _frames++;
+    _maxSendUS = std::max(_maxSendUS, stats.sendUS);
+}
+#pragma endregion Frame Handling
+
+UDPTransmitter::FrameStats UDPTransmitter::GetLastFrameStats()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    return _lastFrame;
+}
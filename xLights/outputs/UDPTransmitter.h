@@ -0,0 +1,114 @@
+#ifndef UDPTRANSMITTER_H
+#define UDPTRANSMITTER_H
+
+#include <wx/socket.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+
+class UDPTransmitterThread;
+
+// ******************************************************
+// * Collects every UDP packet the E1.31 and ArtNet outputs
+// * build during a frame into one buffer and hands the whole
+// * frame to a dedicated thread which sends it through one
+// * socket per local interface. Where the OS supports it the
+// * packets go out in batches so a frame costs a handful of
+// * system calls rather than one per universe.
+// ******************************************************
+
+class UDPTransmitter
+{
+public:
+
+    // where a packet is going ... resolved once when the output is opened
+    struct Destination
+    {
+        wxUint32 ip; // network byte order
+        wxUint16 port;
+    };
+
+    struct FrameStats
+    {
+        size_t packets;
+        size_t bytes;
+        size_t errors;
+        long queuedUS; // how long the frame waited for the send thread
+        long sendUS; // how long it took to send
+    };
+
+private:
+
+    struct Packet
+    {
+        wxSOCKET_T socket;
+        Destination to;
+        size_t offset;
+        size_t length;
+    };
+
+    struct Frame
+    {
+        std::vector<wxByte> data;
+        std::vector<Packet> packets;
+        long long flushed; // us
+
+        void Clear() { data.clear(); packets.clear(); }
+    };
+
+    #pragma region Member Variables
+    std::map<std::string, int> _interfaces;
+    std::vector<wxDatagramSocket*> _sockets;
+    Frame _building;
+    Frame _pending;
+    Frame _sending;
+    bool _hasPending;
+    bool _stop;
+    std::mutex _lock;
+    std::condition_variable _signal;
+    UDPTransmitterThread* _thread;
+
+    FrameStats _lastFrame;
+    size_t _frames;
+    size_t _droppedFrames;
+    long _maxSendUS;
+    #pragma endregion Member Variables
+
+    void SendFrame(Frame& frame);
+    void ProcessFrames();
+
+    friend class UDPTransmitterThread;
+
+public:
+
+    #pragma region Constructors and Destructors
+    UDPTransmitter();
+    ~UDPTransmitter();
+    #pragma endregion Constructors and Destructors
+
+    #pragma region Static Functions
+    static Destination Resolve(const wxIPV4address& address);
+    #pragma endregion Static Functions
+
+    #pragma region Start and Stop
+    bool Start();
+    // sends anything still queued before stopping
+    void Stop();
+    bool IsRunning() const { return _thread != nullptr; }
+    // returns the socket to use for the given local ip ... blank means any interface
+    // new interfaces should only be opened while the outputs are being opened
+    int OpenInterface(const std::string& localIP);
+    #pragma endregion Start and Stop
+
+    #pragma region Frame Handling
+    void Queue(int socket, const Destination& to, const wxByte* data, size_t length);
+    // hands everything queued since the last flush to the send thread
+    void Flush();
+    #pragma endregion Frame Handling
+
+    FrameStats GetLastFrameStats();
+};
+
+#endif
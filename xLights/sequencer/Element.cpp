@@ -192,7 +192,8 @@ EffectLayer* StrandElement::GetEffectLayerFromExclusiveIndex(int index) {
 ModelElement::ModelElement(SequenceElements *l, const std::string &name, bool selected)
 :   Element(l, name),
     mSelected(selected),
-    waitCount(0)
+    waitCount(0),
+    activeRenderer(nullptr)
 {
 }
 
@@ -200,7 +201,7 @@ ModelElement::~ModelElement()
 {
     //make sure none of the render threads are rendering this model
     std::unique_lock<std::recursive_mutex> lock(changeLock);
-    while (waitCount > 0) {
+    while (waitCount > 0 || activeRenderer != nullptr) {
         lock.unlock();
         wxSleep(1);
         lock.lock();
@@ -221,6 +222,31 @@ void ModelElement::IncWaitCount() {
 void ModelElement::DecWaitCount() {
     waitCount--;
 }
+bool ModelElement::StartRender(void *renderer, const std::function<void()> &wakeWhenFree) {
+    std::unique_lock<std::mutex> lock(renderWaitersLock);
+    void *expected = nullptr;
+    if (activeRenderer.compare_exchange_strong(expected, renderer) || expected == renderer) {
+        return true;
+    }
+    if (wakeWhenFree) {
+        renderWaiters.push_back(wakeWhenFree);
+    }
+    return false;
+}
+void ModelElement::EndRender(void *renderer) {
+    std::list<std::function<void()>> waiters;
+    {
+        std::unique_lock<std::mutex> lock(renderWaitersLock);
+        void *expected = renderer;
+        if (activeRenderer.compare_exchange_strong(expected, nullptr)) {
+            waiters.swap(renderWaiters);
+        }
+    }
+    //call them without the lock held as they may try to start straight away
+    for (auto it = waiters.begin(); it != waiters.end(); ++it) {
+        (*it)();
+    }
+}
 
 
 
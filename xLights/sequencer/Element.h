@@ -5,6 +5,8 @@
 #include <atomic>
 #include <mutex>
 #include <string>
+#include <list>
+#include <functional>
 
 #include "EffectLayer.h"
 #include "../effects/EffectManager.h"
@@ -219,6 +221,12 @@ class ModelElement : public Element
         void IncWaitCount();
         void DecWaitCount();
 
+        // a render job can be split into several slices run on different threads so the render
+        // lock cannot be held for the whole render, instead the job claims the element.  If
+        // another renderer has it, wakeWhenFree is called once that renderer calls EndRender
+        bool StartRender(void *renderer, const std::function<void()> &wakeWhenFree = nullptr);
+        void EndRender(void *renderer);
+
         StrandElement *GetStrand(int strand, bool create = false);
         int GetStrandCount() const { return mStrands.size(); }
     protected:
@@ -228,6 +236,9 @@ class ModelElement : public Element
         std::vector<SubModelElement*> mSubModels;
         std::vector<StrandElement*> mStrands;
         std::atomic_int waitCount;
+        std::atomic<void*> activeRenderer;
+        std::mutex renderWaitersLock;
+        std::list<std::function<void()>> renderWaiters;
 };
 
 #endif // ELEMENT_H
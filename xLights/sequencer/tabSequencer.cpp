@@ -31,25 +31,32 @@ void xLightsFrame::CreateSequencer()
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
     EffectsPanel1 = nullptr;
     timingPanel = nullptr;
+    mainSequencer = nullptr;
+    sPreview1 = nullptr;
+    sPreview2 = nullptr;
 
     logger_base.debug("CreateSequencer: Creating Panels.");
-    mainSequencer = new MainSequencer(PanelSequencer);
-    mainSequencer->PanelEffectGrid->SetRenderDataSources(this, &SeqData);
-    mainSequencer->SetSequenceElements(&mSequenceElements);
+    m_mgr->SetDockSizeConstraint(0.25, 0.15);
 
-    mainSequencer->PanelWaveForm->SetTimeline(mainSequencer->PanelTimeLine);
+    // the grid, waveform and previews are all OpenGL canvases and a batch render shows none of them
+    if (!_renderMode)
+    {
+        mainSequencer = new MainSequencer(PanelSequencer);
+        mainSequencer->PanelEffectGrid->SetRenderDataSources(this, &SeqData);
+        mainSequencer->SetSequenceElements(&mSequenceElements);
 
-    mainSequencer->PanelRowHeadings->SetSequenceElements(&mSequenceElements);
-    mSequenceElements.SetMaxRowsDisplayed(mainSequencer->PanelRowHeadings->GetMaxRows());
+        mainSequencer->PanelWaveForm->SetTimeline(mainSequencer->PanelTimeLine);
 
-    m_mgr->SetDockSizeConstraint(0.25, 0.15);
+        mainSequencer->PanelRowHeadings->SetSequenceElements(&mSequenceElements);
+        mSequenceElements.SetMaxRowsDisplayed(mainSequencer->PanelRowHeadings->GetMaxRows());
 
-    sPreview1 = new ModelPreview(PanelSequencer);
-    m_mgr->AddPane(sPreview1,wxAuiPaneInfo().Name(wxT("ModelPreview")).Caption(wxT("Model Preview")).
-                   Left().Layer(1).PaneBorder(true).BestSize(250,250));
-    sPreview2 = new ModelPreview(PanelSequencer, PreviewModels, false);
-    m_mgr->AddPane(sPreview2,wxAuiPaneInfo().Name(wxT("HousePreview")).Caption(wxT("House Preview")).
-                   Left().Layer(1).BestSize(250,250));
+        sPreview1 = new ModelPreview(PanelSequencer);
+        m_mgr->AddPane(sPreview1,wxAuiPaneInfo().Name(wxT("ModelPreview")).Caption(wxT("Model Preview")).
+                       Left().Layer(1).PaneBorder(true).BestSize(250,250));
+        sPreview2 = new ModelPreview(PanelSequencer, PreviewModels, false);
+        m_mgr->AddPane(sPreview2,wxAuiPaneInfo().Name(wxT("HousePreview")).Caption(wxT("House Preview")).
+                       Left().Layer(1).BestSize(250,250));
+    }
 
     effectsPnl = new TopEffectsPanel(PanelSequencer);
     effectsPnl->BitmapButtonSelectedEffect->SetEffect(effectManager[0], mIconSize);
@@ -75,7 +82,10 @@ void xLightsFrame::CreateSequencer()
 
     // DisplayElements Panel
     displayElementsPanel = new DisplayElementsPanel(this, PanelSequencer);
-    displayElementsPanel->SetViewChoice(mainSequencer->ViewChoice);
+    if (mainSequencer != nullptr)
+    {
+        displayElementsPanel->SetViewChoice(mainSequencer->ViewChoice);
+    }
     displayElementsPanel->Fit();
 
     logger_base.debug("CreateSequencer: Hooking up the panes.");
@@ -94,10 +104,18 @@ void xLightsFrame::CreateSequencer()
     m_mgr->AddPane(timingPanel,wxAuiPaneInfo().Name(wxT("LayerTiming")).Caption(wxT("Layer Blending")).Top().Layer(0));
     m_mgr->AddPane(bufferPanel,wxAuiPaneInfo().Name(wxT("LayerSettings")).Caption(wxT("Layer Settings")).Top().Layer(0));
 
-    m_mgr->AddPane(mainSequencer,wxAuiPaneInfo().Name(_T("Main Sequencer")).CenterPane().Caption(_("Main Sequencer")));
+    if (mainSequencer != nullptr)
+    {
+        m_mgr->AddPane(mainSequencer,wxAuiPaneInfo().Name(_T("Main Sequencer")).CenterPane().Caption(_("Main Sequencer")));
+    }
 
     logger_base.debug("CreateSequencer: Updating the layout.");
     m_mgr->Update(); // <== KW: I have seen crashes on this line -107374819
+    if (mainSequencer == nullptr)
+    {
+        logger_base.debug("CreateSequencer: Done without the grid or previews for a batch render.");
+        return;
+    }
     logger_base.debug("CreateSequencer: Resizing everything.");
     mainSequencer->Layout();
     logger_base.debug("CreateSequencer: Done.");
@@ -146,8 +164,11 @@ void xLightsFrame::InitSequencer()
         LoadPerspective(mCurrentPerpective);
     }
     mSequencerInitialize = true;
-    sPreview2->InitializePreview(mBackgroundImage,mBackgroundBrightness);
-    sPreview2->SetScaleBackgroundImage(mScaleBackgroundImage);
+    if (sPreview2 != nullptr)
+    {
+        sPreview2->InitializePreview(mBackgroundImage,mBackgroundBrightness);
+        sPreview2->SetScaleBackgroundImage(mScaleBackgroundImage);
+    }
 }
 
 Model *xLightsFrame::GetModel(const std::string& name) {
@@ -471,7 +492,14 @@ void xLightsFrame::LoadAudioData(xLightsXmlFile& xml_file)
         if( mediaFilename != wxEmptyString )
         {
 			wxString error;
-            musicLength = mainSequencer->PanelWaveForm->OpenfileMedia(xml_file.GetMedia(), error);
+            if (mainSequencer != nullptr)
+            {
+                musicLength = mainSequencer->PanelWaveForm->OpenfileMedia(xml_file.GetMedia(), error);
+            }
+            else
+            {
+                musicLength = xml_file.GetMedia() == nullptr ? 0 : xml_file.GetMedia()->LengthMS();
+            }
             if(musicLength <=0)
             {
                 logger_base.warn("Media File Missing or Corrupted %s. Details: %s", (const char*) mediaFilename.c_str(), (const char *)error.c_str());
@@ -489,6 +517,8 @@ void xLightsFrame::LoadAudioData(xLightsXmlFile& xml_file)
         }
     }
 
+    if (mainSequencer == nullptr) return;
+
     mainSequencer->PanelTimeLine->SetTimeLength(mMediaLengthMS);
     mainSequencer->PanelTimeLine->Initialize();
     int maxZoom = mainSequencer->PanelTimeLine->GetMaxZoomLevel();
@@ -531,10 +561,12 @@ void xLightsFrame::LoadSequencer(xLightsXmlFile& xml_file)
     mSequenceElements.PrepareViews(xml_file);
     mSequenceElements.PopulateRowInformation();
 
+    mSequenceElements.SetSequenceEnd(CurrentSeqXmlFile->GetSequenceDurationMS());
+    if (mainSequencer == nullptr) return;
+
     mainSequencer->PanelEffectGrid->SetSequenceElements(&mSequenceElements);
     mainSequencer->PanelEffectGrid->SetTimeline(mainSequencer->PanelTimeLine);
     mainSequencer->PanelTimeLine->SetSequenceEnd(CurrentSeqXmlFile->GetSequenceDurationMS());
-    mSequenceElements.SetSequenceEnd(CurrentSeqXmlFile->GetSequenceDurationMS());
     ResizeAndMakeEffectsScroll();
     ResizeMainSequencer();
     mainSequencer->PanelEffectGrid->Refresh();
@@ -657,6 +689,7 @@ void xLightsFrame::ResizeAndMakeEffectsScroll()
 
 void xLightsFrame::ResizeMainSequencer()
 {
+    if (mainSequencer == nullptr) return;
 
     // Set max rows to determine correct row information size
     mSequenceElements.SetMaxRowsDisplayed(mainSequencer->PanelRowHeadings->GetMaxRows());
@@ -690,8 +723,11 @@ void xLightsFrame::UnselectedEffect(wxCommandEvent& event) {
     selectedEffectName = "";
     selectedEffectString = "";
     selectedEffectPalette = "";
-    sPreview1->Refresh();
-    sPreview2->Refresh();
+    if (sPreview1 != nullptr)
+    {
+        sPreview1->Refresh();
+        sPreview2->Refresh();
+    }
 }
 
 void xLightsFrame::EffectChanged(wxCommandEvent& event)
@@ -1289,6 +1325,9 @@ void xLightsFrame::TimerRgbSeq(long msec)
         }
     }
 
+    // nothing plays in a batch render
+    if (mainSequencer == nullptr) return;
+
     // Update play status so sequencer grid can allow dropping timings during playback
     mainSequencer->SetPlayStatus(playType);
 
@@ -1695,8 +1734,10 @@ void xLightsFrame::LoadPerspective(wxXmlNode *perspective) {
         //did not have the layer settings panel
         m_mgr->GetPane("LayerSettings").Caption("Layer Settings").Dock().Left().Show();
 
-        sPreview1->Refresh(false);
-        sPreview2->Refresh(false);
+        if (sPreview1 != nullptr) {
+            sPreview1->Refresh(false);
+            sPreview2->Refresh(false);
+        }
         m_mgr->Update();
 
         perspective->DeleteAttribute("settings");
@@ -1704,8 +1745,10 @@ void xLightsFrame::LoadPerspective(wxXmlNode *perspective) {
         perspective->AddAttribute("version", "2.0");
         perspective->AddAttribute("settings", m_mgr->SavePerspective());
     } else {
-        sPreview1->Refresh(false);
-        sPreview2->Refresh(false);
+        if (sPreview1 != nullptr) {
+            sPreview1->Refresh(false);
+            sPreview2->Refresh(false);
+        }
         m_mgr->Update();
     }
 
@@ -2018,10 +2061,10 @@ std::map<int, std::list<float>> xLightsFrame::LoadPolyphonicTranscription(AudioM
 
         for (size_t i = 0; i < frames; i++)
         {
-            std::list<float>* pdata = audio->GetFrameData(i, FRAMEDATA_NOTES, "");
+            const FrameDataSpan* pdata = audio->GetFrameData(i, FRAMEDATA_NOTES, "");
             if (pdata != nullptr)
             {
-                res[i*intervalMS] = *pdata;
+                res[i*intervalMS].assign(pdata->begin(), pdata->end());
             }
         }
 
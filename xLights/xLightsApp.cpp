@@ -540,6 +540,7 @@ bool xLightsApp::OnInit()
         { wxCMD_LINE_SWITCH, "n", "noauto", "enable auto-run prompt"},
         { wxCMD_LINE_SWITCH, "d", "debug", "enable debug mode"},
         { wxCMD_LINE_SWITCH, "r", "render", "render files and exit"},
+        { wxCMD_LINE_OPTION, "t", "timings", "with -r write render timings as json to this file"},
         { wxCMD_LINE_OPTION, "m", "media", "specify media directory"},
         { wxCMD_LINE_OPTION, "s", "show", "specify show directory" },
         { wxCMD_LINE_SWITCH, "w", "wipe", "wipe settings clean" },
@@ -564,6 +565,7 @@ bool xLightsApp::OnInit()
             logger_base.info("-d: Debug is ON");
             info += _("Debug is ON\n");
         }
+        RenderMode = parser.Found("r");
         RunPrompt = parser.Found("n");
         if (RunPrompt) {
             logger_base.info("-n: Auto-run prompt is ON");
@@ -607,7 +609,11 @@ bool xLightsApp::OnInit()
     if ( wxsOK )
     {
     	xLightsFrame* Frame = new xLightsFrame(0);
-    	Frame->Show();
+        // batch renders never need the window
+        if (!parser.Found("r"))
+        {
+            Frame->Show();
+        }
     	SetTopWindow(Frame);
     }
     //*)
@@ -615,7 +621,11 @@ bool xLightsApp::OnInit()
 
     if (parser.Found("r")) {
         logger_base.info("-r: Render mode is ON");
-        topFrame->_renderMode = true;
+        wxString timingsFile;
+        if (parser.Found("t", &timingsFile)) {
+            logger_base.info("-t: Render timings will be written to %s.", (const char *)timingsFile.c_str());
+            topFrame->_renderTimingsFile = timingsFile;
+        }
         topFrame->CallAfter(&xLightsFrame::OpenRenderAndSaveSequences, sequenceFiles);
     }
 
@@ -646,6 +656,7 @@ void xLightsApp::WipeSettings()
 //global flags from command line:
 bool xLightsApp::WantDebug = false;
 bool xLightsApp::RunPrompt = false; //prompt before running schedule (allows override) -DJ
+bool xLightsApp::RenderMode = false;
 wxString xLightsApp::DebugPath;
 wxString xLightsApp::mediaDir;
 wxString xLightsApp::showDir;
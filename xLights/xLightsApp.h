@@ -27,6 +27,7 @@ public:
     virtual bool OnInit();
     static bool WantDebug; //debug flag from command-line -DJ
     static bool RunPrompt; //prompt before running schedule (allows override) -DJ
+    static bool RenderMode; //render the sequences on the command line and exit
     static wxString DebugPath; //path name for debug log file -DJ
     static wxString showDir;
     static wxString mediaDir;
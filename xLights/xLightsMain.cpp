@@ -37,6 +37,7 @@
 #include "SequenceCheck.h"
 #include "FPPConnectDialog.h"
 #include "IPEntryDialog.h"
+#include "RenderProfileDialog.h"
 
 // scripting language
 #include "xLightsBasic.cpp"
@@ -193,6 +194,7 @@ const long xLightsFrame::ID_MENUITEM_CONVERT = wxNewId();
 const long xLightsFrame::ID_MENUITEM_GenerateCustomModel = wxNewId();
 const long xLightsFrame::ID_MNU_CHECKSEQ = wxNewId();
 const long xLightsFrame::ID_MENU_VIEW_LOG = wxNewId();
+const long xLightsFrame::ID_MNU_RENDER_PROFILE = wxNewId();
 const long xLightsFrame::ID_MENUITEM18 = wxNewId();
 const long xLightsFrame::ID_EXPORT_MODELS = wxNewId();
 const long xLightsFrame::ID_MNU_EXPORT_EFFECTS = wxNewId();
@@ -233,6 +235,8 @@ const long xLightsFrame::ID_BACKUP_ON_SAVE = wxNewId();
 const long xLightsFrame::ID_MENU_BACKUP_ON_LAUNCH = wxNewId();
 const long xLightsFrame::ID_ALT_BACKUPLOCATION = wxNewId();
 const long xLightsFrame::ID_MNU_BACKUP = wxNewId();
+const long xLightsFrame::ID_MNU_COMPRESSED_FSEQ = wxNewId();
+const long xLightsFrame::ID_MNU_RENDER_CACHE = wxNewId();
 const long xLightsFrame::ID_MENUITEM_ICON_SMALL = wxNewId();
 const long xLightsFrame::ID_MENUITEM_ICON_MEDIUM = wxNewId();
 const long xLightsFrame::ID_MENUITEM_ICON_LARGE = wxNewId();
@@ -416,7 +420,10 @@ xLightsFrame::xLightsFrame(wxWindow* parent,wxWindowID id) : mSequenceElements(t
     _fps = -1;
     mCurrentPerpective = nullptr;
     MenuItemPreviews = nullptr;
-    _renderMode = false;
+    // batch renders get no previews or sequencer grid ... nothing in them is needed to render
+    // and each one is an OpenGL canvas
+    _renderMode = xLightsApp::RenderMode;
+    _previewSize = wxSize(1280, 720);
 
     Bind(EVT_SELECTED_EFFECT_CHANGED, &xLightsFrame::SelectedEffectChanged, this);
     Bind(EVT_RENDER_RANGE, &xLightsFrame::RenderRange, this);
@@ -784,6 +791,8 @@ xLightsFrame::xLightsFrame(wxWindow* parent,wxWindowID id) : mSequenceElements(t
     Menu1->Append(MenuItemCheckSequence);
     MenuItem_ViewLog = new wxMenuItem(Menu1, ID_MENU_VIEW_LOG, _("&View Log"), wxEmptyString, wxITEM_NORMAL);
     Menu1->Append(MenuItem_ViewLog);
+    MenuItem_RenderProfile = new wxMenuItem(Menu1, ID_MNU_RENDER_PROFILE, _("Render &Profile"), _("Shows where the time went during the last render."), wxITEM_NORMAL);
+    Menu1->Append(MenuItem_RenderProfile);
     MenuItem38 = new wxMenuItem(Menu1, ID_MENUITEM18, _("&Package Log FIles"), _("Packages up current configuration, logs and sequence for reporting a problem to development team."), wxITEM_NORMAL);
     Menu1->Append(MenuItem38);
     mExportModelsMenuItem = new wxMenuItem(Menu1, ID_EXPORT_MODELS, _("E&xport Models"), wxEmptyString, wxITEM_NORMAL);
@@ -883,6 +892,11 @@ xLightsFrame::xLightsFrame(wxWindow* parent,wxWindowID id) : mSequenceElements(t
     MenuSettings->Append(mAltBackupLocationMenuItem);
     MenuItem_BackupSubfolders = new wxMenuItem(MenuSettings, ID_MNU_BACKUP, _("Backup Subfolders"), wxEmptyString, wxITEM_CHECK);
     MenuSettings->Append(MenuItem_BackupSubfolders);
+    MenuItem_CompressedFSEQ = new wxMenuItem(MenuSettings, ID_MNU_COMPRESSED_FSEQ, _("Compressed FSEQ Files"), _("Save fseq files in the compressed version 2 format. Older players can only read version 1."), wxITEM_CHECK);
+    MenuSettings->Append(MenuItem_CompressedFSEQ);
+    MenuItem_RenderCache = new wxMenuItem(MenuSettings, ID_MNU_RENDER_CACHE, _("Render Cache"), _("Keep rendered models beside the sequence so a full render only renders the models that changed."), wxITEM_CHECK);
+    MenuSettings->Append(MenuItem_RenderCache);
+    MenuItem_RenderCache->Check(true);
     ToolIconSizeMenu = new wxMenu();
     MenuItem10 = new wxMenuItem(ToolIconSizeMenu, ID_MENUITEM_ICON_SMALL, _("Small\tALT-1"), wxEmptyString, wxITEM_RADIO);
     ToolIconSizeMenu->Append(MenuItem10);
@@ -1064,6 +1078,7 @@ xLightsFrame::xLightsFrame(wxWindow* parent,wxWindowID id) : mSequenceElements(t
     Connect(ID_MENUITEM_GenerateCustomModel,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xLightsFrame::OnMenu_GenerateCustomModelSelected);
     Connect(ID_MNU_CHECKSEQ,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xLightsFrame::OnMenuItemCheckSequenceSelected);
     Connect(ID_MENU_VIEW_LOG,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xLightsFrame::OnMenuItem_ViewLogSelected);
+    Connect(ID_MNU_RENDER_PROFILE,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xLightsFrame::OnMenuItem_RenderProfileSelected);
     Connect(ID_MENUITEM18,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xLightsFrame::OnMenuItemPackageDebugFiles);
     Connect(ID_EXPORT_MODELS,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xLightsFrame::OnmExportModelsMenuItemSelected);
     Connect(ID_MNU_EXPORT_EFFECTS,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xLightsFrame::OnMenuItem_ExportEffectsSelected);
@@ -1104,6 +1119,8 @@ xLightsFrame::xLightsFrame(wxWindow* parent,wxWindowID id) : mSequenceElements(t
     Connect(ID_MENU_BACKUP_ON_LAUNCH,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xLightsFrame::OnMenuItem_BackupOnLaunchSelected);
     Connect(ID_ALT_BACKUPLOCATION,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xLightsFrame::OnmAltBackupLocationMenuItemSelected);
     Connect(ID_MNU_BACKUP,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xLightsFrame::OnMenuItem_BackupSubfoldersSelected);
+    Connect(ID_MNU_COMPRESSED_FSEQ,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xLightsFrame::OnMenuItem_CompressedFSEQSelected);
+    Connect(ID_MNU_RENDER_CACHE,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xLightsFrame::OnMenuItem_RenderCacheSelected);
     Connect(ID_MENUITEM_ICON_SMALL,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xLightsFrame::SetToolIconSize);
     Connect(ID_MENUITEM_ICON_MEDIUM,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xLightsFrame::SetToolIconSize);
     Connect(ID_MENUITEM_ICON_LARGE,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xLightsFrame::SetToolIconSize);
@@ -1185,6 +1202,8 @@ xLightsFrame::xLightsFrame(wxWindow* parent,wxWindowID id) : mSequenceElements(t
     mResetToolbars = false;
     mRenderOnSave = true;
     mBackupOnSave = false;
+    _compressedFSEQ = false;
+    _renderCacheEnabled = true;
     mBackupOnLaunch = true;
     me131Sync = false;
     mLocalIP = "";
@@ -1219,14 +1238,18 @@ xLightsFrame::xLightsFrame(wxWindow* parent,wxWindowID id) : mSequenceElements(t
 
     logger_base.debug("xLightsFrame constructor sequencer creation done.");
 
-    layoutPanel = new LayoutPanel(PanelPreview, this, PanelSequencer);
-    logger_base.debug("LayoutPanel creation done.");
-    FlexGridSizerPreview->Add(layoutPanel, 1, wxALL | wxEXPAND, 5);
-    FlexGridSizerPreview->Fit(PanelPreview);
-    FlexGridSizerPreview->SetSizeHints(PanelPreview);
+    modelPreview = nullptr;
+    if (!_renderMode)
+    {
+        layoutPanel = new LayoutPanel(PanelPreview, this, PanelSequencer);
+        logger_base.debug("LayoutPanel creation done.");
+        FlexGridSizerPreview->Add(layoutPanel, 1, wxALL | wxEXPAND, 5);
+        FlexGridSizerPreview->Fit(PanelPreview);
+        FlexGridSizerPreview->SetSizeHints(PanelPreview);
 
-    modelPreview = layoutPanel->GetMainPreview();
-    logger_base.debug("LayoutPanel setup done.");
+        modelPreview = layoutPanel->GetMainPreview();
+        logger_base.debug("LayoutPanel setup done.");
+    }
 
 
     playIcon = wxBitmap(control_play_blue_icon);
@@ -1371,6 +1394,11 @@ xLightsFrame::xLightsFrame(wxWindow* parent,wxWindowID id) : mSequenceElements(t
 
     config->Read("xLightsBackupSubdirectories", &_backupSubfolders, false);
     MenuItem_BackupSubfolders->Check(_backupSubfolders);
+    config->Read("xLightsCompressedFSEQ", &_compressedFSEQ, false);
+    MenuItem_CompressedFSEQ->Check(_compressedFSEQ);
+    config->Read("xLightsRenderCache", &_renderCacheEnabled, true);
+    MenuItem_RenderCache->Check(_renderCacheEnabled);
+    logger_base.debug("Render cache: %s.", _renderCacheEnabled ? "true" : "false");
 
     config->Read("xLightsRenderOnSave", &mRenderOnSave, true);
     mRenderOnSaveMenuItem->Check(mRenderOnSave);
@@ -1573,14 +1601,13 @@ xLightsFrame::xLightsFrame(wxWindow* parent,wxWindowID id) : mSequenceElements(t
     //to whatever the timing that is selected
     Timer1.Start(50, wxTIMER_CONTINUOUS);
 
-    // What makes 4 the right answer ... try 10 ... why ... usually it is one thread that runs slow and that model
-    // holds up others so in the time while we wait for the busy thread we can actually run a lot more models
-    // what is the worst that could happen ... all models want to run hard so we lose some efficiency while we churn between
-    // threads ... a minor loss of efficiency ... I think the one thread blocks the others is more common.
-    // Dan is concerned on 32 bit windows 10 will chew up too much heap memory ... so splitting the difference we get 7
-    jobPool.Start(wxThread::GetCPUCount() * 7);
+    // Render jobs no longer block a thread while waiting on the models they depend on, they park
+    // themselves and get requeued when the frames they need are done, so one thread per core keeps
+    // every core busy.  A couple of extra threads cover effects that have to wait on the main thread.
+    jobPool.Start(wxThread::GetCPUCount() + 2);
 
-    if (!xLightsApp::sequenceFiles.IsEmpty())
+    // batch renders open each sequence as they get to it
+    if (!_renderMode && !xLightsApp::sequenceFiles.IsEmpty())
     {
         logger_base.debug("Opening sequence: %s.", (const char *)xLightsApp::sequenceFiles[0].c_str());
         OpenSequence(xLightsApp::sequenceFiles[0], nullptr);
@@ -1614,6 +1641,8 @@ xLightsFrame::~xLightsFrame()
     config->Write("xLightsGridNodeValues", mGridNodeValues);
     config->Write("xLightsRenderOnSave", mRenderOnSave);
     config->Write("xLightsBackupSubdirectories", _backupSubfolders);
+    config->Write("xLightsCompressedFSEQ", _compressedFSEQ);
+    config->Write("xLightsRenderCache", _renderCacheEnabled);
     config->Write("xLightsBackupOnSave", mBackupOnSave);
     config->Write("xLightsBackupOnLaunch", mBackupOnLaunch);
     config->Write("xLightse131Sync", me131Sync);
@@ -1626,7 +1655,10 @@ xLightsFrame::~xLightsFrame()
     wxFileName kbf;
     kbf.AssignDir(CurrentDir);
     kbf.SetFullName("xlights_keybindings.xml");
-    mainSequencer->keyBindings.Save(kbf);
+    if (mainSequencer != nullptr)
+    {
+        mainSequencer->keyBindings.Save(kbf);
+    }
 
     //must call these or the app will crash on exit
     m_mgr->UnInit();
@@ -2291,10 +2323,17 @@ void xLightsFrame::SetPreviewSize(int width,int height)
 {
     SetXmlSetting("previewWidth",wxString::Format(wxT("%i"),width));
     SetXmlSetting("previewHeight",wxString::Format(wxT("%i"),height));
-    modelPreview->SetCanvasSize(width,height);
-    modelPreview->Refresh();
-    sPreview2->SetVirtualCanvasSize(width, height);
-    sPreview2->Refresh();
+    _previewSize = wxSize(width, height);
+    if (modelPreview != nullptr)
+    {
+        modelPreview->SetCanvasSize(width,height);
+        modelPreview->Refresh();
+    }
+    if (sPreview2 != nullptr)
+    {
+        sPreview2->SetVirtualCanvasSize(width, height);
+        sPreview2->Refresh();
+    }
 }
 void xLightsFrame::SetXmlSetting(const wxString& settingName,const wxString& value)
 {
@@ -2527,8 +2566,11 @@ void xLightsFrame::SetIconSize(wxCommandEvent& event)
     mGridSpacing = size;
 
     DEFAULT_ROW_HEADING_HEIGHT = size + 6;
-    mainSequencer->PanelRowHeadings->Refresh();
-    mainSequencer->PanelEffectGrid->Refresh();
+    if (mainSequencer != nullptr)
+    {
+        mainSequencer->PanelRowHeadings->Refresh();
+        mainSequencer->PanelEffectGrid->Refresh();
+    }
     GridSpacingMenu->Check(event.GetId(), true);
 }
 
@@ -2610,8 +2652,11 @@ void xLightsFrame::UpdateRenderMode()
 void xLightsFrame::SetFrequency(int frequency)
 {
     mSequenceElements.SetFrequency(frequency);
-    mainSequencer->PanelTimeLine->SetTimeFrequency(frequency);
-    mainSequencer->PanelWaveForm->SetTimeFrequency(frequency);
+    if (mainSequencer != nullptr)
+    {
+        mainSequencer->PanelTimeLine->SetTimeFrequency(frequency);
+        mainSequencer->PanelWaveForm->SetTimeFrequency(frequency);
+    }
 }
 
 void xLightsFrame::OnSetGridIconBackground(wxCommandEvent& event)
@@ -2626,8 +2671,11 @@ void xLightsFrame::OnSetGridIconBackground(wxCommandEvent& event)
     }
     MenuItemGridIconBackgroundOn->Check(mGridIconBackgrounds);
     MenuItemGridIconBackgroundOff->Check(!mGridIconBackgrounds);
-    mainSequencer->PanelEffectGrid->SetEffectIconBackground(mGridIconBackgrounds);
-    mainSequencer->PanelEffectGrid->Refresh();
+    if (mainSequencer != nullptr)
+    {
+        mainSequencer->PanelEffectGrid->SetEffectIconBackground(mGridIconBackgrounds);
+        mainSequencer->PanelEffectGrid->Refresh();
+    }
 }
 
 void xLightsFrame::OnSetGridNodeValues(wxCommandEvent& event)
@@ -2642,8 +2690,11 @@ void xLightsFrame::OnSetGridNodeValues(wxCommandEvent& event)
     }
     MenuItemGridNodeValuesOn->Check(mGridNodeValues);
     MenuItemGridNodeValuesOff->Check(!mGridNodeValues);
-    mainSequencer->PanelEffectGrid->SetEffectNodeValues(mGridNodeValues);
-    mainSequencer->PanelEffectGrid->Refresh();
+    if (mainSequencer != nullptr)
+    {
+        mainSequencer->PanelEffectGrid->SetEffectNodeValues(mGridNodeValues);
+        mainSequencer->PanelEffectGrid->Refresh();
+    }
 }
 
 
@@ -2825,7 +2876,10 @@ void xLightsFrame::CheckUnsavedChanges()
 
 void xLightsFrame::MarkEffectsFileDirty(bool modelStructureChange)
 {
-    layoutPanel->SetDirtyHiLight(true);
+    if (layoutPanel != nullptr)
+    {
+        layoutPanel->SetDirtyHiLight(true);
+    }
     UnsavedRgbEffectsChanges=true;
     if (modelStructureChange) {
         modelsChangeCount++;
@@ -2847,13 +2901,16 @@ void xLightsFrame::UpdateSequenceLength()
         SeqData.init(GetMaxNumChannels(), CurrentSeqXmlFile->GetSequenceDurationMS() / ms, ms);
         mSequenceElements.IncrementChangeCount(nullptr);
 
-        mainSequencer->PanelTimeLine->SetTimeLength(CurrentSeqXmlFile->GetSequenceDurationMS());
-        mainSequencer->PanelTimeLine->Initialize();
-        int maxZoom = mainSequencer->PanelTimeLine->GetMaxZoomLevel();
-        mainSequencer->PanelTimeLine->SetZoomLevel(maxZoom);
-        mainSequencer->PanelWaveForm->SetZoomLevel(maxZoom);
-        mainSequencer->PanelTimeLine->RaiseChangeTimeline();
-        mainSequencer->PanelWaveForm->UpdatePlayMarker();
+        if (mainSequencer != nullptr)
+        {
+            mainSequencer->PanelTimeLine->SetTimeLength(CurrentSeqXmlFile->GetSequenceDurationMS());
+            mainSequencer->PanelTimeLine->Initialize();
+            int maxZoom = mainSequencer->PanelTimeLine->GetMaxZoomLevel();
+            mainSequencer->PanelTimeLine->SetZoomLevel(maxZoom);
+            mainSequencer->PanelWaveForm->SetZoomLevel(maxZoom);
+            mainSequencer->PanelTimeLine->RaiseChangeTimeline();
+            mainSequencer->PanelWaveForm->UpdatePlayMarker();
+        }
     }
 }
 
@@ -3185,9 +3242,12 @@ void xLightsFrame::OnMenuOpenGLSelected(wxCommandEvent& event)
 void xLightsFrame::SaveWorkingLayout()
 {
     // update xml with offsets and scale
-    for (size_t i = 0; i < modelPreview->GetModels().size(); i++)
+    if (modelPreview != nullptr)
     {
-        modelPreview->GetModels()[i]->UpdateXmlWithScale();
+        for (size_t i = 0; i < modelPreview->GetModels().size(); i++)
+        {
+            modelPreview->GetModels()[i]->UpdateXmlWithScale();
+        }
     }
     SaveEffectsFile(true);
 }
@@ -3593,6 +3653,12 @@ void xLightsFrame::OnMenuItem_BackupOnLaunchSelected(wxCommandEvent& event)
     mBackupOnLaunch = event.IsChecked();
 }
 
+void xLightsFrame::OnMenuItem_RenderProfileSelected(wxCommandEvent& event)
+{
+    RenderProfileDialog dlg(this, _renderProfiler.GetResults());
+    dlg.ShowModal();
+}
+
 void xLightsFrame::OnMenuItem_ViewLogSelected(wxCommandEvent& event)
 {
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
@@ -5043,6 +5109,16 @@ void xLightsFrame::OnMenuItem_BackupSubfoldersSelected(wxCommandEvent& event)
     _backupSubfolders = MenuItem_BackupSubfolders->IsChecked();
 }
 
+void xLightsFrame::OnMenuItem_CompressedFSEQSelected(wxCommandEvent& event)
+{
+    _compressedFSEQ = MenuItem_CompressedFSEQ->IsChecked();
+}
+
+void xLightsFrame::OnMenuItem_RenderCacheSelected(wxCommandEvent& event)
+{
+    _renderCacheEnabled = MenuItem_RenderCache->IsChecked();
+}
+
 void xLightsFrame::OnMenuItem_xScheduleSelected(wxCommandEvent& event)
 {
     wxExecute("xSchedule.exe");
@@ -61,6 +61,8 @@
 #include "EffectsPanel.h"
 #include "AddShowDialog.h"
 #include "PixelBuffer.h"
+#include "RenderProfiler.h"
+#include "RenderCache.h"
 #include "ModelPreview.h"
 #include "EffectAssist.h"
 #include "SequenceData.h"
@@ -339,6 +341,7 @@ public:
     static wxString xlightsFilename; //expose current path name -DJ
     static xLightsXmlFile* CurrentSeqXmlFile; // global object for currently opened XML file
     const wxString &GetShowDirectory() const { return showDirectory; }
+    bool UseCompressedFSEQ() const { return _compressedFSEQ; }
     static wxString GetFilename() { return xlightsFilename; }
     void ConversionInit();
     void ConversionError(const wxString& msg);
@@ -483,6 +486,7 @@ private:
     void OnmExportModelsMenuItemSelected(wxCommandEvent& event);
     void OnMenuItem_BackupOnLaunchSelected(wxCommandEvent& event);
     void OnMenuItem_ViewLogSelected(wxCommandEvent& event);
+    void OnMenuItem_RenderProfileSelected(wxCommandEvent& event);
     void OnMenuItemCheckSequenceSelected(wxCommandEvent& event);
     void OnSpinCtrl_SyncUniverseChange(wxSpinEvent& event);
     void OnMenuItem_e131syncSelected(wxCommandEvent& event);
@@ -502,6 +506,8 @@ private:
     void OnMenuItemShiftEffectsSelected(wxCommandEvent& event);
     void OnMenuItem_PackageSequenceSelected(wxCommandEvent& event);
     void OnMenuItem_BackupSubfoldersSelected(wxCommandEvent& event);
+    void OnMenuItem_CompressedFSEQSelected(wxCommandEvent& event);
+    void OnMenuItem_RenderCacheSelected(wxCommandEvent& event);
     void OnMenuItem_xScheduleSelected(wxCommandEvent& event);
     void OnMenuItem_ForceLocalIPSelected(wxCommandEvent& event);
     //*)
@@ -612,6 +618,7 @@ private:
     static const long ID_MENUITEM_GenerateCustomModel;
     static const long ID_MNU_CHECKSEQ;
     static const long ID_MENU_VIEW_LOG;
+    static const long ID_MNU_RENDER_PROFILE;
     static const long ID_MENUITEM18;
     static const long ID_EXPORT_MODELS;
     static const long ID_MNU_EXPORT_EFFECTS;
@@ -652,6 +659,8 @@ private:
     static const long ID_MENU_BACKUP_ON_LAUNCH;
     static const long ID_ALT_BACKUPLOCATION;
     static const long ID_MNU_BACKUP;
+    static const long ID_MNU_COMPRESSED_FSEQ;
+    static const long ID_MNU_RENDER_CACHE;
     static const long ID_MENUITEM_ICON_SMALL;
     static const long ID_MENUITEM_ICON_MEDIUM;
     static const long ID_MENUITEM_ICON_LARGE;
@@ -735,6 +744,8 @@ private:
     wxAuiManager* MainAuiManager;
     wxMenuItem* MenuItemRenderCanvasMode;
     wxMenuItem* MenuItem_BackupSubfolders;
+    wxMenuItem* MenuItem_CompressedFSEQ;
+    wxMenuItem* MenuItem_RenderCache;
     wxStaticText* StaticTextShowEnd;
     wxMenuItem* MenuItemGridNodeValuesOn;
     wxMenu* Menu3;
@@ -847,6 +858,7 @@ private:
     wxGridBagSizer* StatusBarSizer;
     wxMenu* MenuView;
     wxMenuItem* MenuItem_ViewLog;
+    wxMenuItem* MenuItem_RenderProfile;
     wxMenu* AudioMenu;
     xlAuiToolBar* EditToolBar;
     wxMenuItem* MenuItemGridIconBackgroundOff;
@@ -879,10 +891,13 @@ private:
     wxDateTime starttime;
     play_modes play_mode;
     ModelPreview* modelPreview;
+    wxSize _previewSize; // the virtual canvas models are laid out on ... kept here as batch renders have no preview
     EffectManager effectManager;
     int effGridPrevX;
     int effGridPrevY;
     bool _backupSubfolders;
+    bool _compressedFSEQ;
+    bool _renderCacheEnabled;
 
     void DoBackup(bool prompt = true, bool startup = false, bool forceallfiles = false);
     void DoAltBackup(bool prompt = true);
@@ -950,6 +965,8 @@ public:
     bool UnsavedRgbEffectsChanges;
     unsigned int modelsChangeCount;
     bool _renderMode;
+    wxString _renderTimingsFile; // if set batch renders write their timings here as json
+    RenderProfiler& GetRenderProfiler() { return _renderProfiler; }
 
     void ClearLastPeriod();
     void WriteVirFile(const wxString& filename, long numChans, long numPeriods, SeqDataType *dataBuf); //       Vixen *.vir
@@ -1095,6 +1112,7 @@ protected:
     void SaveAsSequence();
     bool CloseSequence();
     void OpenRenderAndSaveSequences(const wxArrayString &filenames);
+    void WriteRenderTimings();
     void AddAllModelsToSequence();
     void ShowPreviewTime(long ElapsedMSec);
     void PreviewOutput(int period);
@@ -1145,11 +1163,16 @@ private:
         ~RenderTree() { Clear(); }
         void Clear();
         void Add(Model *el);
+        //works out the render order of each model once they have all been added
+        void Build();
         void Print();
 
         unsigned int renderTreeChangeCount;
         std::list<RenderTreeData*> data;
     } renderTree;
+    RenderProfiler _renderProfiler;
+    RenderCache _renderCache; // rendered models kept beside the sequence for full renders
+    std::list<std::string> _renderTimings; // json for each sequence rendered in batch mode
     int AutoSaveInterval;
 
     Model *playModel;
@@ -0,0 +1,188 @@
+#include "BlendKernels.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define XS_BLEND_AVX2
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define XS_BLEND_SSE2
+#endif
+
+template <APPLYMETHOD method>
+static inline void BlendScalar(wxByte* dst, const wxByte* src, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        switch (method)
+        {
+        case APPLYMETHOD::METHOD_OVERWRITE:
+            dst[i] = src[i];
+            break;
+        case APPLYMETHOD::METHOD_AVERAGE:
+            dst[i] = ((int)dst[i] + (int)src[i]) / 2;
+            break;
+        case APPLYMETHOD::METHOD_MASK:
+            if (src[i] > 0)
+            {
+                dst[i] = 0x00;
+            }
+            break;
+        case APPLYMETHOD::METHOD_UNMASK:
+            if (src[i] == 0)
+            {
+                dst[i] = 0x00;
+            }
+            break;
+        case APPLYMETHOD::METHOD_MAX:
+            dst[i] = std::max(dst[i], src[i]);
+            break;
+        case APPLYMETHOD::METHOD_OVERWRITEIFBLACK:
+            if (dst[i] == 0)
+            {
+                dst[i] = src[i];
+            }
+            break;
+        }
+    }
+}
+
+template <APPLYMETHOD method>
+static void Blend(wxByte* dst, const wxByte* src, size_t count)
+{
+    size_t i = 0;
+
+#ifdef XS_BLEND_AVX2
+    const __m256i zero32 = _mm256_setzero_si256();
+    const __m256i one32 = _mm256_set1_epi8(1);
+    for (; i + 32 <= count; i += 32)
+    {
+        __m256i d = _mm256_loadu_si256((const __m256i*)(dst + i));
+        __m256i s = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i r;
+        switch (method)
+        {
+        case APPLYMETHOD::METHOD_OVERWRITE:
+            r = s;
+            break;
+        case APPLYMETHOD::METHOD_AVERAGE:
+            // avg rounds up ... take off the odd bit to round down like the integer divide
+            r = _mm256_sub_epi8(_mm256_avg_epu8(d, s), _mm256_and_si256(_mm256_xor_si256(d, s), one32));
+            break;
+        case APPLYMETHOD::METHOD_MASK:
+            r = _mm256_and_si256(d, _mm256_cmpeq_epi8(s, zero32));
+            break;
+        case APPLYMETHOD::METHOD_UNMASK:
+            r = _mm256_andnot_si256(_mm256_cmpeq_epi8(s, zero32), d);
+            break;
+        case APPLYMETHOD::METHOD_MAX:
+            r = _mm256_max_epu8(d, s);
+            break;
+        default:
+            r = _mm256_or_si256(d, _mm256_and_si256(_mm256_cmpeq_epi8(d, zero32), s));
+            break;
+        }
+        _mm256_storeu_si256((__m256i*)(dst + i), r);
+    }
+#endif
+
+#ifdef XS_BLEND_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi8(1);
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+        __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i r;
+        switch (method)
+        {
+        case APPLYMETHOD::METHOD_OVERWRITE:
+            r = s;
+            break;
+        case APPLYMETHOD::METHOD_AVERAGE:
+            r = _mm_sub_epi8(_mm_avg_epu8(d, s), _mm_and_si128(_mm_xor_si128(d, s), one));
+            break;
+        case APPLYMETHOD::METHOD_MASK:
+            r = _mm_and_si128(d, _mm_cmpeq_epi8(s, zero));
+            break;
+        case APPLYMETHOD::METHOD_UNMASK:
+            r = _mm_andnot_si128(_mm_cmpeq_epi8(s, zero), d);
+            break;
+        case APPLYMETHOD::METHOD_MAX:
+            r = _mm_max_epu8(d, s);
+            break;
+        default:
+            // where dst is black it is zero so or-ing in src is an overwrite
+            r = _mm_or_si128(d, _mm_and_si128(_mm_cmpeq_epi8(d, zero), s));
+            break;
+        }
+        _mm_storeu_si128((__m128i*)(dst + i), r);
+    }
+#endif
+
+    BlendScalar<method>(dst + i, src + i, count - i);
+}
+
+void BlendChannels(wxByte* dst, const wxByte* src, size_t count, APPLYMETHOD applyMethod)
+{
+    switch (applyMethod)
+    {
+    case APPLYMETHOD::METHOD_OVERWRITE:
+        memcpy(dst, src, count);
+        break;
+    case APPLYMETHOD::METHOD_AVERAGE:
+        Blend<APPLYMETHOD::METHOD_AVERAGE>(dst, src, count);
+        break;
+    case APPLYMETHOD::METHOD_MASK:
+        Blend<APPLYMETHOD::METHOD_MASK>(dst, src, count);
+        break;
+    case APPLYMETHOD::METHOD_UNMASK:
+        Blend<APPLYMETHOD::METHOD_UNMASK>(dst, src, count);
+        break;
+    case APPLYMETHOD::METHOD_MAX:
+        Blend<APPLYMETHOD::METHOD_MAX>(dst, src, count);
+        break;
+    case APPLYMETHOD::METHOD_OVERWRITEIFBLACK:
+        Blend<APPLYMETHOD::METHOD_OVERWRITEIFBLACK>(dst, src, count);
+        break;
+    }
+}
+
+void BlendChannelsScalar(wxByte* dst, const wxByte* src, size_t count, APPLYMETHOD applyMethod)
+{
+    switch (applyMethod)
+    {
+    case APPLYMETHOD::METHOD_OVERWRITE:
+        BlendScalar<APPLYMETHOD::METHOD_OVERWRITE>(dst, src, count);
+        break;
+    case APPLYMETHOD::METHOD_AVERAGE:
+        BlendScalar<APPLYMETHOD::METHOD_AVERAGE>(dst, src, count);
+        break;
+    case APPLYMETHOD::METHOD_MASK:
+        BlendScalar<APPLYMETHOD::METHOD_MASK>(dst, src, count);
+        break;
+    case APPLYMETHOD::METHOD_UNMASK:
+        BlendScalar<APPLYMETHOD::METHOD_UNMASK>(dst, src, count);
+        break;
+    case APPLYMETHOD::METHOD_MAX:
+        BlendScalar<APPLYMETHOD::METHOD_MAX>(dst, src, count);
+        break;
+    case APPLYMETHOD::METHOD_OVERWRITEIFBLACK:
+        BlendScalar<APPLYMETHOD::METHOD_OVERWRITEIFBLACK>(dst, src, count);
+        break;
+    }
+}
+
+const char* GetBlendKernelName()
+{
+#if defined(XS_BLEND_AVX2)
+    return "AVX2";
+#elif defined(XS_BLEND_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
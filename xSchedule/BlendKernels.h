@@ -0,0 +1,35 @@
+#ifndef BLENDKERNELS_H
+#define BLENDKERNELS_H
+
+#include <wx/wx.h>
+
+#ifndef APPLYMETHOD_DEF
+#define APPLYMETHOD_DEF
+typedef enum {
+	METHOD_OVERWRITE,
+	METHOD_OVERWRITEIFBLACK,
+	METHOD_MASK,
+	METHOD_UNMASK,
+	METHOD_AVERAGE,
+	METHOD_MAX
+} APPLYMETHOD;
+#endif
+
+// ******************************************************
+// * Applies a run of channels onto the frame buffer using
+// * one of the playlist item apply methods. The vector
+// * versions work 16 or 32 channels at a time and give
+// * exactly the same bytes as the scalar version. Which one
+// * is used is decided when xSchedule is compiled.
+// ******************************************************
+
+// dst[i] = apply(dst[i], src[i]) for count channels
+void BlendChannels(wxByte* dst, const wxByte* src, size_t count, APPLYMETHOD applyMethod);
+
+// one channel at a time ... the reference for the vector versions
+void BlendChannelsScalar(wxByte* dst, const wxByte* src, size_t count, APPLYMETHOD applyMethod);
+
+// the instruction set BlendChannels was built for
+const char* GetBlendKernelName();
+
+#endif
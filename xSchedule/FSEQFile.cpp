@@ -1,8 +1,20 @@
 #include "FSEQFile.h"
+#include "BlendKernels.h"
 #include <wx/file.h>
 #include <log4cpp/Category.hh>
 #include <wx/filename.h>
 
+#ifdef __WXMSW__
+#include <windows.h>
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// how many frames ahead of the one being played we ask the OS to start reading
+#define FSEQ_PREFETCH_FRAMES 20
+
 FSEQFile::FSEQFile()
 {
     _audiofilename = "";
@@ -18,6 +30,12 @@ FSEQFile::FSEQFile()
     _gamma = 255;
     _frame0Offset = 0;
     _currentFrame = 0;
+    _mappedData = nullptr;
+    _mappedSize = 0;
+    _mappedFrames = 0;
+    _prefetchedTo = 0;
+    _mapHandle = nullptr;
+    _blockIndex = -1;
     _ok = false;
 }
 
@@ -36,6 +54,12 @@ FSEQFile::FSEQFile(const std::string& filename)
     _gamma = 255;
     _frame0Offset = 0;
     _currentFrame = 0;
+    _mappedData = nullptr;
+    _mappedSize = 0;
+    _mappedFrames = 0;
+    _prefetchedTo = 0;
+    _mapHandle = nullptr;
+    _blockIndex = -1;
     _ok = true;
     Load(filename);
 }
@@ -68,6 +92,8 @@ std::list<std::string> FSEQFile::GetBlendModes()
 
 void FSEQFile::Close()
 {
+    UnmapFile();
+
     if (_fh != nullptr)
     {
         _fh->Close();
@@ -84,6 +110,9 @@ void FSEQFile::Close()
         _frameBuffer = nullptr;
     }
 
+    _block.clear();
+    _blockIndex = -1;
+
     _ok = false;
 }
 
@@ -128,33 +157,51 @@ void FSEQFile::Load(const std::string& filename)
             _frame0Offset = ReadInt16(_fh);
             _fh->Read(&_minorVersion, sizeof(_minorVersion));
             _fh->Read(&_majorVersion, sizeof(_majorVersion));
-            int fixedheader = ReadInt16(_fh); // fixed header length
-            _channelsPerFrame = ReadInt32(_fh);
-            _frames = ReadInt32(_fh);
-            _frameMS = ReadInt16(_fh);
-            int universes = ReadInt16(_fh); // universes
-            int usize  = ReadInt16(_fh); // universe size
-            _gamma = _fh->Read(&_gamma, sizeof(_gamma));
-            _fh->Read(&_colourEncoding, sizeof(_colourEncoding));
-            int fill = ReadInt16(_fh); // fill
-            if (_frame0Offset > 28)
+            if (_majorVersion == 2)
+            {
+                if (!LoadV2Header())
+                {
+                    logger_base.error("FSEQ file %s version 2 header does not look valid.", (const char *)filename.c_str());
+                    Close();
+                    return;
+                }
+            }
+            else
             {
-                int mediafilenamelength = ReadInt16(_fh);
-                if (mediafilenamelength > 0)
+                int fixedheader = ReadInt16(_fh); // fixed header length
+                _channelsPerFrame = ReadInt32(_fh);
+                _frames = ReadInt32(_fh);
+                _frameMS = ReadInt16(_fh);
+                int universes = ReadInt16(_fh); // universes
+                int usize  = ReadInt16(_fh); // universe size
+                _gamma = _fh->Read(&_gamma, sizeof(_gamma));
+                _fh->Read(&_colourEncoding, sizeof(_colourEncoding));
+                int fill = ReadInt16(_fh); // fill
+                if (_frame0Offset > 28)
                 {
-                    char* buf = (char*)malloc(mediafilenamelength + 1);
-                    memset(buf, 0x00, mediafilenamelength + 1);
-                    ReadInt16(_fh); // mf
-                    _fh->Read(buf, mediafilenamelength);
-                    _audiofilename = std::string(buf);
-                    _audiofilename = FSEQFile::FixFile("", _audiofilename);
-                    free(buf);
+                    int mediafilenamelength = ReadInt16(_fh);
+                    if (mediafilenamelength > 0)
+                    {
+                        char* buf = (char*)malloc(mediafilenamelength + 1);
+                        memset(buf, 0x00, mediafilenamelength + 1);
+                        ReadInt16(_fh); // mf
+                        _fh->Read(buf, mediafilenamelength);
+                        _audiofilename = std::string(buf);
+                        _audiofilename = FSEQFile::FixFile("", _audiofilename);
+                        free(buf);
+                    }
                 }
             }
             _currentFrame = 0;
             _frameBuffer = (wxByte*)malloc(_channelsPerFrame);
+            _blockIndex = -1;
+            // compressed and sparse files cant be played straight out of the file
+            if (_majorVersion != 2 || (_v2Header.compression == FSEQ_COMPRESS_NONE && _v2Header.ranges.empty()))
+            {
+                MapFile();
+            }
 
-            logger_base.info("FSEQ file %s opened.", (const char *)filename.c_str());
+            logger_base.info("FSEQ file %s opened%s.", (const char *)filename.c_str(), IsMapped() ? " memory mapped" : "");
             _ok = true;
         }
         else
@@ -170,72 +217,197 @@ void FSEQFile::Load(const std::string& filename)
     }
 }
 
-void FSEQFile::ReadData(wxByte* buffer, size_t buffersize, size_t frame, APPLYMETHOD applyMethod, size_t offset, size_t channels)
+// Version 2 headers are variable length so read the whole thing and let the shared parser make sense of it
+bool FSEQFile::LoadV2Header()
+{
+    std::vector<wxByte> header(_frame0Offset);
+    _fh->Seek(0);
+    if (_fh->Read(header.data(), header.size()) != (ssize_t)header.size()) return false;
+    if (!_v2Header.Parse(header.data(), header.size())) return false;
+
+    _channelsPerFrame = _v2Header.channels;
+    _frames = _v2Header.frames;
+    _frameMS = _v2Header.frameMS;
+    _frame0Offset = _v2Header.channelDataOffset;
+    _audiofilename = FSEQFile::FixFile("", _v2Header.mediaFilename);
+    return true;
+}
+
+// Compressed files are decompressed a block at a time ... the block index in the header means we can
+// jump straight to the block holding any frame
+const wxByte* FSEQFile::GetV2Frame(size_t frame, size_t offset, size_t channels)
+{
+    size_t storedFrameSize = _v2Header.GetStoredFrameSize();
+    const wxByte* stored = nullptr;
+
+    if (_v2Header.compression == FSEQ_COMPRESS_NONE)
+    {
+        _block.resize(storedFrameSize);
+        _fh->Seek(_frame0Offset + storedFrameSize * frame);
+        if (_fh->Read(_block.data(), storedFrameSize) != (ssize_t)storedFrameSize) return nullptr;
+        _blockIndex = -1;
+        stored = _block.data();
+    }
+    else
+    {
+        int block = _v2Header.FindBlock(frame);
+        if (block < 0) return nullptr;
+
+        if (block != _blockIndex)
+        {
+            if (!_v2Header.ReadBlock(*_fh, block, _block))
+            {
+                _blockIndex = -1;
+                return nullptr;
+            }
+            _blockIndex = block;
+        }
+        stored = _block.data() + storedFrameSize * (frame - _v2Header.blocks[block].firstFrame);
+    }
+
+    _v2Header.ExpandFrame(stored, _frameBuffer, offset, channels);
+    return _frameBuffer;
+}
+
+// Maps the whole file into memory so playing a frame is just a pointer into the mapping. Only the pages
+// holding the channels an item actually uses ever get read from disk. If the file cant be mapped (eg too
+// big for a 32 bit address space) we fall back to reading from the file.
+void FSEQFile::MapFile()
 {
-    if (frame >= _frames) return; // cant read past end of file
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (_fh == nullptr || _channelsPerFrame == 0) return;
 
-    if (frame != _currentFrame)
+    wxFileOffset length = _fh->Length();
+    if (length <= (wxFileOffset)_frame0Offset || (unsigned long long)length > (unsigned long long)SIZE_MAX) return;
+
+#ifdef __WXMSW__
+    HANDLE fh = (HANDLE)_get_osfhandle(_fh->fd());
+    HANDLE map = CreateFileMapping(fh, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (map == nullptr)
+    {
+        logger_base.warn("FSEQ file %s could not be memory mapped. Reading from disk instead.", (const char *)_filename.c_str());
+        return;
+    }
+    void* data = MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0);
+    if (data == nullptr)
     {
-        // we need to seek to our frame
-        _fh->Seek(_frame0Offset + _channelsPerFrame * frame);
+        CloseHandle(map);
+        logger_base.warn("FSEQ file %s could not be memory mapped. Reading from disk instead.", (const char *)_filename.c_str());
+        return;
     }
+    _mapHandle = map;
+#else
+    void* data = mmap(nullptr, (size_t)length, PROT_READ, MAP_SHARED, _fh->fd(), 0);
+    if (data == MAP_FAILED)
+    {
+        logger_base.warn("FSEQ file %s could not be memory mapped. Reading from disk instead.", (const char *)_filename.c_str());
+        return;
+    }
+    // we do our own read ahead of just the channels being played so stop the OS reading whole frames
+    madvise(data, (size_t)length, MADV_RANDOM);
+#endif
+
+    _mappedData = (wxByte*)data;
+    _mappedSize = (size_t)length;
+    // a truncated file only plays the frames it actually holds
+    _mappedFrames = std::min(_frames, (_mappedSize - _frame0Offset) / _channelsPerFrame);
+    _prefetchedTo = 0;
+}
+
+void FSEQFile::UnmapFile()
+{
+    if (_mappedData != nullptr)
+    {
+#ifdef __WXMSW__
+        UnmapViewOfFile(_mappedData);
+        CloseHandle((HANDLE)_mapHandle);
+        _mapHandle = nullptr;
+#else
+        munmap(_mappedData, _mappedSize);
+#endif
+        _mappedData = nullptr;
+        _mappedSize = 0;
+        _mappedFrames = 0;
+        _prefetchedTo = 0;
+    }
+}
 
-    // read in the frame from disk
-    _fh->Read(_frameBuffer, _channelsPerFrame);
-    _currentFrame = frame + 1;
+// Ask the OS to start loading the channels we are going to need for the next few frames so a slow disk
+// has time to deliver them before the frame is due
+void FSEQFile::Prefetch(size_t frame, size_t offset, size_t bytes)
+{
+#ifndef __WXMSW__
+    if (bytes == 0) return;
+
+    // frames we have already asked for in an earlier call dont need asking for again
+    size_t first = frame + 1;
+    size_t last = std::min(frame + 1 + FSEQ_PREFETCH_FRAMES, _mappedFrames);
+    if (_prefetchedTo > first && _prefetchedTo <= last) first = _prefetchedTo;
+
+    static const size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    for (size_t f = first; f < last; f++)
+    {
+        size_t start = _frame0Offset + _channelsPerFrame * f + offset;
+        size_t alignedStart = start - (start % pageSize);
+        madvise(_mappedData + alignedStart, start + bytes - alignedStart, MADV_WILLNEED);
+    }
+    _prefetchedTo = last;
+#endif
+}
 
-    size_t bytesToUse = std::min(buffersize, _channelsPerFrame);
+const wxByte* FSEQFile::GetFrame(size_t frame, size_t offset, size_t channels)
+{
+    if (offset >= _channelsPerFrame) return nullptr;
 
+    size_t bytes = _channelsPerFrame - offset;
     if (channels > 0)
     {
-        bytesToUse = std::min(bytesToUse, channels);
+        bytes = std::min(bytes, channels);
     }
 
-    switch(applyMethod)
+    if (_majorVersion == 2 && _mappedData == nullptr)
     {
-    case APPLYMETHOD::METHOD_OVERWRITE:
-        memcpy(buffer+offset, _frameBuffer+offset, bytesToUse);
-        break;
-    case APPLYMETHOD::METHOD_AVERAGE:
-        for (size_t i = 0; i < bytesToUse; i++)
-        {
-            *(buffer + i + offset) = ((int)*(buffer + i + offset) + (int)*(_frameBuffer + i + offset)) / 2;
-        }
-        break;
-    case APPLYMETHOD::METHOD_MASK:
-        for (size_t i = 0; i < bytesToUse; i++)
-        {
-            if (*(_frameBuffer + i + offset) > 0)
-            {
-                *(buffer + i + offset) = 0x00;
-            }
-        }
-        break;
-    case APPLYMETHOD::METHOD_UNMASK:
-        for (size_t i = 0; i < bytesToUse; i++)
-        {
-            if (*(_frameBuffer + i + offset) == 0)
-            {
-                *(buffer + i + offset) = 0x00;
-            }
-        }
-        break;
-    case APPLYMETHOD::METHOD_MAX:
-        for (size_t i = 0; i < bytesToUse; i++)
-        {
-            *(buffer + i + offset) = std::max(*(buffer + i + offset), *(_frameBuffer + i + offset));
-        }
-        break;
-    case APPLYMETHOD::METHOD_OVERWRITEIFBLACK:
-        for (size_t i = 0; i < bytesToUse; i++)
-        {
-            if (*(buffer + i + offset) == 0)
-            {
-                *(buffer + i + offset) = *(_frameBuffer + i + offset);
-            }
-        }
-        break;
+        if (frame >= _frames || _fh == nullptr) return nullptr;
+        return GetV2Frame(frame, offset, bytes);
+    }
+
+    if (_mappedData != nullptr)
+    {
+        if (frame >= _mappedFrames) return nullptr;
+        Prefetch(frame, offset, bytes);
+        return _mappedData + _frame0Offset + _channelsPerFrame * frame;
     }
+
+    if (frame >= _frames || _fh == nullptr) return nullptr;
+
+    // only read the channels we were asked for
+    size_t pos = _frame0Offset + _channelsPerFrame * frame + offset;
+    if (frame != _currentFrame || offset != 0 || bytes != _channelsPerFrame)
+    {
+        _fh->Seek(pos);
+    }
+    _fh->Read(_frameBuffer + offset, bytes);
+    _currentFrame = (offset + bytes == _channelsPerFrame) ? frame + 1 : _frames;
+
+    return _frameBuffer;
+}
+
+void FSEQFile::ReadData(wxByte* buffer, size_t buffersize, size_t frame, APPLYMETHOD applyMethod, size_t offset, size_t channels)
+{
+    if (frame >= _frames || offset >= _channelsPerFrame || offset >= buffersize) return; // cant read past end of file
+
+    size_t bytesToUse = std::min(buffersize, _channelsPerFrame) - offset;
+
+    if (channels > 0)
+    {
+        bytesToUse = std::min(bytesToUse, channels);
+    }
+
+    const wxByte* frameData = GetFrame(frame, offset, bytesToUse);
+    if (frameData == nullptr) return;
+
+    BlendChannels(buffer + offset, frameData + offset, bytesToUse, applyMethod);
 }
 
 std::string FSEQFile::FixFile(const std::string& ShowDir, const std::string& file, bool recurse)
@@ -4,6 +4,8 @@
 #include <wx/wx.h>
 #include <string>
 #include <list>
+#include <vector>
+#include "../xLights/FSEQFormat.h"
 
 #ifndef APPLYMETHOD_DEF
 #define APPLYMETHOD_DEF
@@ -35,6 +37,20 @@ class FSEQFile
     size_t _frame0Offset;
     size_t _currentFrame;
     wxByte* _frameBuffer;
+    wxByte* _mappedData;
+    size_t _mappedSize;
+    size_t _mappedFrames;
+    size_t _prefetchedTo;
+    void* _mapHandle;
+    FSEQV2Header _v2Header;
+    std::vector<wxByte> _block;
+    int _blockIndex;
+
+    void MapFile();
+    void UnmapFile();
+    void Prefetch(size_t frame, size_t offset, size_t bytes);
+    bool LoadV2Header();
+    const wxByte* GetV2Frame(size_t frame, size_t offset, size_t channels);
 
     public:
 
@@ -53,6 +69,10 @@ class FSEQFile
 		std::string GetAudioFileName() const { return _audiofilename; }
 		int GetLengthFrames() const { return _frames; }
 		void ReadData(wxByte* buffer, size_t buffersize, size_t frame, APPLYMETHOD applyMethod, size_t offset, size_t channels);
+        // Returns the frame laid out as a full frame of channels without copying it when the file is mapped.
+        // Only channels offset to offset+channels are guaranteed to be valid and only until the next call.
+        const wxByte* GetFrame(size_t frame, size_t offset = 0, size_t channels = 0);
+        bool IsMapped() const { return _mappedData != nullptr; }
 		bool IsOk() const { return _ok; }
 		size_t GetChannels() const { return _channelsPerFrame; }
         void Close();
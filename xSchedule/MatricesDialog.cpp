@@ -1,4 +1,5 @@
 #include "MatricesDialog.h"
+#include "PlaybackEngine.h"
 #include "MatrixMapper.h"
 #include "MatrixDialog.h"
 
@@ -123,6 +124,8 @@ void MatricesDialog::OnButton_DeleteClick(wxCommandEvent& event)
 
 void MatricesDialog::OnButton_OkClick(wxCommandEvent& event)
 {
+    PlaybackLock lock;
+
     while (_matrices->size() > 0)
     {
         auto todelete = _matrices->front();
@@ -1,6 +1,7 @@
 #include "OptionsDialog.h"
 
 #include "ScheduleOptions.h"
+#include "PlaybackEngine.h"
 #include "ButtonDetailsDialog.h"
 #include "ProjectorDetailsDialog.h"
 #include "UserButton.h"
@@ -249,6 +250,8 @@ OptionsDialog::~OptionsDialog()
 
 void OptionsDialog::OnButton_OkClick(wxCommandEvent& event)
 {
+    PlaybackLock lock;
+
     _options->SetSync(CheckBox_Sync->GetValue());
     _options->SetSendOffWhenNotRunning(CheckBox_SendOffWhenNotRunning->GetValue());
     _options->SetWebServerPort(SpinCtrl_WebServerPort->GetValue());
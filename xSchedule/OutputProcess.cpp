@@ -5,11 +5,17 @@
 #include "OutputProcessDimWhite.h"
 #include "OutputProcessSet.h"
 #include "OutputProcessRemap.h"
+#include "OutputProcessPipeline.h"
+
+#include <atomic>
+
+static std::atomic<unsigned int> __nextSerial(1);
 
 OutputProcess::OutputProcess(wxXmlNode* node)
 {
     _changeCount = 0;
     _lastSavedChangeCount = 0;
+    _serial = __nextSerial++;
     _startChannel = wxAtol(node->GetAttribute("StartChannel", "1"));
     _description = node->GetAttribute("Description", "").ToStdString();
 }
@@ -19,6 +25,7 @@ OutputProcess::OutputProcess(const OutputProcess& op)
     _description = op._description;
     _changeCount = op._changeCount;
     _lastSavedChangeCount = op._lastSavedChangeCount;
+    _serial = __nextSerial++;
     _startChannel = op._startChannel;
 }
 
@@ -26,6 +33,7 @@ OutputProcess::OutputProcess()
 {
     _changeCount = 1;
     _lastSavedChangeCount = 0;
+    _serial = __nextSerial++;
     _startChannel = 1;
     _description = "";
 }
@@ -34,6 +42,7 @@ OutputProcess::OutputProcess(size_t startChannel, const std::string& description
 {
     _changeCount = 1;
     _lastSavedChangeCount = 0;
+    _serial = __nextSerial++;
     _startChannel = startChannel;
     _description = description;
 }
@@ -64,3 +73,8 @@ OutputProcess* OutputProcess::CreateFromXml(wxXmlNode* node)
     }
     return nullptr;
 }
+
+void OutputProcess::Compile(OutputProcessPipeline& pipeline, size_t size)
+{
+    pipeline.AddPass(this);
+}
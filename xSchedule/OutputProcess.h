@@ -5,6 +5,7 @@
 #include <wx/wx.h>
 
 class wxXmlNode;
+class OutputProcessPipeline;
 
 class OutputProcess
 {
@@ -14,6 +15,7 @@ class OutputProcess
         size_t _startChannel;
         int _changeCount;
         int _lastSavedChangeCount;
+        unsigned int _serial;
 
     void Save(wxXmlNode* node);
 
@@ -30,12 +32,18 @@ class OutputProcess
         std::string GetDescription() const { return _description; }
         virtual ~OutputProcess() {}
         virtual wxXmlNode* Save() = 0;
+        // every process made gets a new serial ... the dialog replaces processes rather than editing
+        // them so serial and change count together tell the pipeline whether it must recompile
+        unsigned int GetSerial() const { return _serial; }
+        int GetChangeCount() const { return _changeCount; }
         size_t GetStartChannel() const { return _startChannel; }
         virtual size_t GetP1() const = 0;
         virtual size_t GetP2() const = 0;
         virtual std::string GetType() const = 0;
 
         virtual void Frame(wxByte* buffer, size_t size) = 0;
+        // adds what Frame does to the pipeline ... by default Frame gets its own pass
+        virtual void Compile(OutputProcessPipeline& pipeline, size_t size);
 };
 
 #endif
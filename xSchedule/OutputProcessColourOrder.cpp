@@ -1,4 +1,5 @@
 #include "OutputProcessColourOrder.h"
+#include "OutputProcessPipeline.h"
 #include <wx/xml/xml.h>
 
 OutputProcessColourOrder::OutputProcessColourOrder(wxXmlNode* node) : OutputProcess(node)
@@ -76,3 +77,32 @@ void OutputProcessColourOrder::Frame(wxByte* buffer, size_t size)
 		}
     }
 }
+
+void OutputProcessColourOrder::Compile(OutputProcessPipeline& pipeline, size_t size)
+{
+    if (_colourOrder == 123 || _startChannel < 1 || _startChannel > size) return;
+
+    // where each of the three output channels comes from
+    int order[3];
+    switch (_colourOrder)
+    {
+    case 132: order[0] = 0; order[1] = 2; order[2] = 1; break;
+    case 213: order[0] = 1; order[1] = 0; order[2] = 2; break;
+    case 231: order[0] = 1; order[1] = 2; order[2] = 0; break;
+    case 312: order[0] = 2; order[1] = 0; order[2] = 1; break;
+    case 321: order[0] = 2; order[1] = 1; order[2] = 0; break;
+    default: return;
+    }
+
+    size_t nodes = std::min(_nodes, (size - (_startChannel - 1)) / 3);
+
+    std::vector<size_t> sources(nodes * 3);
+    for (size_t i = 0; i < nodes; i++)
+    {
+        size_t p = (_startChannel - 1) + i * 3;
+        sources[i * 3] = p + order[0];
+        sources[i * 3 + 1] = p + order[1];
+        sources[i * 3 + 2] = p + order[2];
+    }
+    pipeline.ReorderChannels(_startChannel - 1, sources);
+}
@@ -17,6 +17,7 @@ class OutputProcessColourOrder : public OutputProcess
         virtual ~OutputProcessColourOrder() {}
         virtual wxXmlNode* Save() override;
         virtual void Frame(wxByte* buffer, size_t size) override;
+        virtual void Compile(OutputProcessPipeline& pipeline, size_t size) override;
         virtual size_t GetP1() const override { return _nodes; }
         virtual size_t GetP2() const override { return _colourOrder; }
         virtual std::string GetType() const override { return "Colour Order"; }
@@ -1,4 +1,5 @@
 #include "OutputProcessDim.h"
+#include "OutputProcessPipeline.h"
 #include <wx/xml/xml.h>
 
 OutputProcessDim::OutputProcessDim(wxXmlNode* node) : OutputProcess(node)
@@ -52,3 +53,23 @@ void OutputProcessDim::Frame(wxByte* buffer, size_t size)
         *(buffer + i + _startChannel - 1) = (*(buffer + i + _startChannel - 1) * _dim) / 100;
     }
 }
+
+void OutputProcessDim::Compile(OutputProcessPipeline& pipeline, size_t size)
+{
+    if (_dim == 100 || _startChannel < 1 || _startChannel > size) return;
+
+    size_t chs = std::min(_channels, size - (_startChannel - 1));
+
+    if (_dim == 0)
+    {
+        pipeline.SetChannels(_startChannel - 1, chs, 0x00);
+        return;
+    }
+
+    std::array<wxByte, 256> lut;
+    for (int i = 0; i < 256; i++)
+    {
+        lut[i] = (i * _dim) / 100;
+    }
+    pipeline.MapChannels(_startChannel - 1, chs, lut);
+}
@@ -0,0 +1,355 @@
+#include "OutputProcessPipeline.h"
+#include "OutputProcess.h"
+
+#include <cstring>
+#include <log4cpp/Category.hh>
+
+#pragma region Constructors and Destructors
+OutputProcessPipeline::OutputProcessPipeline()
+{
+    _size = 0;
+    _stageChanged = false;
+}
+#pragma endregion Constructors and Destructors
+
+bool OutputProcessPipeline::IsCurrent(const std::list<OutputProcess*>& processes, size_t size) const
+{
+    if (size != _size || processes.size() != _key.size()) return false;
+
+    auto k = _key.begin();
+    for (auto it = processes.begin(); it != processes.end(); ++it)
+    {
+        Key key = { (*it)->GetSerial(), (*it)->GetChangeCount() };
+        if (!(key == *k)) return false;
+        ++k;
+    }
+
+    return true;
+}
+
+void OutputProcessPipeline::Compile(const std::list<OutputProcess*>& processes, size_t size)
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    _steps.clear();
+    _segments.clear();
+    _indexes.clear();
+    _luts.clear();
+    _lutIds.clear();
+    _composed.clear();
+
+    std::array<wxByte, 256> identity;
+    for (size_t i = 0; i < 256; i++)
+    {
+        identity[i] = i;
+    }
+    AddLUT(identity);
+
+    _size = size;
+    _key.clear();
+    _stageChanged = true;
+    StartStage();
+    for (auto it = processes.begin(); it != processes.end(); ++it)
+    {
+        Key key = { (*it)->GetSerial(), (*it)->GetChangeCount() };
+        _key.push_back(key);
+        (*it)->Compile(*this, size);
+    }
+    EndStage();
+
+    // the stage is only needed while compiling
+    std::vector<size_t>().swap(_source);
+    std::vector<int>().swap(_lut);
+    std::vector<wxByte>().swap(_value);
+    std::vector<bool>().swap(_constant);
+    std::vector<size_t>().swap(_scratchSource);
+    std::vector<int>().swap(_scratchLut);
+    std::vector<wxByte>().swap(_scratchValue);
+    std::vector<bool>().swap(_scratchConstant);
+    _lutIds.clear();
+    _composed.clear();
+
+    logger_base.debug("Output processing compiled %d processes over %d channels into %d steps, %d segments and %d lookup tables.",
+        (int)processes.size(), (int)size, (int)_steps.size(), (int)_segments.size(), (int)_luts.size());
+}
+
+void OutputProcessPipeline::Frame(const std::list<OutputProcess*>& processes, wxByte* buffer, size_t size)
+{
+    if (processes.size() == 0) return;
+
+    if (!IsCurrent(processes, size))
+    {
+        Compile(processes, size);
+    }
+
+    for (auto step = _steps.begin(); step != _steps.end(); ++step)
+    {
+        if (step->pass != nullptr)
+        {
+            step->pass->Frame(buffer, size);
+            continue;
+        }
+
+        // channels may read from channels written earlier in the step so they must see the frame as it was
+        const wxByte* in = buffer;
+        if (step->needsSnapshot)
+        {
+            _snapshot.resize(size);
+            memcpy(&_snapshot[0], buffer, size);
+            in = &_snapshot[0];
+        }
+
+        for (size_t s = step->firstSegment; s < step->firstSegment + step->segments; s++)
+        {
+            const Segment& seg = _segments[s];
+            wxByte* out = buffer + seg.start;
+
+            switch (seg.type)
+            {
+            case SEGMENTTYPE::SET:
+                memset(out, seg.value, seg.count);
+                break;
+            case SEGMENTTYPE::COPY:
+                memcpy(out, in + seg.source, seg.count);
+                break;
+            case SEGMENTTYPE::MAP:
+                {
+                    const wxByte* lut = _luts[seg.lut].data();
+                    const wxByte* from = in + seg.source;
+                    for (size_t i = 0; i < seg.count; i++)
+                    {
+                        out[i] = lut[from[i]];
+                    }
+                }
+                break;
+            case SEGMENTTYPE::GATHER:
+                {
+                    const wxByte* lut = _luts[seg.lut].data();
+                    const size_t* index = &_indexes[seg.source];
+                    for (size_t i = 0; i < seg.count; i++)
+                    {
+                        out[i] = lut[in[index[i]]];
+                    }
+                }
+                break;
+            }
+        }
+    }
+}
+
+#pragma region Stages
+void OutputProcessPipeline::StartStage()
+{
+    if (!_stageChanged) return;
+
+    _source.resize(_size);
+    _lut.assign(_size, 0);
+    _value.assign(_size, 0);
+    _constant.assign(_size, false);
+    for (size_t c = 0; c < _size; c++)
+    {
+        _source[c] = c;
+    }
+    _stageChanged = false;
+}
+
+void OutputProcessPipeline::EndStage()
+{
+    if (!_stageChanged) return;
+
+    Step step;
+    step.pass = nullptr;
+    step.firstSegment = _segments.size();
+    step.needsSnapshot = false;
+
+    size_t c = 0;
+    while (c < _size)
+    {
+        if (!_constant[c] && _source[c] == c && _lut[c] == 0)
+        {
+            // untouched
+            c++;
+            continue;
+        }
+
+        Segment seg;
+        seg.start = c;
+        seg.lut = _lut[c];
+        seg.value = _value[c];
+        seg.source = _source[c];
+
+        size_t e = c + 1;
+        if (_constant[c])
+        {
+            while (e < _size && _constant[e] && _value[e] == seg.value) e++;
+            seg.type = SEGMENTTYPE::SET;
+        }
+        else
+        {
+            while (e < _size && !_constant[e] && _lut[e] == seg.lut && _source[e] == seg.source + (e - c)) e++;
+
+            if (e - c == 1 && seg.source != c)
+            {
+                // a lone channel from somewhere else ... join it to the gather before it if we can
+                step.needsSnapshot = true;
+                if (_segments.size() > step.firstSegment)
+                {
+                    Segment& last = _segments.back();
+                    if (last.type == SEGMENTTYPE::GATHER && last.lut == seg.lut && last.start + last.count == c)
+                    {
+                        _indexes.push_back(seg.source);
+                        last.count++;
+                        c = e;
+                        continue;
+                    }
+                }
+                seg.type = SEGMENTTYPE::GATHER;
+                seg.source = _indexes.size();
+                _indexes.push_back(_source[c]);
+            }
+            else
+            {
+                if (seg.source != c) step.needsSnapshot = true;
+                seg.type = seg.lut == 0 ? SEGMENTTYPE::COPY : SEGMENTTYPE::MAP;
+            }
+        }
+        seg.count = e - c;
+        _segments.push_back(seg);
+        c = e;
+    }
+
+    step.segments = _segments.size() - step.firstSegment;
+    if (step.segments > 0)
+    {
+        _steps.push_back(step);
+    }
+}
+
+void OutputProcessPipeline::SaveStage(size_t start, size_t count)
+{
+    _scratchSource.assign(_source.begin() + start, _source.begin() + start + count);
+    _scratchLut.assign(_lut.begin() + start, _lut.begin() + start + count);
+    _scratchValue.assign(_value.begin() + start, _value.begin() + start + count);
+    _scratchConstant.assign(_constant.begin() + start, _constant.begin() + start + count);
+}
+#pragma endregion Stages
+
+#pragma region Lookup Tables
+int OutputProcessPipeline::AddLUT(const std::array<wxByte, 256>& lut)
+{
+    auto it = _lutIds.find(lut);
+    if (it != _lutIds.end()) return it->second;
+
+    int id = _luts.size();
+    _luts.push_back(lut);
+    _lutIds[lut] = id;
+    return id;
+}
+
+// the table for applying inner then outer
+int OutputProcessPipeline::ComposeLUT(int outer, int inner)
+{
+    if (inner == 0) return outer;
+    if (outer == 0) return inner;
+
+    auto key = std::make_pair(outer, inner);
+    auto it = _composed.find(key);
+    if (it != _composed.end()) return it->second;
+
+    std::array<wxByte, 256> lut;
+    for (size_t i = 0; i < 256; i++)
+    {
+        lut[i] = _luts[outer][_luts[inner][i]];
+    }
+    int id = AddLUT(lut);
+    _composed[key] = id;
+    return id;
+}
+#pragma endregion Lookup Tables
+
+#pragma region Compiling
+void OutputProcessPipeline::SetChannels(size_t start, size_t count, wxByte value)
+{
+    if (count == 0) return;
+    _stageChanged = true;
+
+    for (size_t c = start; c < start + count; c++)
+    {
+        _constant[c] = true;
+        _value[c] = value;
+    }
+}
+
+void OutputProcessPipeline::MapChannels(size_t start, size_t count, const std::array<wxByte, 256>& lut)
+{
+    int id = AddLUT(lut);
+    if (count == 0 || id == 0) return;
+    _stageChanged = true;
+
+    for (size_t c = start; c < start + count; c++)
+    {
+        if (_constant[c])
+        {
+            _value[c] = _luts[id][_value[c]];
+        }
+        else
+        {
+            _lut[c] = ComposeLUT(id, _lut[c]);
+        }
+    }
+}
+
+void OutputProcessPipeline::CopyChannels(size_t to, size_t from, size_t count)
+{
+    if (count == 0 || to == from) return;
+    _stageChanged = true;
+
+    SaveStage(from, count);
+    for (size_t i = 0; i < count; i++)
+    {
+        _source[to + i] = _scratchSource[i];
+        _lut[to + i] = _scratchLut[i];
+        _value[to + i] = _scratchValue[i];
+        _constant[to + i] = _scratchConstant[i];
+    }
+}
+
+void OutputProcessPipeline::ReorderChannels(size_t start, const std::vector<size_t>& sources)
+{
+    if (sources.size() == 0) return;
+    _stageChanged = true;
+
+    _scratchSource.resize(sources.size());
+    _scratchLut.resize(sources.size());
+    _scratchValue.resize(sources.size());
+    _scratchConstant.resize(sources.size());
+    for (size_t i = 0; i < sources.size(); i++)
+    {
+        _scratchSource[i] = _source[sources[i]];
+        _scratchLut[i] = _lut[sources[i]];
+        _scratchValue[i] = _value[sources[i]];
+        _scratchConstant[i] = _constant[sources[i]];
+    }
+    for (size_t i = 0; i < sources.size(); i++)
+    {
+        _source[start + i] = _scratchSource[i];
+        _lut[start + i] = _scratchLut[i];
+        _value[start + i] = _scratchValue[i];
+        _constant[start + i] = _scratchConstant[i];
+    }
+}
+
+void OutputProcessPipeline::AddPass(OutputProcess* process)
+{
+    EndStage();
+
+    Step step;
+    step.pass = process;
+    step.firstSegment = 0;
+    step.segments = 0;
+    step.needsSnapshot = false;
+    _steps.push_back(step);
+
+    StartStage();
+}
+#pragma endregion Compiling
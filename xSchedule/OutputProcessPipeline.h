@@ -0,0 +1,111 @@
+#ifndef OUTPUTPROCESSPIPELINE_H
+#define OUTPUTPROCESSPIPELINE_H
+
+#include <list>
+#include <vector>
+#include <map>
+#include <array>
+#include <wx/wx.h>
+
+class OutputProcess;
+
+// ******************************************************
+// * Compiles the output processing list into one program
+// * that is run over the frame in a single pass. Each
+// * channel ends up as either a constant or a lookup table
+// * applied to one source channel ... dims become tables,
+// * remaps and reorders become source indexes and sets
+// * become constants. Anything that cannot be expressed
+// * per channel is run as its own pass between programs.
+// * The program is rebuilt whenever the list or the frame
+// * size changes and gives the same bytes as running each
+// * process in turn.
+// ******************************************************
+
+class OutputProcessPipeline
+{
+    enum class SEGMENTTYPE { SET, COPY, MAP, GATHER };
+
+    struct Segment
+    {
+        SEGMENTTYPE type;
+        size_t start;
+        size_t count;
+        size_t source; // first source channel or the first entry in _indexes for a gather
+        int lut;
+        wxByte value;
+    };
+
+    struct Step
+    {
+        OutputProcess* pass; // run as its own pass ... otherwise run the segments
+        size_t firstSegment;
+        size_t segments;
+        bool needsSnapshot;
+    };
+
+    struct Key
+    {
+        unsigned int serial;
+        int changeCount;
+
+        bool operator==(const Key& other) const { return serial == other.serial && changeCount == other.changeCount; }
+    };
+
+    #pragma region Member Variables
+    // what the program was compiled from
+    std::vector<Key> _key;
+    size_t _size;
+
+    // the compiled program
+    std::vector<Step> _steps;
+    std::vector<Segment> _segments;
+    std::vector<size_t> _indexes;
+    std::vector<std::array<wxByte, 256>> _luts; // 0 is the identity
+    std::vector<wxByte> _snapshot;
+
+    // the stage being compiled ... channel c becomes _luts[_lut[c]][in[_source[c]]] or _value[c] if _constant[c]
+    std::vector<size_t> _source;
+    std::vector<int> _lut;
+    std::vector<wxByte> _value;
+    std::vector<bool> _constant;
+    std::vector<size_t> _scratchSource;
+    std::vector<int> _scratchLut;
+    std::vector<wxByte> _scratchValue;
+    std::vector<bool> _scratchConstant;
+    std::map<std::array<wxByte, 256>, int> _lutIds;
+    std::map<std::pair<int, int>, int> _composed;
+    bool _stageChanged;
+    #pragma endregion Member Variables
+
+    bool IsCurrent(const std::list<OutputProcess*>& processes, size_t size) const;
+    void Compile(const std::list<OutputProcess*>& processes, size_t size);
+    void StartStage();
+    void EndStage();
+    int AddLUT(const std::array<wxByte, 256>& lut);
+    int ComposeLUT(int outer, int inner);
+    void SaveStage(size_t start, size_t count);
+
+public:
+
+    #pragma region Constructors and Destructors
+    OutputProcessPipeline();
+    virtual ~OutputProcessPipeline() {}
+    #pragma endregion Constructors and Destructors
+
+    // runs the processes over the buffer recompiling first if they have changed
+    void Frame(const std::list<OutputProcess*>& processes, wxByte* buffer, size_t size);
+
+    #pragma region Compiling
+    // these are called by OutputProcess::Compile ... channels are zero based and already clamped to the frame
+    void SetChannels(size_t start, size_t count, wxByte value);
+    void MapChannels(size_t start, size_t count, const std::array<wxByte, 256>& lut);
+    void CopyChannels(size_t to, size_t from, size_t count);
+    // channel start + i takes whatever channel sources[i] held before the call
+    void ReorderChannels(size_t start, const std::vector<size_t>& sources);
+    // the process runs its own Frame at this point
+    void AddPass(OutputProcess* process);
+    #pragma endregion Compiling
+};
+
+#endif
@@ -1,4 +1,5 @@
 #include "OutputProcessRemap.h"
+#include "OutputProcessPipeline.h"
 #include <wx/xml/xml.h>
 
 OutputProcessRemap::OutputProcessRemap(wxXmlNode* node) : OutputProcess(node)
@@ -43,5 +44,18 @@ void OutputProcessRemap::Frame(wxByte* buffer, size_t size)
     size_t chs2 = std::min(_channels, size - (_to - 1));
     size_t chs = std::min(chs1, chs2);
 
-    memcpy(buffer + _startChannel - 1, buffer + _to - 1, chs);
+    // the ranges may overlap
+    memmove(buffer + _startChannel - 1, buffer + _to - 1, chs);
+}
+
+void OutputProcessRemap::Compile(OutputProcessPipeline& pipeline, size_t size)
+{
+    if (_startChannel == _to) return;
+    if (_startChannel < 1 || _startChannel > size || _to < 1 || _to > size) return;
+
+    size_t chs1 = std::min(_channels, size - (_startChannel - 1));
+    size_t chs2 = std::min(_channels, size - (_to - 1));
+    size_t chs = std::min(chs1, chs2);
+
+    pipeline.CopyChannels(_startChannel - 1, _to - 1, chs);
 }
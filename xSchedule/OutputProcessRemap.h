@@ -17,6 +17,7 @@ class OutputProcessRemap : public OutputProcess
         virtual ~OutputProcessRemap() {}
         virtual wxXmlNode* Save() override;
         virtual void Frame(wxByte* buffer, size_t size) override;
+        virtual void Compile(OutputProcessPipeline& pipeline, size_t size) override;
         virtual size_t GetP1() const override { return _to; }
         virtual size_t GetP2() const override { return _channels; }
         virtual std::string GetType() const { return "Remap"; }
@@ -1,4 +1,5 @@
 #include "OutputProcessReverse.h"
+#include "OutputProcessPipeline.h"
 #include <wx/xml/xml.h>
 
 OutputProcessReverse::OutputProcessReverse(wxXmlNode* node) : OutputProcess(node)
@@ -40,14 +41,32 @@ void OutputProcessReverse::Frame(wxByte* buffer, size_t size)
 	wxByte rgb[3];
 	wxByte* from = p;
 	wxByte* to = p + (nodes - 1) * 3;
-		
-	for (int i = 0; i < nodes; i++)
+
+	// swap the ends working in to the middle
+	for (size_t i = 0; i < nodes / 2; i++)
 	{
-		memcpy(from, rgb, 3);
-		memcpy(to, from, 3);
-		memcpy(rgb, to, 3);
+		memcpy(rgb, from, 3);
+		memcpy(from, to, 3);
+		memcpy(to, rgb, 3);
 
 		from += 3;
 		to -= 3;
     }
 }
+
+void OutputProcessReverse::Compile(OutputProcessPipeline& pipeline, size_t size)
+{
+    if (_nodes < 2 || _startChannel < 1 || _startChannel > size) return;
+
+    size_t nodes = std::min(_nodes, (size - (_startChannel - 1)) / 3);
+
+    std::vector<size_t> sources(nodes * 3);
+    for (size_t i = 0; i < nodes; i++)
+    {
+        size_t p = (_startChannel - 1) + (nodes - 1 - i) * 3;
+        sources[i * 3] = p;
+        sources[i * 3 + 1] = p + 1;
+        sources[i * 3 + 2] = p + 2;
+    }
+    pipeline.ReorderChannels(_startChannel - 1, sources);
+}
@@ -1,4 +1,5 @@
 #include "OutputProcessSet.h"
+#include "OutputProcessPipeline.h"
 #include <wx/xml/xml.h>
 
 OutputProcessSet::OutputProcessSet(wxXmlNode* node) : OutputProcess(node)
@@ -41,3 +42,12 @@ void OutputProcessSet::Frame(wxByte* buffer, size_t size)
 
     memset(buffer + _startChannel - 1, (wxByte)_value, chs);
 }
+
+void OutputProcessSet::Compile(OutputProcessPipeline& pipeline, size_t size)
+{
+    if (_startChannel < 1 || _startChannel > size) return;
+
+    size_t chs = std::min(_channels, size - (_startChannel - 1));
+
+    pipeline.SetChannels(_startChannel - 1, chs, (wxByte)_value);
+}
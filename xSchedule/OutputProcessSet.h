@@ -17,6 +17,7 @@ class OutputProcessSet : public OutputProcess
         virtual ~OutputProcessSet() {}
         virtual wxXmlNode* Save() override;
         virtual void Frame(wxByte* buffer, size_t size) override;
+        virtual void Compile(OutputProcessPipeline& pipeline, size_t size) override;
         virtual size_t GetP1() const override { return _channels; }
         virtual size_t GetP2() const override { return _value; }
         virtual std::string GetType() const { return "Set"; }
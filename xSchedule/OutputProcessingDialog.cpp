@@ -1,4 +1,5 @@
 #include "OutputProcessingDialog.h"
+#include "PlaybackEngine.h"
 #include "OutputProcessDimWhite.h"
 #include "OutputProcessColourOrder.h"
 #include "OutputProcessReverse.h"
@@ -295,6 +296,9 @@ void OutputProcessingDialog::OnButton_AddSetClick(wxCommandEvent& event)
 
 void OutputProcessingDialog::OnButton_OkClick(wxCommandEvent& event)
 {
+    // the playback thread applies these every frame
+    PlaybackLock lock;
+
     while (_op->size() > 0)
     {
         auto todelete = _op->front();
@@ -6,6 +6,7 @@
 #include <log4cpp/Category.hh>
 #include "../../xLights/VideoReader.h"
 #include "PlayerWindow.h"
+#include "../PlaybackEngine.h"
 
 PlayListItemFSEQVideo::PlayListItemFSEQVideo(wxXmlNode* node) : PlayListItem(node)
 {
@@ -414,30 +415,36 @@ void PlayListItemFSEQVideo::Start()
         _audioManager->Play(0, _audioManager->LengthMS());
     }
 
-    // create the window
-    if (_window == nullptr)
+    // create the window ... windows must be created on the main thread
+    PlaybackEngine::RunOnMainThread([this]()
     {
-        _window = new PlayerWindow(nullptr, _topMost, wxIMAGE_QUALITY_HIGH, wxID_ANY, _origin, _size);
-    }
-    else
-    {
-        _window->Move(_origin);
-        _window->SetSize(_size);
-    }
+        if (_window == nullptr)
+        {
+            _window = new PlayerWindow(nullptr, _topMost, wxIMAGE_QUALITY_HIGH, wxID_ANY, _origin, _size);
+        }
+        else
+        {
+            _window->Move(_origin);
+            _window->SetSize(_size);
+        }
+    });
 }
 
 void PlayListItemFSEQVideo::Suspend(bool suspend)
 {
     Pause(suspend);
 
-    if (suspend)
-    {
-        if (_window != nullptr) _window->Hide();
-    }
-    else
+    PlaybackEngine::RunOnMainThread([this, suspend]()
     {
-        if (_window != nullptr) _window->Show();
-    }
+        if (suspend)
+        {
+            if (_window != nullptr) _window->Hide();
+        }
+        else
+        {
+            if (_window != nullptr) _window->Show();
+        }
+    });
 }
 
 void PlayListItemFSEQVideo::Pause(bool pause)
@@ -464,11 +471,14 @@ void PlayListItemFSEQVideo::Stop()
     CloseFiles();
 
     // destroy the window
-    if (_window != nullptr)
+    PlaybackEngine::RunOnMainThread([this]()
     {
-        delete _window;
-        _window = nullptr;
-    }
+        if (_window != nullptr)
+        {
+            delete _window;
+            _window = nullptr;
+        }
+    });
 }
 
 void PlayListItemFSEQVideo::CloseFiles()
@@ -497,11 +507,14 @@ PlayListItemFSEQVideo::~PlayListItemFSEQVideo()
 {
     CloseFiles();
 	
-    if (_window != nullptr)
+    PlaybackEngine::RunOnMainThread([this]()
     {
-        delete _window;
-        _window = nullptr;
-    }
+        if (_window != nullptr)
+        {
+            delete _window;
+            _window = nullptr;
+        }
+    });
 }
 
 std::list<std::string> PlayListItemFSEQVideo::GetMissingFiles() const
@@ -3,6 +3,7 @@
 #include <wx/notebook.h>
 #include "PlayListItemImagePanel.h"
 #include "PlayerWindow.h"
+#include "../PlaybackEngine.h"
 
 PlayListItemImage::PlayListItemImage(wxXmlNode* node) : PlayListItem(node)
 {
@@ -20,11 +21,14 @@ PlayListItemImage::PlayListItemImage(wxXmlNode* node) : PlayListItem(node)
 
 PlayListItemImage::~PlayListItemImage()
 {
-    if (_window != nullptr)
+    PlaybackEngine::RunOnMainThread([this]()
     {
-        delete _window;
-        _window = nullptr;
-    }
+        if (_window != nullptr)
+        {
+            delete _window;
+            _window = nullptr;
+        }
+    });
 }
 
 void PlayListItemImage::Load(wxXmlNode* node)
@@ -123,38 +127,47 @@ void PlayListItemImage::Start()
     // reload the image file
     _image.LoadFile(_ImageFile);
 
-    // create the window
-    if (_window == nullptr)
+    // create the window ... windows must be created on the main thread
+    PlaybackEngine::RunOnMainThread([this]()
     {
-        _window = new PlayerWindow(nullptr, _topMost, wxIMAGE_QUALITY_HIGH, wxID_ANY, _origin, _size);
-    }
-    else
-    {
-        _window->Move(_origin);
-        _window->SetSize(_size);
-    }
+        if (_window == nullptr)
+        {
+            _window = new PlayerWindow(nullptr, _topMost, wxIMAGE_QUALITY_HIGH, wxID_ANY, _origin, _size);
+        }
+        else
+        {
+            _window->Move(_origin);
+            _window->SetSize(_size);
+        }
+    });
 }
 
 void PlayListItemImage::Stop()
 {
     // destroy the window
-    if (_window != nullptr)
+    PlaybackEngine::RunOnMainThread([this]()
     {
-        delete _window;
-        _window = nullptr;
-    }
+        if (_window != nullptr)
+        {
+            delete _window;
+            _window = nullptr;
+        }
+    });
 }
 
 void PlayListItemImage::Suspend(bool suspend)
 {
-    if (suspend)
+    PlaybackEngine::RunOnMainThread([this, suspend]()
     {
-        if (_window != nullptr) _window->Hide();
-    }
-    else
-    {
-        if (_window != nullptr) _window->Show();
-    }
+        if (suspend)
+        {
+            if (_window != nullptr) _window->Hide();
+        }
+        else
+        {
+            if (_window != nullptr) _window->Show();
+        }
+    });
 }
 
 std::list<std::string> PlayListItemImage::GetMissingFiles() const
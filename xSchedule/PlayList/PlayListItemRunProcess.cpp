@@ -8,6 +8,7 @@
 #include <wx/notebook.h>
 #include <log4cpp/Category.hh>
 #include "../RunningSchedule.h"
+#include "../PlaybackEngine.h"
 
 PlayListItemRunProcess::PlayListItemRunProcess(wxXmlNode* node) : PlayListItem(node)
 {
@@ -127,7 +128,11 @@ void PlayListItemRunProcess::Frame(wxByte* buffer, size_t size, size_t ms, size_
 
         static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
         logger_base.info("Launching command %s wait %d.", (const char *)cmd.c_str(), (int)_waitForCompletion);
-        wxExecute(cmd, flags);
+        // wxExecute has to be called from the main thread
+        PlaybackEngine::RunOnMainThread([&cmd, flags]()
+        {
+            wxExecute(cmd, flags);
+        });
         logger_base.info("Command launched.");
     }
 }
@@ -9,6 +9,9 @@
 #include "../xScheduleMain.h"
 #include "../ScheduleManager.h"
 #include "../ScheduleOptions.h"
+#include <wx/graphics.h>
+#include <cmath>
+#include <vector>
 
 PlayListItemText::PlayListItemText(wxXmlNode* node) : PlayListItem(node)
 {
@@ -27,6 +30,8 @@ PlayListItemText::PlayListItemText(wxXmlNode* node) : PlayListItem(node)
     _x = 0;
     _y = 0;
     _maxSize = wxSize(0,0);
+    _renderedChangeCount = -1;
+    _charHeight = 0;
 
     PlayListItemText::Load(node);
 }
@@ -107,6 +112,8 @@ PlayListItemText::PlayListItemText() : PlayListItem()
     _x = 0;
     _y = 0;
     _maxSize = wxSize(0, 0);
+    _renderedChangeCount = -1;
+    _charHeight = 0;
 }
 
 PlayListItem* PlayListItemText::Copy() const
@@ -192,6 +199,8 @@ size_t PlayListItemText::GetDurationMS() const
 void PlayListItemText::Start()
 {
     _maxSize = wxSize(0, 0);
+    _renderedChangeCount = -1;
+    _textImage = wxImage();
     auto m = xScheduleFrame::GetScheduleManager()->GetOptions()->GetMatrices();
     for (auto it = m->begin(); it != m->end(); ++it)
     {
@@ -338,10 +347,81 @@ wxPoint PlayListItemText::GetLocation(size_t ms, wxSize size)
     return res;
 }
 
-void PlayListItemText::Frame(wxByte* buffer, size_t size, size_t ms, size_t framems, bool outputframe)
+// draws the text into _textImage ... unlike a wxMemoryDC a wxGraphicsContext on a wxImage
+// can be used off the main thread so the playback thread never waits on the UI, and it
+// only has to happen when the text changes rather than every frame
+void PlayListItemText::RenderText(const std::string& text)
 {
-    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+    _renderedText = text;
+    _renderedChangeCount = _changeCount;
+    _textImage = wxImage();
+    _textAnchor = wxPoint(0, 0);
+
+    wxGraphicsContext* measure = wxGraphicsRenderer::GetDefaultRenderer()->CreateMeasuringContext();
+    if (measure == nullptr) return;
+    measure->SetFont(*_font, _colour);
+
+    double w, h;
+    measure->GetTextExtent(text, &w, &h);
+    wxSize sz((int)std::ceil(w), (int)std::ceil(h));
+    if (sz.x > _maxSize.x) _maxSize.x = sz.x;
+    if (sz.y > _maxSize.y) _maxSize.y = sz.y;
+    measure->GetTextExtent("X", &w, &h);
+    _charHeight = (int)std::ceil(h);
+
+    std::vector<double> charWidths;
+    int maxCharWidth = 0;
+    for (auto c = text.begin(); c != text.end(); ++c)
+    {
+        measure->GetTextExtent(wxString(*c), &w, &h);
+        charWidths.push_back(w);
+        maxCharWidth = std::max(maxCharWidth, (int)std::ceil(w));
+    }
+    delete measure;
 
+    if (text == "" || sz.x <= 0 || sz.y <= 0) return;
+
+    if (_orientation == "Normal" || _orientation == "Rotate Up 90" || _orientation == "Rotate Down 90")
+    {
+        _textImage = wxImage(sz.x, sz.y, true);
+        wxGraphicsContext* gc = wxGraphicsContext::Create(_textImage);
+        gc->SetFont(*_font, _colour);
+        gc->DrawText(text, 0, 0);
+        // the image only gets the drawing once the context is gone
+        delete gc;
+
+        // turned about the top left of the text the way DrawRotatedText turns it
+        if (_orientation == "Rotate Up 90")
+        {
+            _textImage = _textImage.Rotate90(false);
+            _textAnchor = wxPoint(0, sz.x);
+        }
+        else if (_orientation == "Rotate Down 90")
+        {
+            _textImage = _textImage.Rotate90(true);
+            _textAnchor = wxPoint(sz.y, 0);
+        }
+    }
+    else if (_orientation == "Vertical Up" || _orientation == "Vertical Down")
+    {
+        // one character under another each centred on the location
+        int n = text.size();
+        _textImage = wxImage(maxCharWidth, _charHeight * n, true);
+        wxGraphicsContext* gc = wxGraphicsContext::Create(_textImage);
+        gc->SetFont(*_font, _colour);
+        for (int i = 0; i < n; i++)
+        {
+            int y = _orientation == "Vertical Down" ? i * _charHeight : (n - 1 - i) * _charHeight;
+            gc->DrawText(wxString(text[i]), maxCharWidth / 2 - (int)(charWidths[i] / 2), y);
+        }
+        delete gc;
+
+        _textAnchor = wxPoint(maxCharWidth / 2, _orientation == "Vertical Down" ? 0 : (n - 1) * _charHeight);
+    }
+}
+
+void PlayListItemText::Frame(wxByte* buffer, size_t size, size_t ms, size_t framems, bool outputframe)
+{
     if (_matrixMapper == nullptr) return;
 
     if (outputframe && ms > _delay)
@@ -350,60 +430,30 @@ void PlayListItemText::Frame(wxByte* buffer, size_t size, size_t ms, size_t fram
 
         // work out our Text
         std::string text = GetText(effms);
-
-        wxBitmap bitmap(_matrixMapper->GetWidth(), _matrixMapper->GetHeight());
-        wxMemoryDC dc(bitmap);
-
-        // draw the text into our DC
-        dc.SetTextForeground(_colour);
-        dc.SetFont(*_font);
-        wxSize sz = dc.GetTextExtent(text);
-        if (sz.x > _maxSize.x) _maxSize.x = sz.x;
-        if (sz.y > _maxSize.y) _maxSize.y = sz.y;
-
-        if (_orientation == "Normal")
+        if (text != _renderedText || _changeCount != _renderedChangeCount)
         {
-            // work out where to draw it
-            wxPoint loc = GetLocation(effms, _maxSize);
-            dc.DrawText(text, loc);
+            RenderText(text);
         }
-        else if (_orientation == "Vertical Up" || _orientation == "Vertical Down")
+
+        // work out where to draw it
+        wxPoint loc;
+        if (_orientation == "Vertical Up" || _orientation == "Vertical Down")
         {
-            // work out where to draw it
-            wxSize sz1(_maxSize.GetHeight(), dc.GetCharHeight() * text.size());
-            wxPoint loc = GetLocation(effms, sz1);
-            int y = loc.y;
-            for (auto c = text.begin(); c != text.end(); ++c)
-            {
-                wxSize cSize = dc.GetTextExtent(*c);
-                int xoffset = cSize.GetWidth() / 2;
-                dc.DrawText(wxString(*c), loc.x - xoffset, y);
-                if (_orientation == "Vertical Down")
-                {
-                    y += dc.GetCharHeight();
-                }
-                else
-                {
-                    y -= dc.GetCharHeight();
-                }
-            }
+            loc = GetLocation(effms, wxSize(_maxSize.GetHeight(), _charHeight * text.size()));
         }
-        else if (_orientation == "Rotate Up 90")
+        else if (_orientation == "Rotate Up 90" || _orientation == "Rotate Down 90")
         {
-            wxSize sz1(_maxSize.GetHeight(), _maxSize.GetWidth());
-            wxPoint loc = GetLocation(effms, sz1);
-            dc.DrawRotatedText(text, loc, 90);
+            loc = GetLocation(effms, wxSize(_maxSize.GetHeight(), _maxSize.GetWidth()));
         }
-        else if (_orientation == "Rotate Down 90")
+        else
         {
-            wxSize sz1(_maxSize.GetHeight(), _maxSize.GetWidth());
-            wxPoint loc = GetLocation(effms, sz1);
-            dc.DrawRotatedText(text, loc, -90);
+            loc = GetLocation(effms, _maxSize);
         }
+        // where the top left of the image lands on the matrix
+        loc -= _textAnchor;
 
-        // write out the bitmap
-        dc.SelectObject(wxNullBitmap);
-        wxImage image = bitmap.ConvertToImage();
+        int iw = _textImage.IsOk() ? _textImage.GetWidth() : 0;
+        int ih = _textImage.IsOk() ? _textImage.GetHeight() : 0;
         for (int x = 0; x < _matrixMapper->GetWidth(); ++x)
         {
             for (int y = 0; y < _matrixMapper->GetHeight(); ++y)
@@ -414,7 +464,17 @@ void PlayListItemText::Frame(wxByte* buffer, size_t size, size_t ms, size_t fram
                 {
                     wxByte* p = buffer + bl;
 
-                    SetPixel(p, image.GetRed(x, y), image.GetGreen(x, y), image.GetBlue(x, y), _blendMode);
+                    // anywhere the text is not is black
+                    int ix = x - loc.x;
+                    int iy = y - loc.y;
+                    if (ix >= 0 && ix < iw && iy >= 0 && iy < ih)
+                    {
+                        SetPixel(p, _textImage.GetRed(ix, iy), _textImage.GetGreen(ix, iy), _textImage.GetBlue(ix, iy), _blendMode);
+                    }
+                    else
+                    {
+                        SetPixel(p, 0, 0, 0, _blendMode);
+                    }
                 }
                 else
                 {
@@ -4,6 +4,7 @@
 #include "PlayListItem.h"
 #include <string>
 #include "../FSEQFile.h"
+#include <wx/image.h>
 
 class wxXmlNode;
 class MatrixMapper;
@@ -28,9 +29,15 @@ protected:
     int _y;
     wxSize _maxSize;
     MatrixMapper* _matrixMapper;
+    wxImage _textImage; // the text drawn once and placed on the matrix every frame
+    wxPoint _textAnchor; // the point in _textImage that sits on the location
+    std::string _renderedText;
+    int _renderedChangeCount;
+    int _charHeight;
     #pragma endregion Member Variables
 
     std::string GetText(size_t ms);
+    void RenderText(const std::string& text);
     wxPoint GetLocation(size_t ms, wxSize size);
     void SetPixel(wxByte* p, wxByte r, wxByte g, wxByte b, APPLYMETHOD blendMode);
 
@@ -4,6 +4,7 @@
 #include "PlayListItemVideoPanel.h"
 #include "../../xLights/VideoReader.h"
 #include "PlayerWindow.h"
+#include "../PlaybackEngine.h"
 #include <log4cpp/Category.hh>
 
 PlayListItemVideo::PlayListItemVideo(wxXmlNode* node) : PlayListItem(node)
@@ -24,11 +25,14 @@ PlayListItemVideo::~PlayListItemVideo()
 {
     CloseFiles();
 
-    if (_window != nullptr)
+    PlaybackEngine::RunOnMainThread([this]()
     {
-        delete _window;
-        _window = nullptr;
-    }
+        if (_window != nullptr)
+        {
+            delete _window;
+            _window = nullptr;
+        }
+    });
 }
 
 void PlayListItemVideo::Load(wxXmlNode* node)
@@ -179,16 +183,19 @@ void PlayListItemVideo::Start()
 {
     OpenFiles();
 
-    // create the window
-    if (_window == nullptr)
+    // create the window ... windows must be created on the main thread
+    PlaybackEngine::RunOnMainThread([this]()
     {
-        _window = new PlayerWindow(nullptr, _topMost, wxIMAGE_QUALITY_HIGH, wxID_ANY, _origin, _size);
-    }
-    else
-    {
-        _window->Move(_origin);
-        _window->SetSize(_size);
-    }
+        if (_window == nullptr)
+        {
+            _window = new PlayerWindow(nullptr, _topMost, wxIMAGE_QUALITY_HIGH, wxID_ANY, _origin, _size);
+        }
+        else
+        {
+            _window->Move(_origin);
+            _window->SetSize(_size);
+        }
+    });
 }
 
 void PlayListItemVideo::Stop()
@@ -196,23 +203,29 @@ void PlayListItemVideo::Stop()
     CloseFiles();
 
     // destroy the window
-    if (_window != nullptr)
+    PlaybackEngine::RunOnMainThread([this]()
     {
-        delete _window;
-        _window = nullptr;
-    }
+        if (_window != nullptr)
+        {
+            delete _window;
+            _window = nullptr;
+        }
+    });
 }
 
 void PlayListItemVideo::Suspend(bool suspend)
 {
-    if (suspend)
+    PlaybackEngine::RunOnMainThread([this, suspend]()
     {
-        if (_window != nullptr) _window->Hide();
-    }
-    else
-    {
-        if (_window != nullptr) _window->Show();
-    }
+        if (suspend)
+        {
+            if (_window != nullptr) _window->Hide();
+        }
+        else
+        {
+            if (_window != nullptr) _window->Show();
+        }
+    });
 }
 
 bool PlayListItemVideo::IsVideo(const std::string& ext)
@@ -1,17 +1,20 @@
 #include "PlayerWindow.h"
 #include <wx/dcclient.h>
+#include <wx/thread.h>
 
 BEGIN_EVENT_TABLE(PlayerWindow, wxWindow)
 EVT_MOTION(PlayerWindow::OnMouseMove)
 EVT_LEFT_DOWN(PlayerWindow::OnMouseLeftDown)
 EVT_LEFT_UP(PlayerWindow::OnMouseLeftUp)
 EVT_PAINT(PlayerWindow::Paint)
+EVT_SIZE(PlayerWindow::OnSize)
 END_EVENT_TABLE()
 
 PlayerWindow::PlayerWindow(wxWindow* parent, bool topMost, wxImageResizeQuality quality = wxIMAGE_QUALITY_HIGH, wxWindowID id, const wxPoint& pos, const wxSize& size)
 {
     _quality = quality;
     _image = wxImage(size, true);
+    _imageSize = size;
 #ifndef __WXOSX__
     SetDoubleBuffered(true);
 #endif
@@ -49,18 +52,50 @@ PlayerWindow::~PlayerWindow()
 
 void PlayerWindow::SetImage(const wxImage& image)
 {
-    int width = 0;
-    int height = 0;
-    GetSize(&width, &height);
-    _image = image;
-    _image.Rescale(width, height, _quality);
+    wxSize size;
+    {
+        std::unique_lock<std::mutex> lock(_imageLock);
+        size = _imageSize;
+    }
+
+    // scale it on the calling thread ... only the repaint has to happen on the main thread
+    wxImage scaled = image;
+    scaled.Rescale(size.GetWidth(), size.GetHeight(), _quality);
+
+    {
+        std::unique_lock<std::mutex> lock(_imageLock);
+        _image = scaled;
+    }
+
+    if (wxThread::IsMain())
+    {
+        RefreshImage();
+    }
+    else
+    {
+        CallAfter(&PlayerWindow::RefreshImage);
+    }
+}
+
+void PlayerWindow::RefreshImage()
+{
     Refresh(false);
 }
 
+void PlayerWindow::OnSize(wxSizeEvent& event)
+{
+    {
+        std::unique_lock<std::mutex> lock(_imageLock);
+        _imageSize = event.GetSize();
+    }
+    event.Skip();
+}
+
 void PlayerWindow::Paint(wxPaintEvent& event)
 {
     wxPaintDC dc(this);
 
+    std::unique_lock<std::mutex> lock(_imageLock);
     dc.DrawBitmap(_image, 0, 0);
 }
 
@@ -4,10 +4,13 @@
 #include <wx/window.h>
 #include <wx/image.h>
 #include <wx/frame.h>
+#include <mutex>
 
 class PlayerWindow: public wxFrame
 {
     wxImage _image;
+    wxSize _imageSize;
+    std::mutex _imageLock; // SetImage is called from the playback thread
     wxPoint _startDragPos;
     wxPoint _startMousePos;
     bool _dragging;
@@ -23,6 +26,8 @@ class PlayerWindow: public wxFrame
 
         void OnMouseLeftUp(wxMouseEvent& event);
         void OnMouseMove(wxMouseEvent& event);
+        void OnSize(wxSizeEvent& event);
+        void RefreshImage();
         void OnMouseLeftDown(wxMouseEvent& event);
         void Paint(wxPaintEvent& event);
 
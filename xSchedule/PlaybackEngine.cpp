@@ -0,0 +1,377 @@
+#include "PlaybackEngine.h"
+#include "ScheduleManager.h"
+#include "xScheduleMain.h"
+
+#include <wx/thread.h>
+#include <wx/app.h>
+#include <wx/utils.h>
+#include <wx/datetime.h>
+#include <chrono>
+#include <cstring>
+#include <list>
+#include <log4cpp/Category.hh>
+
+#ifdef _MSC_VER
+// the default windows timer resolution is far too coarse to hit a frame deadline
+#include <windows.h>
+#include <mmsystem.h>
+#pragma comment(lib, "winmm.lib")
+#endif
+
+
+static long long NowUS()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#pragma region Main Thread Calls
+struct MainThreadCall
+{
+    std::function<void()> fn;
+    bool done;
+};
+
+static std::mutex __callLock;
+static std::condition_variable __callSignal;
+static std::list<MainThreadCall*> __calls;
+
+void PlaybackEngine::RunOnMainThread(const std::function<void()>& fn)
+{
+    if (wxThread::IsMain())
+    {
+        fn();
+        return;
+    }
+
+    MainThreadCall call;
+    call.fn = fn;
+    call.done = false;
+
+    {
+        std::unique_lock<std::mutex> lock(__callLock);
+        __calls.push_back(&call);
+    }
+    // also wake anyone waiting in a PlaybackLock
+    __callSignal.notify_all();
+
+    if (wxTheApp != nullptr)
+    {
+        wxTheApp->CallAfter([]() { PlaybackEngine::ProcessMainThreadCalls(); });
+    }
+
+    std::unique_lock<std::mutex> lock(__callLock);
+    __callSignal.wait(lock, [&call]() { return call.done; });
+}
+
+void PlaybackEngine::ProcessMainThreadCalls()
+{
+    wxASSERT(wxThread::IsMain());
+
+    for (;;)
+    {
+        MainThreadCall* call = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(__callLock);
+            if (__calls.size() == 0) return;
+            call = __calls.front();
+            __calls.pop_front();
+        }
+
+        call->fn();
+
+        {
+            std::unique_lock<std::mutex> lock(__callLock);
+            call->done = true;
+        }
+        __callSignal.notify_all();
+    }
+}
+
+std::recursive_mutex& PlaybackEngine::GetLock()
+{
+    static std::recursive_mutex lock;
+    return lock;
+}
+
+PlaybackLock::PlaybackLock()
+{
+    std::recursive_mutex& lock = PlaybackEngine::GetLock();
+
+    if (wxThread::IsMain())
+    {
+        while (!lock.try_lock())
+        {
+            PlaybackEngine::ProcessMainThreadCalls();
+
+            std::unique_lock<std::mutex> calllock(__callLock);
+            if (__calls.size() == 0)
+            {
+                __callSignal.wait_for(calllock, std::chrono::milliseconds(1));
+            }
+        }
+    }
+    else
+    {
+        lock.lock();
+    }
+}
+
+PlaybackLock::~PlaybackLock()
+{
+    PlaybackEngine::GetLock().unlock();
+}
+#pragma endregion Main Thread Calls
+
+class PlaybackEngineThread : public wxThread
+{
+    PlaybackEngine* _engine;
+
+public:
+    PlaybackEngineThread(PlaybackEngine* engine) : wxThread(wxTHREAD_JOINABLE), _engine(engine) {}
+
+    virtual ExitCode Entry() override
+    {
+        _engine->Run();
+        return nullptr;
+    }
+};
+
+#pragma region Constructors and Destructors
+PlaybackEngine::PlaybackEngine(wxEvtHandler* statusHandler)
+{
+    _thread = nullptr;
+    _statusHandler = statusHandler;
+    _frameMS = 50;
+    _spinUS = 0;
+    _stop = false;
+    _intervalChanged = false;
+    ResetStats();
+}
+
+PlaybackEngine::~PlaybackEngine()
+{
+    Stop();
+}
+#pragma endregion Constructors and Destructors
+
+#pragma region Start and Stop
+bool PlaybackEngine::Start(int frameMS)
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (_thread != nullptr)
+    {
+        SetFrameInterval(frameMS);
+        return true;
+    }
+
+    _frameMS = frameMS;
+    _stop = false;
+    _intervalChanged = false;
+    ResetStats();
+
+#ifdef _MSC_VER
+    timeBeginPeriod(1);
+#endif
+
+    _thread = new PlaybackEngineThread(this);
+    if (_thread->Create() != wxTHREAD_NO_ERROR)
+    {
+        logger_base.error("PlaybackEngine: Unable to create the playback thread.");
+        delete _thread;
+        _thread = nullptr;
+#ifdef _MSC_VER
+        timeEndPeriod(1);
+#endif
+        return false;
+    }
+    _thread->SetPriority(WXTHREAD_MAX_PRIORITY);
+    _thread->Run();
+
+    logger_base.debug("PlaybackEngine: Playback thread started at %dms per frame.", frameMS);
+    return true;
+}
+
+void PlaybackEngine::Stop()
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (_thread == nullptr) return;
+
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        _stop = true;
+    }
+    _signal.notify_all();
+
+    // the last frame may be waiting on us to do something for it
+    while (_thread->IsAlive())
+    {
+        ProcessMainThreadCalls();
+        wxMilliSleep(1);
+    }
+    _thread->Wait();
+    delete _thread;
+    _thread = nullptr;
+
+#ifdef _MSC_VER
+    timeEndPeriod(1);
+#endif
+
+    Stats stats = GetStats();
+    logger_base.debug("PlaybackEngine: Playback thread stopped. %d frames, %d overruns, average jitter %ldus, worst jitter %ldus, slowest tick %ldus.",
+        (int)stats.frames, (int)stats.overruns, stats.AverageJitterUS(), stats.maxJitterUS, stats.maxFrameUS);
+}
+#pragma endregion Start and Stop
+
+#pragma region Frame Interval
+void PlaybackEngine::SetSpinUS(int spinUS)
+{
+    if (spinUS < 0) spinUS = 0;
+    if (spinUS == _spinUS) return;
+
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+    logger_base.debug("PlaybackEngine: Spinning for the last %dus before each tick.", spinUS);
+
+    _spinUS = spinUS;
+}
+
+void PlaybackEngine::SetFrameInterval(int frameMS)
+{
+    if (frameMS <= 0 || frameMS == _frameMS) return;
+
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+    logger_base.debug("PlaybackEngine: Frame interval changed to %dms.", frameMS);
+
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        _frameMS = frameMS;
+        _intervalChanged = true;
+    }
+    _signal.notify_all();
+}
+#pragma endregion Frame Interval
+
+#pragma region Statistics
+PlaybackEngine::Stats PlaybackEngine::GetStats()
+{
+    std::unique_lock<std::mutex> lock(_statsLock);
+    Stats stats = _stats;
+    stats.intervalMS = _frameMS;
+    return stats;
+}
+
+void PlaybackEngine::ResetStats()
+{
+    std::unique_lock<std::mutex> lock(_statsLock);
+    memset(&_stats, 0x00, sizeof(_stats));
+}
+
+std::string PlaybackEngine::GetStatsJSON()
+{
+    Stats stats = GetStats();
+    return wxString::Format("{\"running\":\"%s\",\"intervalms\":\"%d\",\"frames\":\"%lu\",\"overruns\":\"%lu\",\"lastjitterus\":\"%ld\",\"averagejitterus\":\"%ld\",\"maxjitterus\":\"%ld\",\"lastframeus\":\"%ld\",\"maxframeus\":\"%ld\"}",
+        IsRunning() ? "true" : "false",
+        stats.intervalMS,
+        (unsigned long)stats.frames,
+        (unsigned long)stats.overruns,
+        stats.lastJitterUS,
+        stats.AverageJitterUS(),
+        stats.maxJitterUS,
+        stats.lastFrameUS,
+        stats.maxFrameUS).ToStdString();
+}
+#pragma endregion Statistics
+
+void PlaybackEngine::Run()
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    // like the old frame timer we tick twice a frame and only output on every second tick
+    bool outputframe = false;
+    long long period = (long long)_frameMS * 500;
+    long long next = NowUS() + period;
+    int lastStatus = -1;
+
+    for (;;)
+    {
+        {
+            // the wait is on the steady clock so it wakes within the timer resolution of the
+            // deadline ... timeBeginPeriod makes that 1ms on windows, elsewhere it is far finer
+            std::unique_lock<std::mutex> lock(_lock);
+            long long spin = _spinUS;
+            if (next - NowUS() > spin)
+            {
+                std::chrono::steady_clock::time_point wake(std::chrono::microseconds(next - spin));
+                _signal.wait_until(lock, wake, [this]() { return _stop || _intervalChanged; });
+            }
+            if (_stop) break;
+            if (_intervalChanged)
+            {
+                // start the new rate from now rather than catching up on the old one
+                _intervalChanged = false;
+                period = (long long)_frameMS * 500;
+                next = NowUS() + period;
+                continue;
+            }
+        }
+
+        // only spins if asked to for a machine whose timers are too coarse
+        while (NowUS() < next)
+        {
+            wxThread::Yield();
+        }
+
+        long long start = NowUS();
+        long jitter = (long)(start - next);
+        bool output = outputframe;
+
+        {
+            PlaybackLock lock;
+            ScheduleManager* schedule = xScheduleFrame::GetScheduleManager();
+            if (schedule != nullptr)
+            {
+                schedule->Frame(outputframe);
+            }
+        }
+
+        long long end = NowUS();
+        long frameUS = (long)(end - start);
+
+        // next deadline comes from the last one so time spent in the frame does not accumulate
+        next += period;
+        bool overrun = false;
+        if (next <= end)
+        {
+            // we missed whole ticks ... skip them but keep output frames on the same grid
+            long long missed = (end - next) / period + 1;
+            next += missed * period;
+            if (missed % 2 == 1) outputframe = !outputframe;
+            overrun = true;
+
+            logger_base.debug("PlaybackEngine: Frame overran by %ld ticks. Tick took %ldus against a %ldus tick.", (long)missed, frameUS, (long)period);
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(_statsLock);
+            _stats.ticks++;
+            if (output) _stats.frames++;
+            if (overrun) _stats.overruns++;
+            _stats.lastJitterUS = jitter;
+            if (jitter > _stats.maxJitterUS) _stats.maxJitterUS = jitter;
+            _stats.totalJitterUS += jitter;
+            _stats.lastFrameUS = frameUS;
+            if (frameUS > _stats.maxFrameUS) _stats.maxFrameUS = frameUS;
+        }
+
+        // the UI only hears from us about once a second
+        if (output && lastStatus != wxDateTime::Now().GetSecond())
+        {
+            lastStatus = wxDateTime::Now().GetSecond();
+            wxCommandEvent event(EVT_SCHEDULECHANGED);
+            wxPostEvent(_statusHandler, event);
+        }
+
+        outputframe = !outputframe;
+    }
+}
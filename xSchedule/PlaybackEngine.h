@@ -0,0 +1,113 @@
+#ifndef PLAYBACKENGINE_H
+#define PLAYBACKENGINE_H
+
+#include <wx/event.h>
+#include <string>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+
+class PlaybackEngineThread;
+
+// ******************************************************
+// * Runs ScheduleManager::Frame on its own thread against
+// * an absolute deadline clock so UI work such as repaints,
+// * resizing or tree refreshes no longer delays the show.
+// * Each tick is scheduled from the previous deadline rather
+// * than from when the last frame finished so the frame
+// * rate does not drift. The UI only receives status events.
+// ******************************************************
+
+class PlaybackEngine
+{
+public:
+
+    struct Stats
+    {
+        size_t frames; // output frames sent
+        size_t ticks; // half frame ticks run
+        size_t overruns; // ticks that started a whole tick late
+        int intervalMS; // frame interval
+        long lastJitterUS; // how late the last tick started
+        long maxJitterUS;
+        long long totalJitterUS;
+        long lastFrameUS; // how long the last tick took to run
+        long maxFrameUS;
+
+        long AverageJitterUS() const { return ticks == 0 ? 0 : (long)(totalJitterUS / (long long)ticks); }
+    };
+
+private:
+
+    #pragma region Member Variables
+    PlaybackEngineThread* _thread;
+    wxEvtHandler* _statusHandler;
+    std::atomic<int> _frameMS;
+    std::atomic<int> _spinUS;
+    bool _stop;
+    bool _intervalChanged;
+    std::mutex _lock;
+    std::condition_variable _signal;
+    std::mutex _statsLock;
+    Stats _stats;
+    #pragma endregion Member Variables
+
+    void Run();
+
+    friend class PlaybackEngineThread;
+
+public:
+
+    #pragma region Constructors and Destructors
+    // status events are posted to the handler ... it is never called directly
+    PlaybackEngine(wxEvtHandler* statusHandler);
+    ~PlaybackEngine();
+    #pragma endregion Constructors and Destructors
+
+    #pragma region Start and Stop
+    bool Start(int frameMS);
+    void Stop();
+    bool IsRunning() const { return _thread != nullptr; }
+    #pragma endregion Start and Stop
+
+    #pragma region Frame Interval
+    // the new interval takes effect on the next tick
+    void SetFrameInterval(int frameMS);
+    int GetFrameInterval() const { return _frameMS; }
+    // how long before each tick to stop sleeping and yield until it arrives ... 0 sleeps all the way
+    void SetSpinUS(int spinUS);
+    int GetSpinUS() const { return _spinUS; }
+    #pragma endregion Frame Interval
+
+    #pragma region Statistics
+    Stats GetStats();
+    void ResetStats();
+    std::string GetStatsJSON();
+    #pragma endregion Statistics
+
+    #pragma region Thread Helpers
+    // guards everything ScheduleManager::Frame touches
+    static std::recursive_mutex& GetLock();
+    // runs fn on the main thread and waits for it to finish ... runs it directly if already on the main thread
+    static void RunOnMainThread(const std::function<void()>& fn);
+    // runs anything the playback thread is waiting on the main thread to do
+    static void ProcessMainThreadCalls();
+    #pragma endregion Thread Helpers
+};
+
+// ******************************************************
+// * Holds the playback lock for the life of the object.
+// * On the main thread it keeps servicing RunOnMainThread
+// * calls while it waits so the playback thread can never
+// * be left waiting on a main thread that is waiting on it.
+// ******************************************************
+
+class PlaybackLock
+{
+public:
+    PlaybackLock();
+    ~PlaybackLock();
+};
+
+#endif
@@ -21,6 +21,8 @@
 #include "UserButton.h"
 #include "FSEQFile.h"
 #include "OutputProcess.h"
+#include "OutputProcessPipeline.h"
+#include "BlendKernels.h"
 #include <wx/filename.h>
 #include <wx/mimetype.h>
 #include "PlayList/PlayListItemAudio.h"
@@ -30,16 +32,19 @@
 #include "PlayList/PlayListItemVideo.h"
 #include "Xyzzy.h"
 #include "PlayList/PlayListItemText.h"
+#include "PlaybackEngine.h"
 
 ScheduleManager::ScheduleManager(const std::string& showDir)
 {
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
     logger_base.info("Loading schedule from %s.", (const char *)_showDir.c_str());
+    logger_base.debug("Playlist items are blended using the %s kernels.", GetBlendKernelName());
 
     // prime fix file with our show directory for any filename fixups
     FSEQFile::FixFile(showDir, "");
 
     _backgroundPlayList = nullptr;
+    _outputPipeline = new OutputProcessPipeline();
     _queuedSongs = new PlayList();
     _fppSync = nullptr;
     _manualOTL = -1;
@@ -128,6 +133,8 @@ ScheduleManager::ScheduleManager(const std::string& showDir)
 
 void ScheduleManager::AddPlayList(PlayList* playlist)
 {
+    PlaybackLock lock;
+
     _playLists.push_back(playlist);
     _changeCount++;
 }
@@ -181,6 +188,7 @@ ScheduleManager::~ScheduleManager()
         _outputProcessing.remove(toremove);
         delete toremove;
     }
+    delete _outputPipeline;
 
     while (_playLists.size() > 0)
     {
@@ -293,6 +301,8 @@ void ScheduleManager::ClearDirty()
 
 void ScheduleManager::RemovePlayList(PlayList* playlist)
 {
+    PlaybackLock lock;
+
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
     logger_base.info("Deleting playlist %s.", (const char*)playlist->GetNameNoTime().c_str());
     _playLists.remove(playlist);
@@ -301,6 +311,8 @@ void ScheduleManager::RemovePlayList(PlayList* playlist)
 
 PlayList* ScheduleManager::GetRunningPlayList() const
 {
+    PlaybackLock lock;
+
     // find the highest priority running playlist
     PlayList* running = nullptr;
 
@@ -325,6 +337,8 @@ PlayList* ScheduleManager::GetRunningPlayList() const
 
 void ScheduleManager::StopAll()
 {
+    PlaybackLock lock;
+
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
     logger_base.info("Stopping all playlists.");
 
@@ -390,10 +404,7 @@ void ScheduleManager::Frame(bool outputframe)
             }
 
             // apply any output processing
-            for (auto it = _outputProcessing.begin(); it != _outputProcessing.end(); ++it)
-            {
-                (*it)->Frame(_buffer, _outputManager->GetTotalChannels());
-            }
+            _outputPipeline->Frame(_outputProcessing, _buffer, _outputManager->GetTotalChannels());
 
             auto vm = GetOptions()->GetVirtualMatrices();
             for (auto it = vm->begin(); it != vm->end(); ++it)
@@ -435,10 +446,7 @@ void ScheduleManager::Frame(bool outputframe)
             }
 
             // apply any output processing
-            for (auto it = _outputProcessing.begin(); it != _outputProcessing.end(); ++it)
-            {
-                (*it)->Frame(_buffer, _outputManager->GetTotalChannels());
-            }
+            _outputPipeline->Frame(_outputProcessing, _buffer, _outputManager->GetTotalChannels());
             _outputManager->EndFrame();
         }
     }
@@ -470,6 +478,8 @@ void ScheduleManager::CreateBrightnessArray()
 
 bool ScheduleManager::PlayPlayList(PlayList* playlist, size_t& rate, bool loop, const std::string& step, bool forcelast, int plloops, bool random, int steploops)
 {
+    PlaybackLock lock;
+
     bool result = true;
 
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
@@ -522,6 +532,8 @@ bool compare_runningschedules(const RunningSchedule* first, const RunningSchedul
 
 int ScheduleManager::CheckSchedule()
 {
+    PlaybackLock lock;
+
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
     logger_base.debug("Checking the schedule ...");
 
@@ -689,6 +701,8 @@ std::string ScheduleManager::FormatTime(size_t timems)
 
 std::string ScheduleManager::GetStatus() const
 {
+    PlaybackLock lock;
+
     PlayList* curr = GetRunningPlayList();
 
     if (!IsSomethingPlaying())
@@ -720,6 +734,8 @@ bool ScheduleManager::IsQueuedPlaylistRunning() const
 // localhost/xScheduleCommand?Command=<command>&Parameters=<comma separated parameters>
 bool ScheduleManager::Action(const std::string command, const std::string parameters, const std::string& data, PlayList* selplaylist, Schedule* selschedule, size_t& rate, std::string& msg)
 {
+    PlaybackLock lock;
+
     bool result = true;
 
     Command* cmd = _commandManager.GetCommand(command);
@@ -1457,6 +1473,8 @@ bool ScheduleManager::Action(const std::string command, const std::string parame
 
 bool ScheduleManager::Action(const std::string label, PlayList* selplaylist, Schedule* selschedule, size_t& rate, std::string& msg)
 {
+    PlaybackLock lock;
+
     UserButton* b = _scheduleOptions->GetButton(label);
 
     if (b != nullptr)
@@ -1475,6 +1493,8 @@ bool ScheduleManager::Action(const std::string label, PlayList* selplaylist, Sch
 
 void ScheduleManager::StopPlayList(PlayList* playlist, bool atendofcurrentstep)
 {
+    PlaybackLock lock;
+
     if (_immediatePlay != nullptr && _immediatePlay->GetId() == playlist->GetId())
     {
         if (atendofcurrentstep)
@@ -1515,6 +1535,8 @@ void ScheduleManager::StopPlayList(PlayList* playlist, bool atendofcurrentstep)
 
 bool ScheduleManager::Query(const std::string command, const std::string parameters, std::string& data, std::string& msg, const std::string& ip)
 {
+    PlaybackLock lock;
+
     bool result = true;
     data = "";
     if (command == "GetPlayLists")
@@ -1715,6 +1737,19 @@ bool ScheduleManager::Query(const std::string command, const std::string paramet
     {
         data = _scheduleOptions->GetButtonsJSON(_commandManager);
     }
+    else if (command == "GetPlaybackStats")
+    {
+        PlaybackEngine* engine = xScheduleFrame::GetPlaybackEngine();
+        if (engine != nullptr)
+        {
+            data = engine->GetStatsJSON();
+        }
+        else
+        {
+            result = false;
+            msg = "Playback engine not running.";
+        }
+    }
     else
     {
         result = false;
@@ -1776,6 +1811,8 @@ bool ScheduleManager::RetrieveData(const std::string& key, std::string& data, st
 
 bool ScheduleManager::ToggleCurrentPlayListRandom(std::string& msg)
 {
+    PlaybackLock lock;
+
     PlayList* p = GetRunningPlayList();
 
     if (p != nullptr)
@@ -1791,6 +1828,8 @@ bool ScheduleManager::ToggleCurrentPlayListRandom(std::string& msg)
 
 bool ScheduleManager::ToggleCurrentPlayListPause(std::string& msg)
 {
+    PlaybackLock lock;
+
     PlayList* p = GetRunningPlayList();
     if (p != nullptr)
     {
@@ -1807,6 +1846,8 @@ bool ScheduleManager::ToggleCurrentPlayListPause(std::string& msg)
 
 bool ScheduleManager::ToggleCurrentPlayListLoop(std::string& msg)
 {
+    PlaybackLock lock;
+
     PlayList* p = GetRunningPlayList();
 
     if (p != nullptr)
@@ -1822,6 +1863,8 @@ bool ScheduleManager::ToggleCurrentPlayListLoop(std::string& msg)
 
 bool ScheduleManager::ToggleCurrentPlayListStepLoop(std::string& msg)
 {
+    PlaybackLock lock;
+
     PlayList* p = GetRunningPlayList();
 
     if (p != nullptr)
@@ -1854,6 +1897,8 @@ bool ScheduleManager::IsOutputToLights() const
 
 RunningSchedule* ScheduleManager::GetRunningSchedule() const
 {
+    PlaybackLock lock;
+
     if (_immediatePlay != nullptr) return nullptr;
     if (_queuedSongs->IsRunning()) return nullptr;
     if (_activeSchedules.size() == 0) return nullptr;
@@ -1901,6 +1946,8 @@ RunningSchedule* ScheduleManager::GetRunningSchedule(const std::string& schedule
 
 void ScheduleManager::SetOutputToLights(bool otl)
 {
+    PlaybackLock lock;
+
     if (_outputManager != nullptr)
     {
         if (otl)
@@ -1926,6 +1973,8 @@ void ScheduleManager::SetOutputToLights(bool otl)
 
 void ScheduleManager::ManualOutputToLightsClick()
 {
+    PlaybackLock lock;
+
     _manualOTL++;
     if (_manualOTL > 1) _manualOTL = -1;
     if (_manualOTL == 1)
@@ -1944,6 +1993,8 @@ void ScheduleManager::ManualOutputToLightsClick()
 
 bool ScheduleManager::ToggleOutputToLights(std::string& msg)
 {
+    PlaybackLock lock;
+
     if (_outputManager->IsOutputting())
     {
         _manualOTL = 0;
@@ -1960,6 +2011,8 @@ bool ScheduleManager::ToggleOutputToLights(std::string& msg)
 
 void ScheduleManager::SetVolume(int volume)
 {
+    PlaybackLock lock;
+
     int cv = volume;
     if (cv < 0) cv = 0;
     if (cv > 100) cv = 100;
@@ -1967,6 +2020,8 @@ void ScheduleManager::SetVolume(int volume)
 }
 void ScheduleManager::AdjustVolumeBy(int volume)
 {
+    PlaybackLock lock;
+
     int cv = GetVolume();
     cv += volume;
     SetVolume(cv);
@@ -1986,6 +2041,8 @@ size_t ScheduleManager::GetTotalChannels() const
 
 void ScheduleManager::ToggleMute()
 {
+    PlaybackLock lock;
+
     static int savevolume = 100;
     if (GetVolume() > 0)
     {
@@ -2000,6 +2057,8 @@ void ScheduleManager::ToggleMute()
 
 void ScheduleManager::SetMode(SYNCMODE mode)
 {
+    PlaybackLock lock;
+
     if (_mode != mode)
     {
         _mode = mode;
@@ -2060,6 +2119,8 @@ PlayList* ScheduleManager::GetPlayList(int id) const
 
 void ScheduleManager::SetBackgroundPlayList(PlayList* playlist)
 {
+    PlaybackLock lock;
+
     if (playlist == nullptr && _backgroundPlayList != nullptr)
     {
         _backgroundPlayList->Stop();
@@ -2773,6 +2834,8 @@ void ScheduleManager::CheckScheduleIntegrity(bool display)
 
 void ScheduleManager::ImportxLightsSchedule(const std::string& filename)
 {
+    PlaybackLock lock;
+
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
 
     wxFileName fn(filename);
@@ -2842,6 +2905,8 @@ void ScheduleManager::ImportxLightsSchedule(const std::string& filename)
 
 bool ScheduleManager::DoXyzzy(const std::string& command, const std::string& parameters, std::string& result)
 {
+    PlaybackLock lock;
+
     if (_xyzzy == nullptr)
     {
         _xyzzy = new Xyzzy();
@@ -2956,39 +3021,9 @@ void PixelData::Set(wxByte* buffer, size_t size)
 {
     size_t toset = std::min(_size, size - (_startChannel - 1));
 
-    for (size_t i = 0; i < toset; i++)
+    if (toset > 0)
     {
-        wxByte* p = buffer + _startChannel - 1 + i;
-        switch (_blendMode)
-        {
-        case APPLYMETHOD::METHOD_OVERWRITE:
-            *p = _data[i];
-            break;
-        case APPLYMETHOD::METHOD_AVERAGE:
-            *p = ((int)*p + (int)_data[i]) / 2;
-            break;
-        case APPLYMETHOD::METHOD_MASK:
-            if (_data[i] > 0)
-            {
-                *p = 0x00;
-            }
-            break;
-        case APPLYMETHOD::METHOD_UNMASK:
-            if (_data[i] == 0)
-            {
-                *p = 0x00;
-            }
-            break;
-        case APPLYMETHOD::METHOD_MAX:
-            *p = std::max(*p, _data[i]);
-            break;
-        case APPLYMETHOD::METHOD_OVERWRITEIFBLACK:
-            if (*p == 0)
-            {
-                *p = _data[i];
-            }
-            break;
-        }
+        BlendChannels(buffer + _startChannel - 1, &_data[0], toset, _blendMode);
     }
 }
 
@@ -15,6 +15,7 @@ class RunningSchedule;
 class wxSocketClient;
 class PlayListStep;
 class OutputProcess;
+class OutputProcessPipeline;
 class Xyzzy;
 
 typedef enum
@@ -64,6 +65,7 @@ class ScheduleManager
     wxByte _brightnessArray[255];
     wxSocketClient* _fppSync;
     std::list<OutputProcess*> _outputProcessing;
+    OutputProcessPipeline* _outputPipeline;
     Xyzzy* _xyzzy;
 
     std::string FormatTime(size_t timems);
@@ -117,7 +119,7 @@ class ScheduleManager
         int GetBrightness() const { return _brightness; }
         void AdjustBrightness(int by) { _brightness += by; if (_brightness < 0) _brightness = 0; else if (_brightness > 100) _brightness = 100; }
         void SetBrightness(int brightness) { if (brightness < 0) _brightness = 0; else if (brightness > 100) _brightness = 100; else _brightness = brightness; }
-        void Frame(bool outputframe); // called when a frame needs to be displayed ... returns desired frame rate
+        void Frame(bool outputframe); // called by the playback engine with the playback lock held when a frame needs to be displayed
         int CheckSchedule();
         std::string GetShowDir() const { return _showDir; }
         bool PlayPlayList(PlayList* playlist, size_t& rate, bool loop = false, const std::string& step = "", bool forcelast = false, int loops = -1, bool random = false, int steploops = -1);
@@ -1,4 +1,5 @@
 #include "VirtualMatricesDialog.h"
+#include "PlaybackEngine.h"
 #include "VirtualMatrix.h"
 #include "VirtualMatrixDialog.h"
 
@@ -124,6 +125,8 @@ void VirtualMatricesDialog::OnButton_DeleteClick(wxCommandEvent& event)
 
 void VirtualMatricesDialog::OnButton_OkClick(wxCommandEvent& event)
 {
+    PlaybackLock lock;
+
     while (_vmatrices->size() > 0)
     {
         auto todelete = _vmatrices->front();
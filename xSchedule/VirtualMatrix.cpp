@@ -3,6 +3,7 @@
 #include <wx/xml/xml.h>
 #include <wx/wx.h>
 #include <log4cpp/Category.hh>
+#include "PlaybackEngine.h"
 
 VirtualMatrix::VirtualMatrix(int width, int height, bool topMost, VMROTATION rotation, wxImageResizeQuality quality, size_t startChannel, const std::string& name, wxSize size, wxPoint loc)
 {
@@ -214,16 +215,19 @@ void VirtualMatrix::Start()
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
     logger_base.debug("Virtual matrix started %s.", (const char *)_name.c_str());
 
-    // create the window
-    if (_window == nullptr)
+    // create the window ... windows must be created on the main thread
+    PlaybackEngine::RunOnMainThread([this]()
     {
-        _window = new PlayerWindow(nullptr, _topMost, _quality, wxID_ANY, _location, _size);
-    }
-    else
-    {
-        _window->Move(_location);
-        _window->SetSize(_size);
-    }
+        if (_window == nullptr)
+        {
+            _window = new PlayerWindow(nullptr, _topMost, _quality, wxID_ANY, _location, _size);
+        }
+        else
+        {
+            _window->Move(_location);
+            _window->SetSize(_size);
+        }
+    });
 
     if (_image != nullptr)
     {
@@ -246,9 +250,12 @@ void VirtualMatrix::Stop()
     }
 
     // destroy the window
-    if (_window != nullptr)
+    PlaybackEngine::RunOnMainThread([this]()
     {
-        delete _window;
-        _window = nullptr;
-    }
+        if (_window != nullptr)
+        {
+            delete _window;
+            _window = nullptr;
+        }
+    });
 }
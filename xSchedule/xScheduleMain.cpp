@@ -33,6 +33,7 @@
 #include "../xLights/osxMacUtils.h"
 #include "BackgroundPlaylistDialog.h"
 #include "MatricesDialog.h"
+#include "PlaybackEngine.h"
 
 #include "../include/xs_xyzzy.xpm"
 #include "../include/xs_save.xpm"
@@ -70,6 +71,7 @@
 //*)
 
 ScheduleManager* xScheduleFrame::__schedule = nullptr;
+PlaybackEngine* xScheduleFrame::__engine = nullptr;
 
 //helper functions
 enum wxbuildinfoformat {
@@ -141,7 +143,6 @@ const long xScheduleFrame::ID_MNU_FPPMASTER = wxNewId();
 const long xScheduleFrame::ID_MNU_FPPREMOTE = wxNewId();
 const long xScheduleFrame::idMenuAbout = wxNewId();
 const long xScheduleFrame::ID_STATUSBAR1 = wxNewId();
-const long xScheduleFrame::ID_TIMER1 = wxNewId();
 const long xScheduleFrame::ID_TIMER2 = wxNewId();
 //*)
 
@@ -282,7 +283,6 @@ xScheduleFrame::xScheduleFrame(wxWindow* parent, const std::string& showdir, con
     _statusSetAt = wxDateTime::Now();
     __schedule = nullptr;
     _webServer = nullptr;
-    _timerOutputFrame = false;
     _suspendOTL = false;
 
     //(*Initialize(xScheduleFrame)
@@ -436,8 +436,6 @@ xScheduleFrame::xScheduleFrame(wxWindow* parent, const std::string& showdir, con
     StatusBar1->SetStatusStyles(1,__wxStatusBarStyles_1);
     SetStatusBar(StatusBar1);
     DirDialog1 = new wxDirDialog(this, _("Select show folder ..."), wxEmptyString, wxDD_DEFAULT_STYLE, wxDefaultPosition, wxDefaultSize, _T("wxDirDialog"));
-    _timer.SetOwner(this, ID_TIMER1);
-    _timer.Start(500000, false);
     _timerSchedule.SetOwner(this, ID_TIMER2);
     _timerSchedule.Start(50000, false);
     FileDialog1 = new wxFileDialog(this, _("Select file"), wxEmptyString, _("xlights_schedule.xml"), _("xlights_schedule.xml"), wxFD_DEFAULT_STYLE|wxFD_OPEN|wxFD_FILE_MUST_EXIST, wxDefaultPosition, wxDefaultSize, _T("wxFileDialog"));
@@ -480,7 +478,6 @@ xScheduleFrame::xScheduleFrame(wxWindow* parent, const std::string& showdir, con
     Connect(ID_MNU_FPPMASTER,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xScheduleFrame::OnMenuItem_FPPMasterSelected);
     Connect(ID_MNU_FPPREMOTE,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xScheduleFrame::OnMenuItem_FPPRemoteSelected);
     Connect(idMenuAbout,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xScheduleFrame::OnAbout);
-    Connect(ID_TIMER1,wxEVT_TIMER,(wxObjectEventFunction)&xScheduleFrame::On_timerTrigger);
     Connect(ID_TIMER2,wxEVT_TIMER,(wxObjectEventFunction)&xScheduleFrame::On_timerScheduleTrigger);
     Connect(wxEVT_SIZE,(wxObjectEventFunction)&xScheduleFrame::OnResize);
     //*)
@@ -570,8 +567,10 @@ xScheduleFrame::xScheduleFrame(wxWindow* parent, const std::string& showdir, con
         UpdateUI();
     }
 
-    _timer.Stop();
-    _timer.Start(rate/2, false);
+    __engine = new PlaybackEngine(this);
+    // only needed where the system timers cannot wake the playback thread close to a deadline
+    __engine->SetSpinUS(wxConfigBase::Get()->ReadLong("xsPlaybackSpinUS", 0));
+    __engine->Start(rate);
     _timerSchedule.Stop();
     _timerSchedule.Start(500, true);
 
@@ -583,12 +582,16 @@ xScheduleFrame::xScheduleFrame(wxWindow* parent, const std::string& showdir, con
 
 void xScheduleFrame::LoadSchedule()
 {
-    if (__schedule != nullptr)
     {
-        delete __schedule;
-        __schedule = nullptr;
+        // the playback thread must not be part way through a frame while we swap the schedule
+        PlaybackLock lock;
+        if (__schedule != nullptr)
+        {
+            delete __schedule;
+            __schedule = nullptr;
+        }
+        __schedule = new ScheduleManager(_showDir);
     }
-    __schedule = new ScheduleManager(_showDir);
 
     if (_webServer != nullptr)
     {
@@ -615,6 +618,10 @@ void xScheduleFrame::LoadSchedule()
 
 xScheduleFrame::~xScheduleFrame()
 {
+    // stop the playback thread before the schedule it plays goes away
+    delete __engine;
+    __engine = nullptr;
+
     int x, y;
     GetPosition(&x, &y);
 
@@ -761,8 +768,11 @@ void xScheduleFrame::DeleteSelectedItem()
             if (IsPlayList(treeitem))
             {
                 PlayList* playlist = (PlayList*)((MyTreeItemData*)TreeCtrl_PlayListsSchedules->GetItemData(treeitem))->GetData();
-                __schedule->RemovePlayList(playlist);
-                delete playlist;
+                {
+                    PlaybackLock lock;
+                    __schedule->RemovePlayList(playlist);
+                    delete playlist;
+                }
 
                 TreeCtrl_PlayListsSchedules->Delete(treeitem);
             }
@@ -770,8 +780,12 @@ void xScheduleFrame::DeleteSelectedItem()
             {
                 PlayList* playlist = (PlayList*)((MyTreeItemData*)TreeCtrl_PlayListsSchedules->GetItemData(TreeCtrl_PlayListsSchedules->GetItemParent(treeitem)))->GetData();
                 Schedule* schedule = (Schedule*)((MyTreeItemData*)TreeCtrl_PlayListsSchedules->GetItemData(treeitem))->GetData();
-                playlist->RemoveSchedule(schedule);
-                delete schedule;
+                {
+                    // the playback thread walks the playlist's schedules every frame
+                    PlaybackLock lock;
+                    playlist->RemoveSchedule(schedule);
+                    delete schedule;
+                }
                 TreeCtrl_PlayListsSchedules->Delete(treeitem);
             }
             TreeCtrl_PlayListsSchedules->SelectItem(parent);
@@ -835,6 +849,7 @@ void xScheduleFrame::DoPaste()
 
                         if (to != nullptr)
                         {
+                            PlaybackLock lock;
                             to->AddSchedule(new Schedule(*schedule, true));
                             UpdateTree();
                         }
@@ -985,23 +1000,6 @@ void xScheduleFrame::OnTreeCtrl_PlayListsSchedulesItemActivated(wxTreeEvent& eve
     ValidateWindow();
 }
 
-void xScheduleFrame::On_timerTrigger(wxTimerEvent& event)
-{
-    static int last = -1;
-    if (__schedule == nullptr) return;
-
-    __schedule->Frame(_timerOutputFrame);
-
-    if (last != wxDateTime::Now().GetSecond() && _timerOutputFrame)
-    {
-        last = wxDateTime::Now().GetSecond();
-        wxCommandEvent event(EVT_SCHEDULECHANGED);
-        wxPostEvent(this, event);
-    }
-
-    _timerOutputFrame = !_timerOutputFrame;
-}
-
 void xScheduleFrame::UpdateSchedule()
 {
     if (__schedule == nullptr) return;
@@ -1010,56 +1008,57 @@ void xScheduleFrame::UpdateSchedule()
 
     int rate = __schedule->CheckSchedule();
 
-    // highlight the state of all schedule items in the tree
-    wxTreeItemIdValue tid;
-    auto root = TreeCtrl_PlayListsSchedules->GetRootItem();
-    for (auto it = TreeCtrl_PlayListsSchedules->GetFirstChild(root, tid); it != nullptr; it = TreeCtrl_PlayListsSchedules->GetNextChild(root, tid))
     {
-        //PlayList* playlist = (PlayList*)((MyTreeItemData*)TreeCtrl_PlayListsSchedules->GetItemData(it))->GetData();
+        // running schedules can be stopped by the playback thread while we walk them
+        PlaybackLock lock;
 
-        wxTreeItemIdValue tid2;
-        for (auto it2 = TreeCtrl_PlayListsSchedules->GetFirstChild(it, tid2); it2 != nullptr; it2 = TreeCtrl_PlayListsSchedules->GetNextChild(it, tid2))
+        // highlight the state of all schedule items in the tree
+        wxTreeItemIdValue tid;
+        auto root = TreeCtrl_PlayListsSchedules->GetRootItem();
+        for (auto it = TreeCtrl_PlayListsSchedules->GetFirstChild(root, tid); it != nullptr; it = TreeCtrl_PlayListsSchedules->GetNextChild(root, tid))
         {
-            Schedule* schedule = (Schedule*)((MyTreeItemData*)TreeCtrl_PlayListsSchedules->GetItemData(it2))->GetData();
-
-            TreeCtrl_PlayListsSchedules->SetItemText(it2, GetScheduleName(schedule, __schedule->GetRunningSchedules()));
+            //PlayList* playlist = (PlayList*)((MyTreeItemData*)TreeCtrl_PlayListsSchedules->GetItemData(it))->GetData();
 
-            if (__schedule->IsScheduleActive(schedule))
+            wxTreeItemIdValue tid2;
+            for (auto it2 = TreeCtrl_PlayListsSchedules->GetFirstChild(it, tid2); it2 != nullptr; it2 = TreeCtrl_PlayListsSchedules->GetNextChild(it, tid2))
             {
-                RunningSchedule* rs = __schedule->GetRunningSchedule();
-                if (rs != nullptr && rs->GetPlayList()->IsRunning() &&rs->GetSchedule()->GetId() == schedule->GetId())
-                {
-                    TreeCtrl_PlayListsSchedules->SetItemBackgroundColour(it2, wxColor(146, 244, 155));
-                }
-                else
+                Schedule* schedule = (Schedule*)((MyTreeItemData*)TreeCtrl_PlayListsSchedules->GetItemData(it2))->GetData();
+
+                TreeCtrl_PlayListsSchedules->SetItemText(it2, GetScheduleName(schedule, __schedule->GetRunningSchedules()));
+
+                if (__schedule->IsScheduleActive(schedule))
                 {
-                    RunningSchedule* r = __schedule->GetRunningSchedule(schedule);
-                    wxASSERT(r != nullptr);
-                    if (r == nullptr || !r->GetPlayList()->IsRunning())
+                    RunningSchedule* rs = __schedule->GetRunningSchedule();
+                    if (rs != nullptr && rs->GetPlayList()->IsRunning() &&rs->GetSchedule()->GetId() == schedule->GetId())
                     {
-                        // stopped
-                        TreeCtrl_PlayListsSchedules->SetItemBackgroundColour(it2, wxColor(0xe7, 0x74, 0x71));
+                        TreeCtrl_PlayListsSchedules->SetItemBackgroundColour(it2, wxColor(146, 244, 155));
                     }
                     else
                     {
-                        // waiting
-                        TreeCtrl_PlayListsSchedules->SetItemBackgroundColour(it2, wxColor(244, 241, 146));
+                        RunningSchedule* r = __schedule->GetRunningSchedule(schedule);
+                        wxASSERT(r != nullptr);
+                        if (r == nullptr || !r->GetPlayList()->IsRunning())
+                        {
+                            // stopped
+                            TreeCtrl_PlayListsSchedules->SetItemBackgroundColour(it2, wxColor(0xe7, 0x74, 0x71));
+                        }
+                        else
+                        {
+                            // waiting
+                            TreeCtrl_PlayListsSchedules->SetItemBackgroundColour(it2, wxColor(244, 241, 146));
+                        }
                     }
                 }
-            }
-            else
-            {
-                TreeCtrl_PlayListsSchedules->SetItemBackgroundColour(it2, *wxWHITE);
+                else
+                {
+                    TreeCtrl_PlayListsSchedules->SetItemBackgroundColour(it2, *wxWHITE);
+                }
             }
         }
     }
 
-    // if the desired rate is different than the current rate then restart timer with the desired rate
-    if (_timer.GetInterval() != rate / 2)
-    {
-        _timer.Stop();
-        _timer.Start(rate / 2);
-    }
+    // if the desired rate is different than the current rate then tell the playback engine
+    __engine->SetFrameInterval(rate);
 
     // Ensure I am firing on the minute
     if (wxDateTime::Now().GetSecond() != 0)
@@ -1204,11 +1203,7 @@ void xScheduleFrame::CreateButtons()
 
 void xScheduleFrame::RateNotification(wxCommandEvent& event)
 {
-    if (_timer.GetInterval() != event.GetInt() / 2)
-    {
-        _timer.Stop();
-        _timer.Start(event.GetInt() / 2);
-    }
+    __engine->SetFrameInterval(event.GetInt());
 }
 
 void xScheduleFrame::StatusMsgNotification(wxCommandEvent& event)
@@ -1248,15 +1243,11 @@ void xScheduleFrame::OnButton_UserClick(wxCommandEvent& event)
         schedule = (Schedule*)((MyTreeItemData*)TreeCtrl_PlayListsSchedules->GetItemData(treeitem))->GetData();
     }
 
-    size_t rate = _timer.GetInterval();
+    size_t rate = __engine->GetFrameInterval();
     std::string msg = "";
     __schedule->Action(((wxButton*)event.GetEventObject())->GetLabel().ToStdString(), playlist, schedule, rate, msg);
 
-    if (rate / 2 != _timer.GetInterval())
-    {
-        _timer.Stop();
-        _timer.Start(rate / 2);
-    }
+    __engine->SetFrameInterval(rate);
 
     UpdateSchedule();
     UpdateUI();
@@ -1366,6 +1357,8 @@ void xScheduleFrame::OnResize(wxSizeEvent& event)
 
 void xScheduleFrame::OnListView_RunningItemActivated(wxListEvent& event)
 {
+    PlaybackLock lock;
+
     int selected = ListView_Running->GetFirstSelected();
 
     PlayList* p = __schedule->GetRunningPlayList();
@@ -1392,6 +1385,8 @@ std::string FormatTime(size_t timems, bool ms = false)
 
 void xScheduleFrame::UpdateStatus()
 {
+    PlaybackLock lock;
+
     ListView_Running->Freeze();
 
     if (StatusBar1->GetStatusText() != "" && (wxDateTime::Now() - _statusSetAt).GetMilliseconds() >  5000)
@@ -1870,15 +1865,11 @@ bool xScheduleFrame::HandleHotkeys(wxKeyEvent& event)
                 schedule = (Schedule*)((MyTreeItemData*)TreeCtrl_PlayListsSchedules->GetItemData(treeitem))->GetData();
             }
 
-            size_t rate = _timer.GetInterval();
+            size_t rate = __engine->GetFrameInterval();
             std::string msg = "";
             __schedule->Action((*it)->GetLabel(), playlist, schedule, rate, msg);
 
-            if (rate / 2 != _timer.GetInterval())
-            {
-                _timer.Stop();
-                _timer.Start(rate / 2);
-            }
+            __engine->SetFrameInterval(rate);
 
             UpdateSchedule();
             return true;
@@ -1982,17 +1973,27 @@ void xScheduleFrame::EditSelectedItem(bool forceadvanced)
     wxTreeItemId treeitem = TreeCtrl_PlayListsSchedules->GetSelection();
     if (IsPlayList(treeitem))
     {
+        // the playback thread copies the playlist each frame so edit a copy and only swap
+        // the changes in under the lock once the dialog is closed
         PlayList* playlist = (PlayList*)((MyTreeItemData*)TreeCtrl_PlayListsSchedules->GetItemData(treeitem))->GetData();
-        if (playlist->Configure(this, forceadvanced || __schedule->GetOptions()->IsAdvancedMode()) != nullptr)
+        PlayList edited(*playlist);
+        if (edited.Configure(this, forceadvanced || __schedule->GetOptions()->IsAdvancedMode()) != nullptr)
         {
+            {
+                PlaybackLock lock;
+                *playlist = edited;
+            }
             TreeCtrl_PlayListsSchedules->SetItemText(treeitem, playlist->GetName());
         }
     }
     else if (IsSchedule(treeitem))
     {
         Schedule* schedule = (Schedule*)((MyTreeItemData*)TreeCtrl_PlayListsSchedules->GetItemData(treeitem))->GetData();
-        if (schedule->Configure(this) != nullptr)
+        Schedule edited(*schedule);
+        if (edited.Configure(this) != nullptr)
         {
+            PlaybackLock lock;
+            *schedule = edited;
             TreeCtrl_PlayListsSchedules->SetItemText(treeitem, schedule->GetName());
             auto rs = __schedule->GetRunningSchedule(schedule);
             if (rs != nullptr) rs->Reset();
@@ -2108,6 +2109,7 @@ void xScheduleFrame::AddSchedule()
             PlayList* playlist = (PlayList*)((MyTreeItemData*)TreeCtrl_PlayListsSchedules->GetItemData(treeitem))->GetData();
             TreeCtrl_PlayListsSchedules->Expand(treeitem);
             TreeCtrl_PlayListsSchedules->EnsureVisible(newitem);
+            PlaybackLock lock;
             playlist->AddSchedule(schedule);
         }
 	}
@@ -29,7 +29,6 @@ class BrightnessControl;
 #include <wx/statusbr.h>
 //*)
 
-#include "../xLights/xLightsTimer.h"
 #include <list>
 
 class wxDebugReportCompress;
@@ -39,6 +38,7 @@ class WebServer;
 class Schedule;
 class RunningSchedule;
 class VolumeDisplay;
+class PlaybackEngine;
 
 wxDECLARE_EVENT(EVT_FRAMEMS, wxCommandEvent);
 wxDECLARE_EVENT(EVT_STATUSMSG, wxCommandEvent);
@@ -49,9 +49,9 @@ class xScheduleFrame : public wxFrame
 {
     WebServer* _webServer;
     static ScheduleManager* __schedule;
+    static PlaybackEngine* __engine;
     std::string _showDir;
     wxDateTime _statusSetAt;
-    bool _timerOutputFrame;
     bool _suspendOTL;
 
     void LoadShowDir();
@@ -99,6 +99,7 @@ class xScheduleFrame : public wxFrame
 public:
 
         static ScheduleManager* GetScheduleManager() { return __schedule; }
+        static PlaybackEngine* GetPlaybackEngine() { return __engine; }
         xScheduleFrame(wxWindow* parent, const std::string& showdir = "", const std::string& playlist = "", wxWindowID id = -1);
         virtual ~xScheduleFrame();
         void CreateDebugReport(wxDebugReportCompress *report);
@@ -116,7 +117,6 @@ public:
         void OnMenuItem_SaveSelected(wxCommandEvent& event);
         void OnMenuItem_ShowFolderSelected(wxCommandEvent& event);
         void OnTreeCtrl_PlayListsSchedulesItemActivated(wxTreeEvent& event);
-        void On_timerTrigger(wxTimerEvent& event);
         void On_timerScheduleTrigger(wxTimerEvent& event);
         void OnMenuItem_OptionsSelected(wxCommandEvent& event);
         void OnMenuItem_ViewLogSelected(wxCommandEvent& event);
@@ -203,7 +203,6 @@ public:
         static const long ID_MNU_FPPREMOTE;
         static const long idMenuAbout;
         static const long ID_STATUSBAR1;
-        static const long ID_TIMER1;
         static const long ID_TIMER2;
         //*)
 
@@ -232,7 +231,6 @@ public:
         wxMenu* Menu3;
         wxButton* Button_Schedule;
         wxMenuItem* MenuItem_Matrices;
-        xLightsTimer _timer;
         wxMenuItem* MenuItem_Save;
         wxPanel* Panel1;
         wxFileDialog* FileDialog1;